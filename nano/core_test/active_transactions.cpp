@@ -51,6 +51,7 @@ TEST (active_transactions, confirm_active)
 		nano::lock_guard<nano::mutex> guard (node2.rep_crawler.probable_reps_mutex);
 		node2.rep_crawler.probable_reps.emplace (nano::dev_genesis_key.pub, nano::genesis_amount, *peers.begin ());
 	}
+	node2.rep_crawler.update_principals ();
 	ASSERT_TIMELY (5s, election->votes ().size () != 1); // Votes were inserted (except for not_an_account)
 	auto confirm_req_count (election->confirmation_request_count.load ());
 	// At least one confirmation request
@@ -86,6 +87,7 @@ TEST (active_transactions, confirm_frontier)
 		nano::lock_guard<nano::mutex> guard (node2.rep_crawler.probable_reps_mutex);
 		node2.rep_crawler.probable_reps.emplace (nano::dev_genesis_key.pub, nano::genesis_amount, *peers.begin ());
 	}
+	node2.rep_crawler.update_principals ();
 
 	nano::genesis genesis;
 	auto send = nano::send_block_builder ()
@@ -106,6 +108,110 @@ TEST (active_transactions, confirm_frontier)
 	ASSERT_TIMELY (5s, node2.ledger.cache.cemented_count == 2 && node2.active.empty ());
 	ASSERT_GT (election2->confirmation_request_count, 0u);
 }
+
+TEST (active_transactions, transition_timers)
+{
+	nano::system system;
+	nano::node_flags node_flags;
+	node_flags.disable_request_loop = true;
+	auto & node = *system.add_node (node_flags);
+	nano::genesis genesis;
+	auto send = nano::send_block_builder ()
+	            .previous (genesis.hash ())
+	            .destination (nano::public_key ())
+	            .balance (nano::genesis_amount - 100)
+	            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	            .work (*system.work.generate (genesis.hash ()))
+	            .build_shared ();
+	ASSERT_EQ (nano::process_result::progress, node.process (*send).code);
+	auto election (node.active.insert (send).election);
+	ASSERT_NE (nullptr, election);
+	auto request_confirm = [&node]() {
+		nano::unique_lock<nano::mutex> lock (node.active.mutex);
+		node.active.request_confirm (lock);
+	};
+	auto visits = [&node]() {
+		return node.stats.count (nano::stat::type::election, nano::stat::detail::transition_visit);
+	};
+	// New elections are due right away
+	std::this_thread::sleep_for (2 * node.active.transition_timers_resolution);
+	request_confirm ();
+	ASSERT_EQ (1, visits ());
+	// Nothing is due before the passive period ends
+	request_confirm ();
+	ASSERT_EQ (1, visits ());
+	ASSERT_EQ (2, node.stats.count (nano::stat::type::election, nano::stat::detail::transition_pass));
+	// Changing state outside of the request loop makes the election due again
+	election->transition_active ();
+	request_confirm ();
+	ASSERT_EQ (2, visits ());
+	ASSERT_EQ (1, node.active.transition_timers.size ());
+	// Without representatives its request is not sent, the election stays due and waits in the deferred queue
+	ASSERT_EQ (1, node.active.deferred.size ());
+	ASSERT_EQ (nano::active_transactions::deferred_deadline, election->transition_deadline);
+	// Expediting a deferred election visits it once, its deferred entry is skipped
+	node.active.expedite (send->qualified_root ());
+	request_confirm ();
+	ASSERT_EQ (3, visits ());
+	ASSERT_EQ (1, node.active.deferred.size ());
+}
+
+TEST (active_transactions, transition_timers_saturated)
+{
+	nano::system system;
+	nano::node_flags node_flags;
+	node_flags.disable_request_loop = true;
+	node_flags.disable_rep_crawler = true;
+	system.add_node (node_flags);
+	auto & node = *system.add_node (node_flags);
+	// A single representative, its channel takes confirm_req_hashes_max requests per pass
+	ASSERT_EQ (1, node.config.confirm_req_batches_max);
+	auto peers (node.network.random_set (1));
+	ASSERT_FALSE (peers.empty ());
+	{
+		nano::lock_guard<nano::mutex> guard (node.rep_crawler.probable_reps_mutex);
+		node.rep_crawler.probable_reps.emplace (nano::dev_genesis_key.pub, nano::genesis_amount, *peers.begin ());
+	}
+	node.rep_crawler.update_principals ();
+	nano::block_hash previous (nano::genesis_hash);
+	for (size_t i (0); i <= nano::network::confirm_req_hashes_max; ++i)
+	{
+		auto send = nano::send_block_builder ()
+		            .previous (previous)
+		            .destination (nano::public_key ())
+		            .balance (nano::genesis_amount - 100 * (i + 1))
+		            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+		            .work (*system.work.generate (previous))
+		            .build_shared ();
+		ASSERT_EQ (nano::process_result::progress, node.process (*send).code);
+		auto election (node.active.insert (send).election);
+		ASSERT_NE (nullptr, election);
+		election->transition_active ();
+		previous = send->hash ();
+	}
+	// By descending difficulty
+	auto elections (node.active.list_active ());
+	ASSERT_EQ (nano::network::confirm_req_hashes_max + 1, elections.size ());
+	auto request_confirm = [&node]() {
+		nano::unique_lock<nano::mutex> lock (node.active.mutex);
+		node.active.request_confirm (lock);
+	};
+	// The saturated solicitor serves the highest difficulty elections, the easiest one is left over
+	request_confirm ();
+	ASSERT_EQ (1, elections.front ()->confirmation_request_count);
+	ASSERT_EQ (0, elections.back ()->confirmation_request_count);
+	{
+		nano::lock_guard<nano::mutex> guard (node.active.mutex);
+		ASSERT_EQ (1, node.active.deferred.size ());
+		ASSERT_EQ (elections.back (), node.active.deferred.begin ()->second);
+	}
+	// It is served on the next pass without waiting for a timer, the others are not due again yet
+	request_confirm ();
+	ASSERT_EQ (1, elections.back ()->confirmation_request_count);
+	ASSERT_EQ (1, elections.front ()->confirmation_request_count);
+	nano::lock_guard<nano::mutex> guard (node.active.mutex);
+	ASSERT_TRUE (node.active.deferred.empty ());
+}
 }
 
 TEST (active_transactions, keep_local)
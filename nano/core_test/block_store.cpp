@@ -520,6 +520,37 @@ TEST (block_store, unchecked_begin_search)
 	nano::send_block block2 (5, 6, 7, key0.prv, key0.pub, 8);
 }
 
+TEST (block_store, unchecked_expire)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path ());
+	ASSERT_TRUE (!store->init_error ());
+	nano::keypair key0;
+	auto block1 (std::make_shared<nano::send_block> (0, 1, 2, key0.prv, key0.pub, 3));
+	auto block2 (std::make_shared<nano::send_block> (5, 6, 7, key0.prv, key0.pub, 8));
+	nano::unchecked_key key1 (block1->previous (), block1->hash ());
+	nano::unchecked_key key2 (block2->previous (), block2->hash ());
+	auto transaction (store->tx_begin_write ());
+	store->unchecked_put (transaction, key1, nano::unchecked_info (block1, 0, 100));
+	store->unchecked_put (transaction, key2, nano::unchecked_info (block2, 0, 200));
+	// Putting again leaves a stale index entry behind which must not expire the newer entry
+	store->unchecked_put (transaction, key1, nano::unchecked_info (block1, 0, 300));
+	std::vector<nano::unchecked_info> expired;
+	ASSERT_EQ (0, store->unchecked_expire (transaction, 100, 16, expired));
+	ASSERT_TRUE (expired.empty ());
+	ASSERT_EQ (2, store->unchecked_expire (transaction, 250, 16, expired));
+	ASSERT_EQ (1, expired.size ());
+	ASSERT_EQ (*block2, *expired[0].block);
+	ASSERT_EQ (1, store->unchecked_count (transaction));
+	ASSERT_TRUE (store->unchecked_exists (transaction, key1));
+	// Deleting an entry removes its index entry as well
+	store->unchecked_del (transaction, key1);
+	ASSERT_EQ (store->unchecked_expiry_end (), store->unchecked_expiry_begin (transaction));
+	expired.clear ();
+	ASSERT_EQ (0, store->unchecked_expire (transaction, 400, 16, expired));
+	ASSERT_TRUE (expired.empty ());
+}
+
 TEST (block_store, frontier_retrieval)
 {
 	nano::logger_mt logger;
@@ -1241,6 +1272,125 @@ TEST (block_store, pruned_blocks)
 	ASSERT_EQ (store->pruned_count (store->tx_begin_read ()), 0);
 }
 
+TEST (block_store, block_previous_timestamp)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path ());
+	ASSERT_TRUE (!store->init_error ());
+	nano::keypair key1;
+	nano::open_block open (0, 1, key1.pub, key1.prv, key1.pub, 0);
+	open.sideband_set (nano::block_sideband (key1.pub, 0, 10, 1, 100, nano::epoch::epoch_0, false, false, false, nano::epoch::epoch_0));
+	nano::send_block send (open.hash (), 2, 5, key1.prv, key1.pub, 0);
+	send.sideband_set (nano::block_sideband (key1.pub, 0, 5, 2, 200, nano::epoch::epoch_0, true, false, false, nano::epoch::epoch_0));
+	nano::state_block state (key1.pub, send.hash (), key1.pub, 0, 3, key1.prv, key1.pub, 0);
+	state.sideband_set (nano::block_sideband (key1.pub, 0, 0, 3, 300, nano::epoch::epoch_1, true, false, false, nano::epoch::epoch_1));
+	auto transaction (store->tx_begin_write ());
+	store->block_put (transaction, open.hash (), open);
+	store->block_put (transaction, send.hash (), send);
+	store->block_put (transaction, state.hash (), state);
+	nano::block_hash previous;
+	uint64_t timestamp (0);
+	ASSERT_FALSE (store->block_previous_timestamp_get (transaction, open.hash (), previous, timestamp));
+	ASSERT_TRUE (previous.is_zero ());
+	ASSERT_EQ (100, timestamp);
+	ASSERT_FALSE (store->block_previous_timestamp_get (transaction, send.hash (), previous, timestamp));
+	ASSERT_EQ (open.hash (), previous);
+	ASSERT_EQ (200, timestamp);
+	ASSERT_FALSE (store->block_previous_timestamp_get (transaction, state.hash (), previous, timestamp));
+	ASSERT_EQ (send.hash (), previous);
+	ASSERT_EQ (300, timestamp);
+	ASSERT_TRUE (store->block_previous_timestamp_get (transaction, 42, previous, timestamp));
+}
+
+TEST (block_store, pruning_progress)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path ());
+	ASSERT_TRUE (!store->init_error ());
+	auto transaction (store->tx_begin_write ());
+	auto version (store->version_get (transaction));
+	ASSERT_TRUE (store->pruning_progress_get (transaction).is_zero ());
+	nano::keypair key1;
+	store->pruning_progress_put (transaction, key1.pub);
+	ASSERT_EQ (key1.pub, store->pruning_progress_get (transaction));
+	ASSERT_EQ (version, store->version_get (transaction));
+	store->pruning_progress_put (transaction, nano::account (0));
+	ASSERT_TRUE (store->pruning_progress_get (transaction).is_zero ());
+}
+
+TEST (block_store, bootstrap_progress)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path ());
+	ASSERT_TRUE (!store->init_error ());
+	auto transaction (store->tx_begin_write ());
+	auto version (store->version_get (transaction));
+	nano::account account;
+	ASSERT_TRUE (store->bootstrap_progress_get (transaction, 0, account));
+	nano::keypair key1;
+	nano::keypair key2;
+	store->bootstrap_progress_put (transaction, 0, key1.pub);
+	store->bootstrap_progress_put (transaction, 15, key2.pub);
+	ASSERT_FALSE (store->bootstrap_progress_get (transaction, 0, account));
+	ASSERT_EQ (key1.pub, account);
+	ASSERT_FALSE (store->bootstrap_progress_get (transaction, 15, account));
+	ASSERT_EQ (key2.pub, account);
+	ASSERT_TRUE (store->bootstrap_progress_get (transaction, 1, account));
+	ASSERT_EQ (version, store->version_get (transaction));
+	ASSERT_TRUE (store->pruning_progress_get (transaction).is_zero ());
+	store->bootstrap_progress_del (transaction, 0);
+	store->bootstrap_progress_del (transaction, 1);
+	ASSERT_TRUE (store->bootstrap_progress_get (transaction, 0, account));
+	ASSERT_FALSE (store->bootstrap_progress_get (transaction, 15, account));
+}
+
+TEST (block_store, bulk_loader)
+{
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path ());
+	ASSERT_TRUE (!store->init_error ());
+	nano::account account1 (1);
+	nano::account account2 (2);
+	{
+		auto loader (store->make_bulk_loader (nano::tables::confirmation_height));
+		loader->put (account1, nano::confirmation_height_info{ 1, nano::block_hash (3) });
+		loader->put (account2, nano::confirmation_height_info{ 2, nano::block_hash (4) });
+		ASSERT_EQ (2, loader->count);
+		ASSERT_FALSE (loader->commit ());
+	}
+	{
+		auto loader (store->make_bulk_loader (nano::tables::pruned));
+		loader->put (nano::block_hash (5));
+		ASSERT_FALSE (loader->commit ());
+	}
+	// The blocks table has a table factory of its own, which the loader must keep alive while writing
+	nano::open_block block (0, 1, 0, nano::keypair ().prv, 0, 0);
+	block.sideband_set ({});
+	{
+		std::vector<uint8_t> vector;
+		{
+			nano::vectorstream stream (vector);
+			nano::serialize_block (stream, block);
+			block.sideband ().serialize (stream, block.type ());
+		}
+		auto loader (store->make_bulk_loader (nano::tables::blocks));
+		loader->put (block.hash (), vector);
+		ASSERT_EQ (1, loader->count);
+		ASSERT_FALSE (loader->commit ());
+	}
+	auto transaction (store->tx_begin_read ());
+	auto block1 (store->block_get (transaction, block.hash ()));
+	ASSERT_NE (nullptr, block1);
+	ASSERT_EQ (block, *block1);
+	nano::confirmation_height_info info;
+	ASSERT_FALSE (store->confirmation_height_get (transaction, account1, info));
+	ASSERT_EQ (1, info.height);
+	ASSERT_EQ (nano::block_hash (3), info.frontier);
+	ASSERT_FALSE (store->confirmation_height_get (transaction, account2, info));
+	ASSERT_EQ (2, info.height);
+	ASSERT_TRUE (store->pruned_exists (transaction, nano::block_hash (5)));
+}
+
 TEST (mdb_block_store, upgrade_v14_v15)
 {
 	if (nano::using_rocksdb_in_tests ())
@@ -1821,6 +1971,42 @@ TEST (mdb_block_store, upgrade_v20_v21)
 	ASSERT_LT (19, store.version_get (transaction));
 }
 
+TEST (mdb_block_store, upgrade_v21_v22)
+{
+	if (nano::using_rocksdb_in_tests ())
+	{
+		// Don't test this in rocksdb mode
+		return;
+	}
+	auto path (nano::unique_path ());
+	nano::genesis genesis;
+	nano::logger_mt logger;
+	nano::stat stats;
+	auto block (std::make_shared<nano::send_block> (0, 1, 2, nano::keypair ().prv, 4, 5));
+	{
+		nano::mdb_store store (logger, path);
+		nano::ledger ledger (store, stats);
+		auto transaction (store.tx_begin_write ());
+		store.initialize (transaction, genesis, ledger.cache);
+		store.unchecked_put (transaction, nano::unchecked_key (block->previous (), block->hash ()), nano::unchecked_info (block, 0, 10));
+		// Delete expiry index
+		ASSERT_FALSE (mdb_drop (store.env.tx (transaction), store.unchecked_expiry, 1));
+		store.version_put (transaction, 21);
+	}
+	// Upgrading should create and populate the index
+	nano::mdb_store store (logger, path);
+	ASSERT_FALSE (store.init_error ());
+	ASSERT_NE (store.unchecked_expiry, 0);
+	auto transaction (store.tx_begin_write ());
+	ASSERT_EQ (22, store.version_get (transaction));
+	ASSERT_NE (store.unchecked_expiry_begin (transaction), store.unchecked_expiry_end ());
+	std::vector<nano::unchecked_info> expired;
+	ASSERT_EQ (1, store.unchecked_expire (transaction, 11, 16, expired));
+	ASSERT_EQ (1, expired.size ());
+	ASSERT_EQ (*block, *expired[0].block);
+	ASSERT_EQ (0, store.unchecked_count (transaction));
+}
+
 TEST (mdb_block_store, upgrade_backup)
 {
 	if (nano::using_rocksdb_in_tests ())
@@ -1,5 +1,7 @@
+#include <nano/node/bootstrap/bootstrap_ascending.hpp>
 #include <nano/node/bootstrap/bootstrap_frontier.hpp>
 #include <nano/node/bootstrap/bootstrap_lazy.hpp>
+#include <nano/node/bootstrap/bootstrap_legacy.hpp>
 #include <nano/node/testing.hpp>
 #include <nano/test_common/testutil.hpp>
 
@@ -803,6 +805,42 @@ TEST (bootstrap_processor, lazy_unclear_state_link)
 	ASSERT_EQ (0, node2->stats.count (nano::stat::type::bootstrap, nano::stat::detail::bulk_pull_failed_account, nano::stat::dir::in));
 }
 
+TEST (bootstrap_processor, lazy_memory_limited)
+{
+	nano::system system;
+	nano::node_config config (nano::get_available_port (), system.logging);
+	config.frontiers_confirmation = nano::frontiers_confirmation_mode::disabled;
+	nano::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_legacy_bootstrap = true;
+	auto node1 = system.add_node (config, node_flags);
+	nano::genesis genesis;
+	nano::keypair key;
+	// Generating test chain
+	auto send1 (std::make_shared<nano::state_block> (nano::dev_genesis_key.pub, genesis.hash (), nano::dev_genesis_key.pub, nano::genesis_amount - nano::Gxrb_ratio, key.pub, nano::dev_genesis_key.prv, nano::dev_genesis_key.pub, *system.work.generate (genesis.hash ())));
+	ASSERT_EQ (nano::process_result::progress, node1->process (*send1).code);
+	auto send2 (std::make_shared<nano::state_block> (nano::dev_genesis_key.pub, send1->hash (), nano::dev_genesis_key.pub, nano::genesis_amount - 2 * nano::Gxrb_ratio, key.pub, nano::dev_genesis_key.prv, nano::dev_genesis_key.pub, *system.work.generate (send1->hash ())));
+	ASSERT_EQ (nano::process_result::progress, node1->process (*send2).code);
+	auto open (std::make_shared<nano::open_block> (send1->hash (), key.pub, key.pub, key.prv, key.pub, *system.work.generate (key.pub)));
+	ASSERT_EQ (nano::process_result::progress, node1->process (*open).code);
+	auto receive (std::make_shared<nano::state_block> (key.pub, open->hash (), key.pub, 2 * nano::Gxrb_ratio, send2->hash (), key.prv, key.pub, *system.work.generate (open->hash ())));
+	ASSERT_EQ (nano::process_result::progress, node1->process (*receive).code);
+	// The limit is reached right away, the receive is not kept in the backlog waiting for its previous block
+	nano::node_config config2 (nano::get_available_port (), system.logging);
+	config2.lazy_bootstrap_memory_limit = 1;
+	auto node2 = system.add_node (config2, node_flags);
+	node2->network.udp_channels.insert (node1->network.endpoint (), node1->network_params.protocol.protocol_version);
+	node2->bootstrap_initiator.bootstrap_lazy (receive->hash ());
+	ASSERT_TIMELY (10s, !node2->bootstrap_initiator.in_progress ());
+	node2->block_processor.flush ();
+	// Its link was pulled speculatively instead and the attempt completed
+	ASSERT_LE (1, node2->stats.count (nano::stat::type::bootstrap, nano::stat::detail::lazy_memory_limited));
+	ASSERT_TRUE (node2->ledger.block_exists (send1->hash ()));
+	ASSERT_TRUE (node2->ledger.block_exists (send2->hash ()));
+	ASSERT_TRUE (node2->ledger.block_exists (open->hash ()));
+	ASSERT_TRUE (node2->ledger.block_exists (receive->hash ()));
+}
+
 TEST (bootstrap_processor, lazy_unclear_state_link_not_existing)
 {
 	nano::system system;
@@ -1114,6 +1152,78 @@ TEST (bootstrap_processor, bootstrap_fork)
 	node1->stop ();
 }
 
+TEST (bootstrap_processor, ascending)
+{
+	nano::system system;
+	nano::node_config node_config (nano::get_available_port (), system.logging);
+	node_config.frontiers_confirmation = nano::frontiers_confirmation_mode::disabled;
+	node_config.enable_voting = false;
+	nano::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_ongoing_bootstrap = true;
+	auto node0 = system.add_node (node_config, node_flags);
+	nano::keypair key;
+	system.wallet (0)->insert_adhoc (nano::dev_genesis_key.prv);
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (nano::dev_genesis_key.pub, key.pub, 100));
+	node_config.peering_port = nano::get_available_port ();
+	node_config.bootstrap_ascending = true;
+	auto node1 = system.add_node (node_config, node_flags);
+	ASSERT_NE (node0->latest (nano::dev_genesis_key.pub), node1->latest (nano::dev_genesis_key.pub));
+	node1->bootstrap_initiator.bootstrap ();
+	ASSERT_TIMELY (10s, node1->latest (nano::dev_genesis_key.pub) == node0->latest (nano::dev_genesis_key.pub));
+	ASSERT_TIMELY (10s, !node1->bootstrap_initiator.in_progress ());
+	ASSERT_EQ (1, node1->stats.count (nano::stat::type::bootstrap, nano::stat::detail::initiate_ascending, nano::stat::dir::out));
+	ASSERT_EQ (0, node1->stats.count (nano::stat::type::bootstrap, nano::stat::detail::initiate, nano::stat::dir::out));
+	// Completed attempts leave no progress behind
+	nano::account last;
+	ASSERT_TRUE (node1->store.bootstrap_progress_get (node1->store.tx_begin_read (), nano::bootstrap_attempt_ascending::range_of (nano::dev_genesis_key.pub), last));
+}
+
+TEST (bootstrap_processor, ascending_resume)
+{
+	nano::system system;
+	nano::node_config node_config (nano::get_available_port (), system.logging);
+	node_config.frontiers_confirmation = nano::frontiers_confirmation_mode::disabled;
+	node_config.enable_voting = false;
+	nano::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_ongoing_bootstrap = true;
+	auto node0 = system.add_node (node_config, node_flags);
+	system.wallet (0)->insert_adhoc (nano::dev_genesis_key.prv);
+	nano::keypair key;
+	ASSERT_NE (nullptr, system.wallet (0)->send_action (nano::dev_genesis_key.pub, key.pub, 100));
+	node_config.peering_port = nano::get_available_port ();
+	node_config.bootstrap_ascending = true;
+	auto node1 = system.add_node (node_config, node_flags);
+	// Progress left by an interrupted attempt which already compared the genesis account
+	auto range (nano::bootstrap_attempt_ascending::range_of (nano::dev_genesis_key.pub));
+	{
+		auto transaction (node1->store.tx_begin_write ());
+		node1->store.bootstrap_progress_put (transaction, range, nano::dev_genesis_key.pub);
+	}
+	node1->bootstrap_initiator.bootstrap ();
+	ASSERT_TIMELY (10s, node1->stats.count (nano::stat::type::bootstrap, nano::stat::detail::initiate_ascending, nano::stat::dir::out) == 1 && !node1->bootstrap_initiator.in_progress ());
+	ASSERT_NE (node0->latest (nano::dev_genesis_key.pub), node1->latest (nano::dev_genesis_key.pub));
+	nano::account last;
+	ASSERT_TRUE (node1->store.bootstrap_progress_get (node1->store.tx_begin_read (), range, last));
+}
+
+TEST (bootstrap_processor, ascending_current_attempt)
+{
+	nano::system system;
+	nano::node_config node_config (nano::get_available_port (), system.logging);
+	node_config.bootstrap_ascending = true;
+	nano::node_flags node_flags;
+	node_flags.disable_ongoing_bootstrap = true;
+	auto node = system.add_node (node_config, node_flags);
+	ASSERT_EQ (nullptr, node->bootstrap_initiator.current_attempt ());
+	// Without peers the attempt keeps waiting for connections
+	node->bootstrap_initiator.bootstrap ();
+	auto attempt (node->bootstrap_initiator.current_attempt ());
+	ASSERT_NE (nullptr, attempt);
+	ASSERT_EQ (nano::bootstrap_mode::ascending, attempt->mode);
+}
+
 TEST (frontier_req_response, DISABLED_destruction)
 {
 	{
@@ -1185,6 +1295,43 @@ TEST (frontier_req, count)
 	ASSERT_EQ (send1->hash (), request->frontier);
 }
 
+TEST (frontier_req, refill_size)
+{
+	nano::system system;
+	nano::node_config config (nano::get_available_port (), system.logging);
+	config.bootstrap_frontier_refill_size = 1;
+	auto node1 = system.add_node (config);
+	nano::genesis genesis;
+	// Public key FB93... after genesis in accounts table
+	nano::keypair key1 ("ED5AE0A6505B14B67435C29FD9FEEBC26F597D147BC92F6D795FFAD7AFD3D967");
+	auto send1 (std::make_shared<nano::state_block> (nano::dev_genesis_key.pub, genesis.hash (), nano::dev_genesis_key.pub, nano::genesis_amount - nano::Gxrb_ratio, key1.pub, nano::dev_genesis_key.prv, nano::dev_genesis_key.pub, 0));
+	node1->work_generate_blocking (*send1);
+	ASSERT_EQ (nano::process_result::progress, node1->process (*send1).code);
+	auto receive1 (std::make_shared<nano::state_block> (key1.pub, 0, nano::dev_genesis_key.pub, nano::Gxrb_ratio, send1->hash (), key1.prv, key1.pub, 0));
+	node1->work_generate_blocking (*receive1);
+	ASSERT_EQ (nano::process_result::progress, node1->process (*receive1).code);
+
+	auto connection (std::make_shared<nano::bootstrap_server> (nullptr, node1));
+	auto req = std::make_unique<nano::frontier_req> ();
+	req->start.clear ();
+	req->age = std::numeric_limits<decltype (req->age)>::max ();
+	req->count = std::numeric_limits<decltype (req->count)>::max ();
+	connection->requests.push (std::unique_ptr<nano::message>{});
+	auto request (std::make_shared<nano::frontier_req_server> (connection, std::move (req)));
+	ASSERT_EQ (nano::dev_genesis_key.pub, request->current);
+	ASSERT_EQ (send1->hash (), request->frontier);
+	ASSERT_TRUE (request->accounts.empty ());
+	request->refill (request->current);
+	ASSERT_EQ (1, request->accounts.size ());
+	ASSERT_EQ (key1.pub, request->accounts.front ().first);
+	ASSERT_EQ (receive1->hash (), request->accounts.front ().second);
+	request->accounts.clear ();
+	// The end of the accounts table is marked by a zero account
+	request->refill (key1.pub);
+	ASSERT_EQ (1, request->accounts.size ());
+	ASSERT_TRUE (request->accounts.front ().first.is_zero ());
+}
+
 TEST (frontier_req, time_bound)
 {
 	nano::system system (1);
@@ -1233,6 +1380,332 @@ TEST (frontier_req, time_cutoff)
 	ASSERT_TRUE (request2->frontier.is_zero ());
 }
 
+namespace
+{
+std::shared_ptr<nano::frontier_req_client> frontier_req_client_create (std::shared_ptr<nano::node> const & node_a, std::shared_ptr<nano::bootstrap_attempt> const & attempt_a)
+{
+	auto socket (std::make_shared<nano::socket> (*node_a));
+	auto channel (std::make_shared<nano::transport::channel_tcp> (*node_a, socket));
+	auto connection (std::make_shared<nano::bootstrap_client> (node_a, node_a->bootstrap_initiator.connections, channel, socket));
+	// A finished request would otherwise pool the unconnected client
+	connection->pending_stop = true;
+	return std::make_shared<nano::frontier_req_client> (connection, attempt_a);
+}
+}
+
+namespace nano
+{
+TEST (frontier_req_client, compare_out_of_order)
+{
+	nano::system system (1);
+	auto node (system.nodes[0]);
+	nano::state_block_builder builder;
+	nano::block_hash previous (nano::genesis_hash);
+	nano::uint128_t balance (nano::genesis_amount);
+	for (auto i (0); i < 3; ++i)
+	{
+		nano::keypair key;
+		balance -= nano::Gxrb_ratio;
+		auto send = builder.make_block ()
+		            .account (nano::dev_genesis_key.pub)
+		            .previous (previous)
+		            .representative (nano::dev_genesis_key.pub)
+		            .balance (balance)
+		            .link (key.pub)
+		            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+		            .work (*system.work.generate (previous))
+		            .build ();
+		ASSERT_EQ (nano::process_result::progress, node->process (*send).code);
+		auto open = builder.make_block ()
+		            .account (key.pub)
+		            .previous (0)
+		            .representative (key.pub)
+		            .balance (nano::Gxrb_ratio)
+		            .link (send->hash ())
+		            .sign (key.prv, key.pub)
+		            .work (*system.work.generate (key.pub))
+		            .build ();
+		ASSERT_EQ (nano::process_result::progress, node->process (*open).code);
+		previous = send->hash ();
+	}
+	// Local accounts in ascending order
+	std::vector<std::pair<nano::account, nano::block_hash>> local;
+	{
+		auto transaction (node->store.tx_begin_read ());
+		for (auto i (node->store.accounts_begin (transaction)), n (node->store.accounts_end ()); i != n; ++i)
+		{
+			local.emplace_back (i->first, i->second.head);
+		}
+	}
+	ASSERT_EQ (4, local.size ());
+	auto attempt (std::make_shared<nano::bootstrap_attempt_legacy> (node, 0));
+	auto client (frontier_req_client_create (node, attempt));
+	auto future (client->promise.get_future ());
+	{
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		client->batches_sent = 3;
+		client->batches_in_flight = 3;
+		client->final_received = true;
+	}
+	auto compared = [&client]() {
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		return client->compared.size ();
+	};
+	// The peer does not know the second account, which falls between the first two batches, nor the last account which follows the final batch
+	client->compare (2, local[2].first, {}, true);
+	client->compare (1, local[0].first, { local[2] }, false);
+	ASSERT_TIMELY (5s, compared () == 2);
+	{
+		nano::lock_guard<nano::mutex> guard (attempt->mutex);
+		ASSERT_TRUE (attempt->bulk_push_targets.empty ());
+	}
+	ASSERT_NE (std::future_status::ready, future.wait_for (0s));
+	// Once the first batch is compared every batch is applied in sequence
+	nano::block_hash unknown (1);
+	client->compare (0, nano::account (0), { { local[0].first, unknown } }, false);
+	ASSERT_TIMELY (5s, future.wait_for (0s) == std::future_status::ready);
+	ASSERT_FALSE (future.get ());
+	ASSERT_EQ (0, compared ());
+	nano::lock_guard<nano::mutex> guard (attempt->mutex);
+	ASSERT_EQ (1, attempt->frontier_pulls.size ());
+	ASSERT_EQ (local[0].first, attempt->frontier_pulls.front ().account_or_head.as_account ());
+	ASSERT_EQ (unknown, attempt->frontier_pulls.front ().head);
+	std::vector<std::pair<nano::block_hash, nano::block_hash>> pushes{ { local[1].second, 0 }, { local[3].second, 0 } };
+	ASSERT_EQ (pushes, attempt->bulk_push_targets);
+}
+
+TEST (frontier_req_client, compare_push_budget)
+{
+	nano::system system (1);
+	auto node (system.nodes[0]);
+	nano::state_block_builder builder;
+	nano::block_hash previous (nano::genesis_hash);
+	nano::uint128_t balance (nano::genesis_amount);
+	for (auto i (0); i < 3; ++i)
+	{
+		nano::keypair key;
+		balance -= nano::Gxrb_ratio;
+		auto send = builder.make_block ()
+		            .account (nano::dev_genesis_key.pub)
+		            .previous (previous)
+		            .representative (nano::dev_genesis_key.pub)
+		            .balance (balance)
+		            .link (key.pub)
+		            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+		            .work (*system.work.generate (previous))
+		            .build ();
+		ASSERT_EQ (nano::process_result::progress, node->process (*send).code);
+		auto open = builder.make_block ()
+		            .account (key.pub)
+		            .previous (0)
+		            .representative (key.pub)
+		            .balance (nano::Gxrb_ratio)
+		            .link (send->hash ())
+		            .sign (key.prv, key.pub)
+		            .work (*system.work.generate (key.pub))
+		            .build ();
+		ASSERT_EQ (nano::process_result::progress, node->process (*open).code);
+		previous = send->hash ();
+	}
+	auto attempt (std::make_shared<nano::bootstrap_attempt_legacy> (node, 0));
+	auto client (frontier_req_client_create (node, attempt));
+	{
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		// Keeps the compared batches from being applied
+		client->batches_sent = 3;
+		client->batches_in_flight = 2;
+	}
+	auto compared = [&client](uint64_t sequence_a) -> boost::optional<size_t> {
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		auto existing (client->compared.find (sequence_a));
+		return existing != client->compared.end () ? boost::optional<size_t> (existing->second.size ()) : boost::none;
+	};
+	// Local accounts can't be pushed to a peer only sending recent frontiers
+	client->frontiers_age = 1;
+	client->compare (1, nano::account (0), {}, true);
+	ASSERT_TIMELY (5s, compared (1));
+	ASSERT_EQ (0, *compared (1));
+	// Nor beyond the bulk push cost limit
+	client->frontiers_age = std::numeric_limits<uint32_t>::max ();
+	{
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		client->bulk_push_cost = nano::bootstrap_limits::bulk_push_cost_limit - 2;
+	}
+	client->compare (2, nano::account (0), {}, true);
+	ASSERT_TIMELY (5s, compared (2));
+	ASSERT_EQ (1, *compared (2));
+}
+
+TEST (frontier_req_client, receive_pause)
+{
+	nano::system system (1);
+	auto node (system.nodes[0]);
+	auto attempt (std::make_shared<nano::bootstrap_attempt_legacy> (node, 0));
+	auto client (frontier_req_client_create (node, attempt));
+	auto future (client->promise.get_future ());
+	// Hold every worker so compared batches stay in flight
+	std::promise<void> release;
+	std::shared_future<void> released (release.get_future ());
+	std::atomic<unsigned> held{ 0 };
+	for (unsigned i (0); i < node->workers.get_num_threads (); ++i)
+	{
+		node->workers.push_task ([released, &held]() {
+			++held;
+			released.wait ();
+		});
+	}
+	ASSERT_TIMELY (5s, held == node->workers.get_num_threads ());
+	{
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		client->batches_in_flight = nano::frontier_req_client::max_batches_in_flight - 1;
+	}
+	auto & buffer (*client->connection->receive_buffer);
+	buffer.resize (nano::frontier_req_client::receive_buffer_size);
+	std::copy (nano::dev_genesis_key.pub.bytes.begin (), nano::dev_genesis_key.pub.bytes.end (), buffer.begin ());
+	std::copy (nano::genesis_hash.bytes.begin (), nano::genesis_hash.bytes.end (), buffer.begin () + sizeof (nano::account));
+	client->received_frontier (boost::system::error_code (), nano::frontier_req_client::size_frontier);
+	// Reading stops while the maximum number of batches is being compared
+	{
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		ASSERT_TRUE (client->receive_paused);
+		ASSERT_EQ (nano::frontier_req_client::max_batches_in_flight, client->batches_in_flight);
+		ASSERT_EQ (1, client->batches_sent);
+	}
+	ASSERT_NO_ERROR (system.poll ());
+	ASSERT_NE (std::future_status::ready, future.wait_for (0s));
+	release.set_value ();
+	auto resumed = [&client]() {
+		nano::lock_guard<nano::mutex> guard (client->mutex);
+		return !client->receive_paused && client->batches_applied == 1;
+	};
+	ASSERT_TIMELY (5s, resumed ());
+	// Reading resumed, the unconnected socket fails the request
+	ASSERT_TIMELY (5s, future.wait_for (0s) == std::future_status::ready);
+	ASSERT_TRUE (future.get ());
+}
+
+TEST (frontier_req_client, past_range_end)
+{
+	nano::system system (1);
+	auto node (system.nodes[0]);
+	auto attempt (std::make_shared<nano::bootstrap_attempt_legacy> (node, 0));
+	auto client (frontier_req_client_create (node, attempt));
+	auto future (client->promise.get_future ());
+	client->range_end = nano::dev_genesis_key.pub;
+	// The genesis frontier is followed by two frontiers past the end of the range
+	std::vector<std::pair<nano::account, nano::block_hash>> const frontiers{ { nano::dev_genesis_key.pub, nano::genesis_hash }, { nano::account (std::numeric_limits<nano::uint256_t>::max () - 1), nano::block_hash (1) }, { nano::account (std::numeric_limits<nano::uint256_t>::max ()), nano::block_hash (2) } };
+	auto & buffer (*client->connection->receive_buffer);
+	buffer.resize (nano::frontier_req_client::receive_buffer_size);
+	for (size_t i (0); i < frontiers.size (); ++i)
+	{
+		std::copy (frontiers[i].first.bytes.begin (), frontiers[i].first.bytes.end (), buffer.begin () + i * nano::frontier_req_client::size_frontier);
+		std::copy (frontiers[i].second.bytes.begin (), frontiers[i].second.bytes.end (), buffer.begin () + i * nano::frontier_req_client::size_frontier + sizeof (nano::account));
+	}
+	client->received_frontier (boost::system::error_code (), frontiers.size () * nano::frontier_req_client::size_frontier);
+	// The request finishes without reading on, which would fail on the unconnected socket
+	ASSERT_TIMELY (5s, future.wait_for (0s) == std::future_status::ready);
+	ASSERT_FALSE (future.get ());
+	ASSERT_TRUE (client->exhausted);
+	ASSERT_EQ (nano::dev_genesis_key.pub, client->last_received);
+	ASSERT_EQ (2, client->count);
+	nano::lock_guard<nano::mutex> guard (client->mutex);
+	ASSERT_EQ (1, client->batches_sent);
+	ASSERT_TRUE (client->final_received);
+}
+}
+
+TEST (bootstrap_peer_scores, speed)
+{
+	nano::bootstrap_peer_scores scores;
+	nano::tcp_endpoint fast (boost::asio::ip::address_v6::loopback (), 7001);
+	nano::tcp_endpoint slow (boost::asio::ip::address_v6::loopback (), 7002);
+	nano::tcp_endpoint unknown (boost::asio::ip::address_v6::loopback (), 7003);
+	ASSERT_EQ (1.0, scores.speed (fast));
+	scores.pull_finished (fast, 1000, std::chrono::seconds (1), std::chrono::milliseconds (10), false);
+	scores.pull_finished (slow, 10, std::chrono::seconds (1), std::chrono::milliseconds (100), false);
+	ASSERT_EQ (2, scores.size ());
+	ASSERT_GT (scores.speed (fast), 1.0);
+	ASSERT_EQ (nano::bootstrap_peer_scores::min_speed, scores.speed (slow));
+	ASSERT_EQ (1.0, scores.speed (unknown));
+	boost::property_tree::ptree information;
+	scores.get_information (information);
+	ASSERT_EQ (2, information.size ());
+	ASSERT_EQ ("1000", information.front ().second.get<std::string> ("blocks"));
+	ASSERT_EQ ("10", information.front ().second.get<std::string> ("latency_ms"));
+}
+
+TEST (bootstrap_peer_scores, failing)
+{
+	nano::bootstrap_peer_scores scores;
+	nano::tcp_endpoint endpoint (boost::asio::ip::address_v6::loopback (), 7001);
+	for (uint64_t i (0); i < nano::bootstrap_peer_scores::failing_threshold; ++i)
+	{
+		ASSERT_FALSE (scores.failing (endpoint));
+		scores.pull_finished (endpoint, 0, std::chrono::seconds (1), std::chrono::steady_clock::duration (0), true);
+	}
+	ASSERT_TRUE (scores.failing (endpoint));
+	// A successful pull clears the failure history
+	scores.pull_finished (endpoint, 1, std::chrono::seconds (1), std::chrono::milliseconds (1), false);
+	ASSERT_FALSE (scores.failing (endpoint));
+}
+
+TEST (bootstrap_peer_scores, failing_backoff)
+{
+	nano::bootstrap_peer_scores scores;
+	nano::tcp_endpoint endpoint (boost::asio::ip::address_v6::loopback (), 7001);
+	for (uint64_t i (0); i < nano::bootstrap_peer_scores::failing_threshold; ++i)
+	{
+		scores.pull_finished (endpoint, 0, std::chrono::seconds (1), std::chrono::steady_clock::duration (0), true);
+	}
+	auto now (std::chrono::steady_clock::now ());
+	ASSERT_TRUE (scores.failing (endpoint, now));
+	// The peer becomes eligible again once the backoff has passed since its last failure
+	ASSERT_FALSE (scores.failing (endpoint, now + nano::bootstrap_peer_scores::failing_backoff));
+	// Another failure excludes it again
+	scores.pull_finished (endpoint, 0, std::chrono::seconds (1), std::chrono::steady_clock::duration (0), true);
+	ASSERT_TRUE (scores.failing (endpoint));
+}
+
+TEST (bootstrap_connections, scaled_count)
+{
+	ASSERT_EQ (512, nano::bootstrap_connections::scaled_count (512, 1.0));
+	ASSERT_EQ (2048, nano::bootstrap_connections::scaled_count (512, nano::bootstrap_peer_scores::max_speed));
+	ASSERT_EQ (128, nano::bootstrap_connections::scaled_count (512, nano::bootstrap_peer_scores::min_speed));
+	ASSERT_EQ (1, nano::bootstrap_connections::scaled_count (2, nano::bootstrap_peer_scores::min_speed));
+	// A requeued pull is scaled from its base count again rather than from the count of its last request
+	nano::pull_info pull (nano::account (1), 1, 0, 0, 512);
+	for (auto i (0); i < 4; ++i)
+	{
+		pull.count = nano::bootstrap_connections::scaled_count (pull.base_count, nano::bootstrap_peer_scores::min_speed);
+	}
+	ASSERT_EQ (128, pull.count);
+	ASSERT_EQ (512, pull.base_count);
+}
+
+TEST (bootstrap_connections, select_pull)
+{
+	nano::system system (1);
+	nano::bootstrap_connections connections (*system.nodes[0]);
+	for (uint64_t processed : { 10, 0, 30, 20 })
+	{
+		nano::pull_info pull (nano::account (processed + 1), 1, 0, 0);
+		pull.processed = processed;
+		connections.pulls.push_back (pull);
+	}
+	// Fast peers take the longest known chain, slow peers the shortest
+	ASSERT_EQ (2, connections.select_pull (nano::bootstrap_peer_scores::max_speed));
+	ASSERT_EQ (1, connections.select_pull (nano::bootstrap_peer_scores::min_speed));
+	// Only the first pull_lookahead pulls are considered
+	while (connections.pulls.size () < nano::bootstrap_connections::pull_lookahead)
+	{
+		connections.pulls.push_back (nano::pull_info (nano::account (connections.pulls.size () + 100), 1, 0, 0));
+	}
+	nano::pull_info longest (nano::account (1000), 1, 0, 0);
+	longest.processed = 100;
+	connections.pulls.push_back (longest);
+	ASSERT_EQ (2, connections.select_pull (nano::bootstrap_peer_scores::max_speed));
+}
+
 TEST (bulk, genesis)
 {
 	nano::system system;
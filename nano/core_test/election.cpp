@@ -240,12 +240,110 @@ TEST (election, quorum_minimum_update_weight_before_quorum_checks)
 	ASSERT_FALSE (election.election->confirmed ());
 	{
 		nano::lock_guard<nano::mutex> guard (node1.online_reps.mutex);
-		// Modify online_m for online_reps to more than is available, this checks that voting below updates it to current online reps.
+		// Modify online_m for online_reps to more than is available, this checks that sampling corrects the running sum to current online reps.
 		node1.online_reps.online_m = node_config.online_weight_minimum.number () + 20;
 	}
+	node1.online_reps.sample ();
 	ASSERT_EQ (nano::vote_code::vote, node1.active.vote (vote2));
 	node1.block_processor.flush ();
 	ASSERT_NE (nullptr, node1.block (send1->hash ()));
 	ASSERT_TRUE (election.election->confirmed ());
 }
+
+TEST (election, tally_incremental)
+{
+	nano::system system;
+	nano::node_config node_config (nano::get_available_port (), system.logging);
+	node_config.frontiers_confirmation = nano::frontiers_confirmation_mode::disabled;
+	auto & node1 = *system.add_node (node_config);
+	nano::keypair key1;
+	nano::keypair key2;
+	nano::block_builder builder;
+	auto send1 = builder.state ()
+	             .account (nano::dev_genesis_key.pub)
+	             .previous (nano::genesis_hash)
+	             .representative (nano::dev_genesis_key.pub)
+	             .balance (nano::genesis_amount - 100)
+	             .link (key1.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (nano::genesis_hash))
+	             .build_shared ();
+	auto open1 = builder.state ()
+	             .account (key1.pub)
+	             .previous (0)
+	             .representative (key1.pub)
+	             .balance (100)
+	             .link (send1->hash ())
+	             .sign (key1.prv, key1.pub)
+	             .work (*system.work.generate (key1.pub))
+	             .build_shared ();
+	auto send2 = builder.state ()
+	             .account (nano::dev_genesis_key.pub)
+	             .previous (send1->hash ())
+	             .representative (nano::dev_genesis_key.pub)
+	             .balance (nano::genesis_amount - 200)
+	             .link (key2.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (send1->hash ()))
+	             .build_shared ();
+	auto send3 = builder.state ()
+	             .account (nano::dev_genesis_key.pub)
+	             .previous (send1->hash ())
+	             .representative (nano::dev_genesis_key.pub)
+	             .balance (nano::genesis_amount - 300)
+	             .link (key2.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (send1->hash ()))
+	             .build_shared ();
+	ASSERT_EQ (nano::process_result::progress, node1.process (*send1).code);
+	ASSERT_EQ (nano::process_result::progress, node1.process (*open1).code);
+	node1.process_active (send2);
+	node1.block_processor.flush ();
+	auto election (node1.active.election (send2->qualified_root ()));
+	ASSERT_NE (nullptr, election);
+	ASSERT_FALSE (election->publish (send3));
+	ASSERT_EQ (election->vote (key1.pub, 1, send2->hash ()).processed, true);
+	auto tally1 (election->tally ());
+	ASSERT_EQ (1, tally1.size ());
+	ASSERT_EQ (100, tally1.begin ()->first);
+	ASSERT_EQ (*send2, *tally1.begin ()->second);
+	// Replacing the vote moves its weight to the other block
+	{
+		nano::lock_guard<nano::mutex> guard (election->mutex);
+		election->last_votes[key1.pub].time = std::chrono::steady_clock::now () - std::chrono::seconds (20);
+	}
+	ASSERT_EQ (election->vote (key1.pub, 2, send3->hash ()).processed, true);
+	auto tally2 (election->tally ());
+	ASSERT_EQ (2, tally2.size ());
+	ASSERT_EQ (100, tally2.begin ()->first);
+	ASSERT_EQ (*send3, *tally2.begin ()->second);
+	ASSERT_EQ (0, tally2.rbegin ()->first);
+	// Weight changes of representatives are picked up when refreshing
+	auto send4 = builder.state ()
+	             .account (key1.pub)
+	             .previous (open1->hash ())
+	             .representative (key1.pub)
+	             .balance (50)
+	             .link (key2.pub)
+	             .sign (key1.prv, key1.pub)
+	             .work (*system.work.generate (open1->hash ()))
+	             .build_shared ();
+	ASSERT_EQ (nano::process_result::progress, node1.process (*send4).code);
+	// Refreshing is rate limited to once per base latency
+	{
+		nano::lock_guard<nano::mutex> guard (election->mutex);
+		election->last_tally_refresh = std::chrono::steady_clock::now ();
+	}
+	election->refresh_tally ();
+	ASSERT_EQ (100, election->tally ().begin ()->first);
+	{
+		nano::lock_guard<nano::mutex> guard (election->mutex);
+		election->last_tally_refresh -= election->base_latency ();
+	}
+	election->refresh_tally ();
+	auto tally3 (election->tally ());
+	ASSERT_EQ (50, tally3.begin ()->first);
+	ASSERT_EQ (*send3, *tally3.begin ()->second);
+	ASSERT_FALSE (election->confirmed ());
+}
 }
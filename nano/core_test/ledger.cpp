@@ -3,6 +3,7 @@
 #include <nano/node/election.hpp>
 #include <nano/node/rocksdb/rocksdb.hpp>
 #include <nano/node/testing.hpp>
+#include <nano/secure/ledger_snapshot.hpp>
 #include <nano/test_common/testutil.hpp>
 
 #include <gtest/gtest.h>
@@ -3816,6 +3817,159 @@ TEST (ledger, migrate_lmdb_to_rocksdb)
 	ASSERT_EQ (*unchecked_infos.front ().block, *send);
 }
 
+TEST (ledger, snapshot)
+{
+	nano::logger_mt logger;
+	nano::genesis genesis;
+	nano::stat stats;
+	nano::work_pool pool (std::numeric_limits<unsigned>::max ());
+	auto store = nano::make_store (logger, nano::unique_path ());
+	ASSERT_FALSE (store->init_error ());
+	nano::ledger ledger (*store, stats);
+	nano::keypair key1;
+	auto send1 = nano::state_block_builder ()
+	             .account (nano::dev_genesis_key.pub)
+	             .previous (nano::genesis_hash)
+	             .representative (nano::dev_genesis_key.pub)
+	             .link (key1.pub)
+	             .balance (nano::genesis_amount - 100)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*pool.generate (nano::genesis_hash))
+	             .build_shared ();
+	auto open = nano::state_block_builder ()
+	            .account (key1.pub)
+	            .previous (0)
+	            .representative (key1.pub)
+	            .link (send1->hash ())
+	            .balance (100)
+	            .sign (key1.prv, key1.pub)
+	            .work (*pool.generate (key1.pub))
+	            .build_shared ();
+	auto send2 = nano::state_block_builder ()
+	             .account (nano::dev_genesis_key.pub)
+	             .previous (send1->hash ())
+	             .representative (nano::dev_genesis_key.pub)
+	             .link (nano::account (10))
+	             .balance (nano::genesis_amount - 200)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*pool.generate (send1->hash ()))
+	             .build_shared ();
+	{
+		auto transaction (store->tx_begin_write ());
+		store->initialize (transaction, genesis, ledger.cache);
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *send1).code);
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *open).code);
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *send2).code);
+		store->confirmation_height_put (transaction, nano::genesis_account, { 2, send1->hash () });
+	}
+	auto file (nano::unique_path ());
+	nano::ledger_snapshot snapshot (ledger);
+	ASSERT_FALSE (snapshot.export_file (file));
+	ASSERT_LT (0, snapshot.records.load ());
+
+	auto store1 = nano::make_store (logger, nano::unique_path ());
+	ASSERT_FALSE (store1->init_error ());
+	nano::ledger ledger1 (*store1, stats, nano::generate_cache (), 1024 * 1024);
+	store1->initialize (store1->tx_begin_write (), genesis, ledger1.cache);
+	// Cache the genesis account as it is before the import
+	ASSERT_EQ (genesis.hash (), ledger1.latest (store1->tx_begin_read (), nano::genesis_account));
+	nano::ledger_snapshot snapshot1 (ledger1);
+	ASSERT_FALSE (snapshot1.import_file (file));
+	ASSERT_EQ (snapshot.records.load (), snapshot1.records.load ());
+	ASSERT_EQ (snapshot.bytes.load (), snapshot1.bytes.load ());
+	{
+		auto transaction (store1->tx_begin_read ());
+		ASSERT_EQ (4, store1->block_count (transaction));
+		auto block (store1->block_get (transaction, send2->hash ()));
+		ASSERT_NE (nullptr, block);
+		ASSERT_EQ (*send2, *block);
+		ASSERT_EQ (send2->sideband ().height, block->sideband ().height);
+		nano::account_info info1;
+		ASSERT_FALSE (store1->account_get (transaction, key1.pub, info1));
+		ASSERT_EQ (open->hash (), info1.head);
+		ASSERT_TRUE (store1->pending_exists (transaction, nano::pending_key (nano::account (10), send2->hash ())));
+		nano::confirmation_height_info confirmation_height_info;
+		ASSERT_FALSE (store1->confirmation_height_get (transaction, nano::genesis_account, confirmation_height_info));
+		ASSERT_EQ (2, confirmation_height_info.height);
+	}
+	ASSERT_EQ (send2->hash (), ledger1.latest (store1->tx_begin_read (), nano::genesis_account));
+	ASSERT_EQ (ledger.cache.block_count.load (), ledger1.cache.block_count.load ());
+	ASSERT_EQ (ledger.weight (key1.pub), ledger1.weight (key1.pub));
+	ASSERT_EQ (ledger.weight (nano::dev_genesis_key.pub), ledger1.weight (nano::dev_genesis_key.pub));
+
+	// Ledgers holding more than genesis are not imported in to
+	ASSERT_TRUE (nano::ledger_snapshot (ledger1).import_file (file));
+
+	// Flip the last payload byte before the final chunk
+	auto size (boost::filesystem::file_size (file));
+	{
+		std::fstream stream (file.string (), std::ios::in | std::ios::out | std::ios::binary);
+		auto position (static_cast<std::streamoff> (size - (sizeof (uint8_t) + 2 * sizeof (uint64_t) + sizeof (nano::uint256_union)) - 1));
+		stream.seekg (position);
+		auto byte (static_cast<char> (stream.get () ^ 1));
+		stream.seekp (position);
+		stream.put (byte);
+	}
+	auto store2 = nano::make_store (logger, nano::unique_path ());
+	ASSERT_FALSE (store2->init_error ());
+	nano::ledger ledger2 (*store2, stats);
+	store2->initialize (store2->tx_begin_write (), genesis, ledger2.cache);
+	ASSERT_TRUE (nano::ledger_snapshot (ledger2).import_file (file));
+}
+
+TEST (ledger, checkpoint)
+{
+	if (nano::using_rocksdb_in_tests ())
+	{
+		// RocksDB does not number its commits, checkpoints are not written
+		return;
+	}
+	nano::logger_mt logger;
+	nano::genesis genesis;
+	nano::stat stats;
+	nano::work_pool pool (std::numeric_limits<unsigned>::max ());
+	auto path (nano::unique_path ());
+	auto send = nano::state_block_builder ()
+	            .account (nano::dev_genesis_key.pub)
+	            .previous (nano::genesis_hash)
+	            .representative (nano::dev_genesis_key.pub)
+	            .link (nano::account (10))
+	            .balance (nano::genesis_amount - 100)
+	            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	            .work (*pool.generate (nano::genesis_hash))
+	            .build_shared ();
+	{
+		auto store = nano::make_store (logger, path);
+		ASSERT_FALSE (store->init_error ());
+		nano::ledger ledger (*store, stats);
+		store->initialize (store->tx_begin_write (), genesis, ledger.cache);
+		ASSERT_EQ (nano::process_result::progress, ledger.process (store->tx_begin_write (), *send).code);
+		ledger.checkpoint_write ();
+	}
+	{
+		auto store = nano::make_store (logger, path);
+		ASSERT_FALSE (store->init_error ());
+		nano::ledger ledger (*store, stats);
+		ASSERT_EQ (1, ledger.initialize_timings.size ());
+		ASSERT_EQ ("loaded from checkpoint", ledger.initialize_timings.front ().first);
+		ASSERT_EQ (2, ledger.cache.block_count);
+		ASSERT_EQ (1, ledger.cache.account_count);
+		ASSERT_EQ (1, ledger.cache.cemented_count);
+		ASSERT_EQ (nano::genesis_amount - 100, ledger.weight (nano::dev_genesis_key.pub));
+		// Any later commit invalidates the checkpoint
+		store->confirmation_height_put (store->tx_begin_write (), nano::genesis_account, { 2, send->hash () });
+	}
+	{
+		auto store = nano::make_store (logger, path);
+		ASSERT_FALSE (store->init_error ());
+		nano::ledger ledger (*store, stats);
+		ASSERT_EQ ("accounts walk", ledger.initialize_timings.front ().first);
+		ASSERT_EQ (2, ledger.cache.block_count);
+		ASSERT_EQ (2, ledger.cache.cemented_count);
+		ASSERT_EQ (nano::genesis_amount - 100, ledger.weight (nano::dev_genesis_key.pub));
+	}
+}
+
 TEST (ledger, unconfirmed_frontiers)
 {
 	nano::logger_mt logger;
@@ -3854,3 +4008,54 @@ TEST (ledger, unconfirmed_frontiers)
 	ASSERT_EQ (uncemented_info1.cemented_frontier, uncemented_info2.cemented_frontier);
 	ASSERT_EQ (uncemented_info1.frontier, uncemented_info2.frontier);
 }
+
+TEST (ledger, account_info_cache)
+{
+	if (nano::using_rocksdb_in_tests ())
+	{
+		// The cache needs snapshot ids which RocksDB does not provide
+		return;
+	}
+	nano::logger_mt logger;
+	auto store = nano::make_store (logger, nano::unique_path ());
+	ASSERT_TRUE (!store->init_error ());
+	nano::stat stats;
+	nano::ledger ledger (*store, stats, nano::generate_cache (), 1024 * 1024);
+	ASSERT_GT (ledger.account_info_cache.capacity (), 0);
+	nano::genesis genesis;
+	store->initialize (store->tx_begin_write (), genesis, ledger.cache);
+	nano::work_pool pool (std::numeric_limits<unsigned>::max ());
+	ASSERT_EQ (genesis.hash (), ledger.latest (store->tx_begin_read (), nano::genesis_account));
+	ASSERT_EQ (1, stats.count (nano::stat::type::account_info_cache, nano::stat::detail::cache_miss));
+	ASSERT_EQ (genesis.hash (), ledger.latest (store->tx_begin_read (), nano::genesis_account));
+	ASSERT_EQ (1, stats.count (nano::stat::type::account_info_cache, nano::stat::detail::cache_hit));
+	nano::state_block_builder builder;
+	nano::keypair key;
+	auto send = builder.make_block ()
+	            .account (nano::genesis_account)
+	            .previous (genesis.hash ())
+	            .representative (nano::genesis_account)
+	            .balance (nano::genesis_amount - 100)
+	            .link (key.pub)
+	            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	            .work (*pool.generate (genesis.hash ()))
+	            .build ();
+	// A read transaction started before the write must keep seeing its snapshot
+	auto old_transaction (store->tx_begin_read ());
+	{
+		auto transaction (store->tx_begin_write ());
+		ASSERT_EQ (nano::process_result::progress, ledger.process (transaction, *send).code);
+		ASSERT_EQ (send->hash (), ledger.latest (transaction, nano::genesis_account));
+		ASSERT_EQ (genesis.hash (), ledger.latest (old_transaction, nano::genesis_account));
+	}
+	ASSERT_EQ (genesis.hash (), ledger.latest (old_transaction, nano::genesis_account));
+	old_transaction.reset ();
+	ASSERT_EQ (send->hash (), ledger.latest (store->tx_begin_read (), nano::genesis_account));
+	ASSERT_EQ (nano::genesis_amount - 100, ledger.account_balance (store->tx_begin_read (), nano::genesis_account));
+	// Rolling back updates the cached entry
+	ASSERT_FALSE (ledger.rollback (store->tx_begin_write (), send->hash ()));
+	ASSERT_EQ (genesis.hash (), ledger.latest (store->tx_begin_read (), nano::genesis_account));
+	ASSERT_EQ (nano::genesis_amount, ledger.account_balance (store->tx_begin_read (), nano::genesis_account));
+	nano::account_info info;
+	ASSERT_TRUE (ledger.account_get (store->tx_begin_read (), key.pub, info));
+}
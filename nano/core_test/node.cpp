@@ -29,6 +29,21 @@ TEST (node, stop)
 	ASSERT_TRUE (true);
 }
 
+TEST (node, startup_profile)
+{
+	nano::system system (1);
+	auto & node (*system.nodes[0]);
+	ASSERT_TRUE (node.startup_profile.completed ());
+	auto entries (node.startup_profile.entries ());
+	auto ledger_phase (std::find_if (entries.begin (), entries.end (), [](nano::startup_profile::entry const & entry_a) { return entry_a.name == "ledger initialize"; }));
+	ASSERT_NE (entries.end (), ledger_phase);
+	ASSERT_EQ (node.ledger.initialize_timings.size (), ledger_phase->steps.size ());
+	ASSERT_NE (entries.end (), std::find_if (entries.begin (), entries.end (), [](nano::startup_profile::entry const & entry_a) { return entry_a.name == "network start"; }));
+	// Phases after the node has started are not part of the profile
+	node.startup_profile.measure ("after start", [] {});
+	ASSERT_EQ (entries.size (), node.startup_profile.entries ().size ());
+}
+
 TEST (node, work_generate)
 {
 	nano::system system (1);
@@ -2436,6 +2451,42 @@ TEST (node, stat_counting)
 	ASSERT_EQ (10, node1.stats.count (nano::stat::type::ledger, nano::stat::dir::in));
 }
 
+// Counters are sharded per thread, counts and observers must see updates from all threads
+TEST (node, stat_counting_concurrent)
+{
+	nano::stat stats;
+	std::atomic<uint64_t> observed{ 0 };
+	stats.observe_count (nano::stat::type::ledger, nano::stat::detail::receive, nano::stat::dir::in, [&observed](uint64_t old_a, uint64_t new_a) {
+		ASSERT_LT (old_a, new_a);
+		++observed;
+	});
+	std::vector<std::thread> threads;
+	for (auto i (0); i < 16; ++i)
+	{
+		threads.emplace_back ([&stats]() {
+			for (auto j (0); j < 1000; ++j)
+			{
+				stats.inc (nano::stat::type::ledger, nano::stat::detail::send, nano::stat::dir::in);
+				stats.inc (nano::stat::type::ledger, nano::stat::detail::receive, nano::stat::dir::in);
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+	ASSERT_EQ (32000, stats.count (nano::stat::type::ledger, nano::stat::dir::in));
+	ASSERT_EQ (16000, stats.count (nano::stat::type::ledger, nano::stat::detail::send, nano::stat::dir::in));
+	ASSERT_EQ (16000, stats.count (nano::stat::type::ledger, nano::stat::detail::receive, nano::stat::dir::in));
+	ASSERT_EQ (16000, observed);
+	auto sink (stats.log_sink_json ());
+	stats.log_counters (*sink);
+	auto entries (static_cast<boost::property_tree::ptree *> (sink->to_object ())->get_child ("entries"));
+	ASSERT_EQ (3, entries.size ());
+	stats.clear ();
+	ASSERT_EQ (0, stats.count (nano::stat::type::ledger, nano::stat::dir::in));
+}
+
 TEST (node, stat_histogram)
 {
 	nano::system system (1);
@@ -2488,6 +2539,37 @@ TEST (node, online_reps)
 	ASSERT_EQ (node1.config.online_weight_minimum, node1.online_reps.trended ());
 }
 
+TEST (node, online_reps_weight_change)
+{
+	nano::system system (1);
+	auto & node1 (*system.nodes[0]);
+	nano::keypair key;
+	node1.online_reps.observe (nano::dev_genesis_key.pub);
+	ASSERT_EQ (nano::genesis_amount, node1.online_reps.online ());
+	auto quorum = [](nano::uint128_t const & weight_a) {
+		return ((nano::uint256_t (weight_a) * nano::online_reps::online_weight_quorum) / 100).convert_to<nano::uint128_t> ();
+	};
+	ASSERT_EQ (quorum (nano::genesis_amount), node1.online_reps.delta ());
+	auto send1 = nano::state_block_builder ()
+	             .account (nano::dev_genesis_key.pub)
+	             .previous (nano::genesis_hash)
+	             .representative (nano::dev_genesis_key.pub)
+	             .balance (nano::genesis_amount - nano::Gxrb_ratio)
+	             .link (key.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (nano::genesis_hash))
+	             .build_shared ();
+	ASSERT_EQ (nano::process_result::progress, node1.process (*send1).code);
+	// The running sum picks up the new weight when the representative is observed again
+	ASSERT_EQ (nano::genesis_amount, node1.online_reps.online ());
+	node1.online_reps.observe (nano::dev_genesis_key.pub);
+	ASSERT_EQ (nano::genesis_amount - nano::Gxrb_ratio, node1.online_reps.online ());
+	ASSERT_EQ (quorum (nano::genesis_amount - nano::Gxrb_ratio), node1.online_reps.delta ());
+	node1.online_reps.clear ();
+	ASSERT_EQ (0, node1.online_reps.online ());
+	ASSERT_EQ (quorum (node1.online_reps.trended ()), node1.online_reps.delta ());
+}
+
 namespace nano
 {
 TEST (node, online_reps_rep_crawler)
@@ -3734,6 +3816,40 @@ TEST (node, unchecked_cleanup)
 	}
 }
 
+TEST (node, unchecked_memory_limit)
+{
+	nano::system system;
+	nano::node_config node_config (nano::get_available_port (), system.logging);
+	node_config.unchecked_memory_limit = 2;
+	nano::node_flags node_flags;
+	node_flags.disable_unchecked_cleanup = true;
+	auto & node (*system.add_node (node_config, node_flags));
+	ASSERT_TRUE (node.unchecked.memory ());
+	nano::keypair key;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (auto i (0); i < 3; ++i)
+	{
+		blocks.push_back (std::make_shared<nano::send_block> (i + 1, key.pub, 0, key.prv, key.pub, 0));
+	}
+	{
+		auto transaction (node.store.tx_begin_write ());
+		for (auto i (0); i < 3; ++i)
+		{
+			node.unchecked.put (transaction, nano::unchecked_key (blocks[i]->previous (), blocks[i]->hash ()), nano::unchecked_info (blocks[i], 0, 100 + i));
+		}
+		// Oldest entry is dropped once the limit is reached, nothing is written to the ledger
+		ASSERT_EQ (2, node.unchecked.count (transaction));
+		ASSERT_EQ (0, node.store.unchecked_count (transaction));
+		ASSERT_TRUE (node.unchecked.get (transaction, blocks[0]->previous ()).empty ());
+		ASSERT_EQ (1, node.unchecked.get (transaction, blocks[1]->previous ()).size ());
+		std::vector<nano::unchecked_info> expired;
+		ASSERT_EQ (1, node.unchecked.expire (transaction, 102, 16, expired));
+		ASSERT_EQ (1, expired.size ());
+		ASSERT_EQ (*blocks[1], *expired[0].block);
+		ASSERT_EQ (1, node.unchecked.count (transaction));
+	}
+}
+
 /** This checks that a node can be opened (without being blocked) when a write lock is held elsewhere */
 TEST (node, dont_write_lock_node)
 {
@@ -4639,6 +4755,35 @@ TEST (rep_crawler, local)
 	node.rep_crawler.validate ();
 	ASSERT_EQ (0, node.rep_crawler.representative_count ());
 }
+
+TEST (rep_crawler, principal_snapshot)
+{
+	nano::system system;
+	nano::node_flags flags;
+	flags.disable_rep_crawler = true;
+	auto & node = *system.add_node (flags);
+	auto snapshot1 (node.rep_crawler.principal_representatives_snapshot ());
+	ASSERT_NE (nullptr, snapshot1);
+	ASSERT_TRUE (snapshot1->representatives.empty ());
+	auto channel (std::make_shared<nano::transport::channel_loopback> (node));
+	{
+		nano::lock_guard<nano::mutex> guard (node.rep_crawler.probable_reps_mutex);
+		node.rep_crawler.probable_reps.emplace (nano::dev_genesis_key.pub, nano::genesis_amount, channel);
+	}
+	// Published snapshots are immutable, changes are only visible in the next one
+	ASSERT_EQ (snapshot1, node.rep_crawler.principal_representatives_snapshot ());
+	node.rep_crawler.update_principals ();
+	auto snapshot2 (node.rep_crawler.principal_representatives_snapshot ());
+	ASSERT_TRUE (snapshot1->representatives.empty ());
+	ASSERT_GT (snapshot2->version, snapshot1->version);
+	ASSERT_EQ (1, snapshot2->representatives.size ());
+	ASSERT_EQ (nano::dev_genesis_key.pub, snapshot2->representatives.front ().account);
+	// Weights are refreshed from the ledger, which also publishes a new snapshot
+	node.rep_crawler.update_weights ();
+	auto snapshot3 (node.rep_crawler.principal_representatives_snapshot ());
+	ASSERT_GT (snapshot3->version, snapshot2->version);
+	ASSERT_EQ (1, snapshot3->representatives.size ());
+}
 }
 
 TEST (node, pruning_automatic)
@@ -4809,6 +4954,65 @@ TEST (node, pruning_depth)
 	ASSERT_TRUE (node1.ledger.block_exists (send2->hash ()));
 }
 
+TEST (node, pruning_resume)
+{
+	nano::system system;
+	nano::node_config node_config (nano::get_available_port (), system.logging);
+	node_config.enable_voting = false; // Remove after allowing pruned voting
+	nano::node_flags node_flags;
+	node_flags.enable_pruning = true;
+	auto & node1 = *system.add_node (node_config, node_flags);
+	nano::genesis genesis;
+	nano::keypair key1;
+	auto send1 = nano::send_block_builder ()
+	             .previous (genesis.hash ())
+	             .destination (key1.pub)
+	             .balance (nano::genesis_amount - nano::Gxrb_ratio)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (genesis.hash ()))
+	             .build_shared ();
+	auto send2 = nano::send_block_builder ()
+	             .previous (send1->hash ())
+	             .destination (key1.pub)
+	             .balance (0)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (send1->hash ()))
+	             .build_shared ();
+	// Process as local blocks
+	node1.process_active (send1);
+	node1.process_active (send2);
+	node1.block_processor.flush ();
+	// Confirm last block to prune previous
+	{
+		auto election = node1.active.election (send1->qualified_root ());
+		ASSERT_NE (nullptr, election);
+		election->force_confirm ();
+	}
+	ASSERT_TIMELY (2s, node1.block_confirmed (send1->hash ()) && node1.active.active (send2->qualified_root ()));
+	ASSERT_EQ (0, node1.ledger.cache.pruned_count);
+	{
+		auto election = node1.active.election (send2->qualified_root ());
+		ASSERT_NE (nullptr, election);
+		election->force_confirm ();
+	}
+	ASSERT_TIMELY (2s, node1.active.empty () && node1.block_confirmed (send2->hash ()));
+	node1.config.max_pruning_age = std::chrono::seconds (0);
+	// Resuming an interrupted pass from an account past the genesis account finds nothing and starts over next time
+	{
+		auto transaction (node1.store.tx_begin_write ());
+		node1.store.pruning_progress_put (transaction, nano::dev_genesis_key.pub.number () + 1);
+	}
+	node1.ledger_pruning (1, true, false);
+	ASSERT_EQ (0, node1.ledger.cache.pruned_count);
+	ASSERT_TRUE (node1.store.pruning_progress_get (node1.store.tx_begin_read ()).is_zero ());
+	node1.ledger_pruning (1, true, false);
+	ASSERT_EQ (1, node1.ledger.cache.pruned_count);
+	ASSERT_TRUE (node1.store.pruning_progress_get (node1.store.tx_begin_read ()).is_zero ());
+	ASSERT_FALSE (node1.ledger.block_exists (send1->hash ()));
+	ASSERT_TRUE (node1.ledger.block_or_pruned_exists (send1->hash ()));
+	ASSERT_EQ (1, node1.stats.count (nano::stat::type::pruning, nano::stat::detail::blocks_pruned, nano::stat::dir::out));
+}
+
 namespace
 {
 void add_required_children_node_config_tree (nano::jsonconfig & tree)
@@ -199,3 +199,82 @@ TEST (signature_checker, boundary_checks)
 		last_size = size;
 	}
 }
+
+TEST (signature_cache, basic)
+{
+	nano::signature_cache cache (64);
+	ASSERT_EQ (64, cache.capacity ());
+	nano::keypair key;
+	nano::block_hash hash (1);
+	auto signature (nano::sign_message (key.prv, key.pub, hash));
+	ASSERT_FALSE (cache.exists (hash, key.pub, signature));
+	cache.insert (hash, key.pub, signature);
+	ASSERT_TRUE (cache.exists (hash, key.pub, signature));
+	// Every part of the tuple must match
+	auto other_signature (signature);
+	other_signature.bytes[63] ^= 1;
+	ASSERT_FALSE (cache.exists (hash, key.pub, other_signature));
+	ASSERT_FALSE (cache.exists (hash.number () + 1, key.pub, signature));
+	ASSERT_FALSE (cache.exists (hash, nano::keypair ().pub, signature));
+	ASSERT_EQ (1, cache.size ());
+}
+
+TEST (signature_cache, bounded)
+{
+	nano::signature_cache cache (nano::signature_cache::shard_count);
+	nano::keypair key;
+	std::vector<std::pair<nano::block_hash, nano::signature>> entries;
+	for (auto i (1); i <= 100; ++i)
+	{
+		nano::block_hash hash (i);
+		entries.emplace_back (hash, nano::sign_message (key.prv, key.pub, hash));
+		cache.insert (hash, key.pub, entries.back ().second);
+	}
+	auto existing (std::count_if (entries.begin (), entries.end (), [&cache, &key](auto const & entry_a) { return cache.exists (entry_a.first, key.pub, entry_a.second); }));
+	ASSERT_GT (existing, 0);
+	ASSERT_LE (existing, nano::signature_cache::shard_count);
+}
+
+TEST (signature_cache, verify)
+{
+	nano::signature_cache cache (64);
+	nano::signature_checker checker (0);
+	nano::keypair key;
+	std::vector<nano::block_hash> hashes{ 1, 2, 3 };
+	std::vector<nano::signature> signatures_l;
+	for (auto const & hash : hashes)
+	{
+		signatures_l.push_back (nano::sign_message (key.prv, key.pub, hash));
+	}
+	signatures_l[2].bytes[63] ^= 1;
+	cache.insert (hashes[0], key.pub, signatures_l[0]);
+	std::vector<unsigned char const *> messages;
+	std::vector<size_t> lengths (hashes.size (), sizeof (nano::block_hash));
+	std::vector<unsigned char const *> pub_keys (hashes.size (), key.pub.bytes.data ());
+	std::vector<unsigned char const *> signatures;
+	for (size_t i (0); i < hashes.size (); ++i)
+	{
+		messages.push_back (hashes[i].bytes.data ());
+		signatures.push_back (signatures_l[i].bytes.data ());
+	}
+	std::vector<int> verifications (hashes.size (), -1);
+	nano::signature_check_set check = { hashes.size (), messages.data (), lengths.data (), pub_keys.data (), signatures.data (), verifications.data () };
+	ASSERT_EQ (1, cache.verify (checker, check));
+	ASSERT_EQ ((std::vector<int>{ 1, 1, 0 }), verifications);
+	// The valid miss was inserted, the invalid signature was not
+	ASSERT_EQ (2, cache.size ());
+	std::fill (verifications.begin (), verifications.end (), -1);
+	ASSERT_EQ (2, cache.verify (checker, check));
+	ASSERT_EQ ((std::vector<int>{ 1, 1, 0 }), verifications);
+}
+
+TEST (signature_cache, disabled)
+{
+	nano::signature_cache cache (0);
+	ASSERT_EQ (0, cache.capacity ());
+	nano::keypair key;
+	nano::block_hash hash (1);
+	auto signature (nano::sign_message (key.prv, key.pub, hash));
+	cache.insert (hash, key.pub, signature);
+	ASSERT_FALSE (cache.exists (hash, key.pub, signature));
+}
@@ -187,6 +187,15 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.work_threads, defaults.node.work_threads);
 	ASSERT_EQ (conf.node.max_queued_requests, defaults.node.max_queued_requests);
 	ASSERT_EQ (conf.node.confirm_req_batches_max, defaults.node.confirm_req_batches_max);
+	ASSERT_EQ (conf.node.wallet_action_threads, defaults.node.wallet_action_threads);
+	ASSERT_EQ (conf.node.kdf_threads, defaults.node.kdf_threads);
+	ASSERT_EQ (conf.node.unchecked_memory_limit, defaults.node.unchecked_memory_limit);
+	ASSERT_EQ (conf.node.vote_generator_threads, defaults.node.vote_generator_threads);
+	ASSERT_EQ (conf.node.signature_cache_size, defaults.node.signature_cache_size);
+	ASSERT_EQ (conf.node.account_info_cache_size, defaults.node.account_info_cache_size);
+	ASSERT_EQ (conf.node.bootstrap_frontier_refill_size, defaults.node.bootstrap_frontier_refill_size);
+	ASSERT_EQ (conf.node.lazy_bootstrap_memory_limit, defaults.node.lazy_bootstrap_memory_limit);
+	ASSERT_EQ (conf.node.bootstrap_ascending, defaults.node.bootstrap_ascending);
 
 	ASSERT_EQ (conf.node.logging.bulk_pull_logging_value, defaults.node.logging.bulk_pull_logging_value);
 	ASSERT_EQ (conf.node.logging.flush, defaults.node.logging.flush);
@@ -424,6 +433,15 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	work_watcher_period = 999
 	max_work_generate_multiplier = 1.0
 	max_queued_requests = 999
+	wallet_action_threads = 999
+	kdf_threads = 999
+	unchecked_memory_limit = 999
+	vote_generator_threads = 999
+	signature_cache_size = 999
+	account_info_cache_size = 999
+	bootstrap_frontier_refill_size = 999
+	lazy_bootstrap_memory_limit = 999
+	bootstrap_ascending = true
 	frontiers_confirmation = "always"
 	[node.diagnostics.txn_tracking]
 	enable = true
@@ -591,6 +609,15 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.work_threads, defaults.node.work_threads);
 	ASSERT_NE (conf.node.max_queued_requests, defaults.node.max_queued_requests);
 	ASSERT_EQ (conf.node.confirm_req_batches_max, defaults.node.confirm_req_batches_max);
+	ASSERT_NE (conf.node.wallet_action_threads, defaults.node.wallet_action_threads);
+	ASSERT_NE (conf.node.kdf_threads, defaults.node.kdf_threads);
+	ASSERT_NE (conf.node.unchecked_memory_limit, defaults.node.unchecked_memory_limit);
+	ASSERT_NE (conf.node.vote_generator_threads, defaults.node.vote_generator_threads);
+	ASSERT_NE (conf.node.signature_cache_size, defaults.node.signature_cache_size);
+	ASSERT_NE (conf.node.account_info_cache_size, defaults.node.account_info_cache_size);
+	ASSERT_NE (conf.node.bootstrap_frontier_refill_size, defaults.node.bootstrap_frontier_refill_size);
+	ASSERT_NE (conf.node.lazy_bootstrap_memory_limit, defaults.node.lazy_bootstrap_memory_limit);
+	ASSERT_NE (conf.node.bootstrap_ascending, defaults.node.bootstrap_ascending);
 
 	ASSERT_NE (conf.node.logging.bulk_pull_logging_value, defaults.node.logging.bulk_pull_logging_value);
 	ASSERT_NE (conf.node.logging.flush, defaults.node.logging.flush);
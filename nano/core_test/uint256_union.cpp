@@ -426,6 +426,65 @@ TEST (uint256_union, account_encode_lex)
 	}
 }
 
+TEST (uint256_union, account_encode_buffer)
+{
+	nano::keypair key;
+	char buffer[nano::public_key::account_encoded_size];
+	key.pub.encode_account (buffer);
+	std::string text (buffer, sizeof (buffer));
+	ASSERT_EQ (key.pub.to_account (), text);
+	nano::account output;
+	ASSERT_FALSE (output.decode_account (buffer, sizeof (buffer)));
+	ASSERT_EQ (key.pub, output);
+	// Checksum mismatch
+	text[sizeof (buffer) - 1] = text[sizeof (buffer) - 1] == '1' ? '3' : '1';
+	ASSERT_TRUE (output.decode_account (text));
+	// Node ids may omit leading zero characters
+	auto node_id (nano::account (1).to_node_id ());
+	ASSERT_EQ ('1', node_id[5]);
+	ASSERT_FALSE (output.decode_node_id (node_id.substr (0, 5) + node_id.substr (6)));
+	ASSERT_EQ (nano::account (1), output);
+}
+
+TEST (uint256_union, encode_buffer)
+{
+	nano::uint256_union max ("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+	char hex[64];
+	max.encode_hex (hex);
+	ASSERT_EQ (std::string (64, 'F'), std::string (hex, sizeof (hex)));
+	char dec[78];
+	ASSERT_EQ (78, max.encode_dec (dec));
+	ASSERT_EQ ("115792089237316195423570985008687907853269984665640564039457584007913129639935", std::string (dec, 78));
+	ASSERT_EQ (1, nano::uint256_union (0).encode_dec (dec));
+	ASSERT_EQ ('0', dec[0]);
+	ASSERT_EQ ("1000000000", nano::uint128_union (1000000000).to_string_dec ());
+	ASSERT_EQ ("340282366920938463463374607431768211455", nano::uint128_union (std::numeric_limits<nano::uint128_t>::max ()).to_string_dec ());
+	ASSERT_EQ ("0000000000000000000000000000ABCD", nano::uint128_union (0xabcd).to_string ());
+	nano::uint512_union signature (max, nano::uint256_union (0x12));
+	char hex512[128];
+	signature.encode_hex (hex512);
+	ASSERT_EQ (std::string (64, 'F') + std::string (62, '0') + "12", std::string (hex512, sizeof (hex512)));
+}
+
+TEST (uint256_union, codec_round_trip)
+{
+	nano::keypair key;
+	nano::account account (key.pub);
+	char buffer[nano::public_key::account_encoded_size];
+	for (uint64_t i (0); i < 1000; ++i)
+	{
+		account.qwords[0] = i * 0x9e3779b97f4a7c15ULL;
+		account.encode_account (buffer);
+		nano::account output;
+		ASSERT_FALSE (output.decode_account (buffer, sizeof (buffer)));
+		ASSERT_EQ (account, output);
+		char hex[64];
+		account.encode_hex (hex);
+		ASSERT_FALSE (output.decode_hex (std::string (hex, sizeof (hex))));
+		ASSERT_EQ (account, output);
+	}
+}
+
 TEST (uint256_union, bounds)
 {
 	nano::account key;
@@ -1,7 +1,9 @@
+#include <nano/lib/compact_hash_set.hpp>
 #include <nano/lib/optional_ptr.hpp>
 #include <nano/lib/rate_limiting.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/lib/timer.hpp>
+#include <nano/lib/timing_wheel.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/secure/utility.hpp>
 
@@ -91,6 +93,80 @@ TEST (optional_ptr, basic)
 	ASSERT_EQ (opt->z, 3);
 }
 
+TEST (timing_wheel, basic)
+{
+	auto const start (std::chrono::steady_clock::now ());
+	nano::timing_wheel<int> wheel (10ms, start);
+	ASSERT_TRUE (wheel.empty ());
+	wheel.insert (start + 25ms, 2);
+	wheel.insert (start + 5ms, 1);
+	wheel.insert (start - 1s, 0);
+	ASSERT_EQ (3, wheel.size ());
+	std::vector<int> expired;
+	// Deadlines are rounded up to the resolution, already passed deadlines fire on the next tick
+	wheel.advance (start + 9ms, expired);
+	ASSERT_TRUE (expired.empty ());
+	wheel.advance (start + 10ms, expired);
+	ASSERT_EQ ((std::vector<int>{ 1, 0 }), expired);
+	expired.clear ();
+	wheel.advance (start + 29ms, expired);
+	ASSERT_TRUE (expired.empty ());
+	wheel.advance (start + 30ms, expired);
+	ASSERT_EQ (std::vector<int>{ 2 }, expired);
+	ASSERT_TRUE (wheel.empty ());
+}
+
+TEST (timing_wheel, cascade)
+{
+	auto const start (std::chrono::steady_clock::now ());
+	nano::timing_wheel<int> wheel (1ms, start);
+	// One deadline per level, deadlines past the span of the top level are covered by slow_test
+	std::vector<std::chrono::milliseconds> const delays{ 3ms, 100ms, 5s, 10min };
+	for (auto i (0); i < delays.size (); ++i)
+	{
+		wheel.insert (start + delays[i], i);
+	}
+	for (auto i (0); i < delays.size (); ++i)
+	{
+		std::vector<int> expired;
+		wheel.advance (start + delays[i] - 1ms, expired);
+		ASSERT_TRUE (expired.empty ());
+		wheel.advance (start + delays[i], expired);
+		ASSERT_EQ (std::vector<int>{ i }, expired);
+		ASSERT_EQ (delays.size () - i - 1, wheel.size ());
+	}
+}
+
+TEST (compact_hash_set, basic)
+{
+	nano::compact_hash_set set;
+	ASSERT_TRUE (set.empty ());
+	ASSERT_TRUE (set.insert (0));
+	ASSERT_FALSE (set.insert (0));
+	ASSERT_TRUE (set.contains (0));
+	// Enough entries to grow the table several times
+	for (uint64_t i (1); i < 1000; ++i)
+	{
+		ASSERT_TRUE (set.insert (i * 0x9e3779b97f4a7c15ULL));
+	}
+	ASSERT_EQ (1000, set.size ());
+	ASSERT_GE (set.memory (), set.size () * sizeof (uint64_t));
+	for (uint64_t i (1); i < 1000; i += 2)
+	{
+		ASSERT_TRUE (set.erase (i * 0x9e3779b97f4a7c15ULL));
+	}
+	ASSERT_FALSE (set.erase (0x9e3779b97f4a7c15ULL));
+	ASSERT_EQ (500, set.size ());
+	// Entries probed past erased slots are still found after the backward shift
+	for (uint64_t i (1); i < 1000; ++i)
+	{
+		ASSERT_EQ (i % 2 == 0, set.contains (i * 0x9e3779b97f4a7c15ULL));
+	}
+	set.clear ();
+	ASSERT_TRUE (set.empty ());
+	ASSERT_FALSE (set.contains (0));
+}
+
 TEST (thread, thread_pool)
 {
 	std::atomic<bool> passed_sleep{ false };
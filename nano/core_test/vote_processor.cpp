@@ -89,6 +89,34 @@ TEST (vote_processor, invalid_signature)
 	ASSERT_EQ (2, election.election->votes ().size ());
 }
 
+TEST (vote_processor, signature_cache)
+{
+	nano::system system (1);
+	auto & node (*system.nodes[0]);
+	nano::genesis genesis;
+	nano::keypair key;
+	auto vote (std::make_shared<nano::vote> (key.pub, key.prv, 1, std::vector<nano::block_hash>{ genesis.open->hash () }));
+	auto channel (std::make_shared<nano::transport::channel_loopback> (node));
+	node.vote_processor.vote (vote, channel);
+	node.vote_processor.flush ();
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::signature_cache, nano::stat::detail::vote_hit, nano::stat::dir::in));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::signature_cache, nano::stat::detail::vote_miss, nano::stat::dir::in));
+	// The same vote arriving again is not verified again
+	node.vote_processor.vote (std::make_shared<nano::vote> (*vote), channel);
+	node.vote_processor.flush ();
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::signature_cache, nano::stat::detail::vote_hit, nano::stat::dir::in));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::signature_cache, nano::stat::detail::vote_miss, nano::stat::dir::in));
+	// Invalid signatures are never cached
+	auto vote_invalid (std::make_shared<nano::vote> (*vote));
+	vote_invalid->signature.bytes[0] ^= 1;
+	node.vote_processor.vote (vote_invalid, channel);
+	node.vote_processor.flush ();
+	node.vote_processor.vote (std::make_shared<nano::vote> (*vote_invalid), channel);
+	node.vote_processor.flush ();
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::signature_cache, nano::stat::detail::vote_hit, nano::stat::dir::in));
+	ASSERT_EQ (3, node.stats.count (nano::stat::type::signature_cache, nano::stat::detail::vote_miss, nano::stat::dir::in));
+}
+
 TEST (vote_processor, no_capacity)
 {
 	nano::system system;
@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 using namespace std::chrono_literals;
 
 namespace nano
@@ -120,6 +122,51 @@ TEST (vote_generator, session)
 	ASSERT_TIMELY (2s, 1 == node->stats.count (nano::stat::type::vote, nano::stat::detail::vote_indeterminate));
 }
 
+TEST (vote_generator, signing_pool)
+{
+	nano::system system;
+	nano::node_config config (nano::get_available_port (), system.logging);
+	config.frontiers_confirmation = nano::frontiers_confirmation_mode::disabled;
+	config.vote_generator_threads = 2;
+	auto & node = *system.add_node (config);
+	system.wallet (0)->insert_adhoc (nano::dev_genesis_key.prv);
+	// Two full votes worth of hashes, with confirmed dependents
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	nano::block_hash previous (nano::genesis_hash);
+	nano::state_block_builder builder;
+	for (size_t i (0); i < 2 * nano::network::confirm_ack_hashes_max; ++i)
+	{
+		auto send = builder.make_block ()
+		            .account (nano::dev_genesis_key.pub)
+		            .previous (previous)
+		            .representative (nano::dev_genesis_key.pub)
+		            .balance (nano::genesis_amount - (i + 1))
+		            .link (nano::dev_genesis_key.pub)
+		            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+		            .work (*system.work.generate (previous))
+		            .build_shared ();
+		ASSERT_EQ (nano::process_result::progress, node.ledger.process (node.store.tx_begin_write (), *send).code);
+		previous = send->hash ();
+		blocks.push_back (send);
+	}
+	node.store.confirmation_height_put (node.store.tx_begin_write (), nano::dev_genesis_key.pub, { blocks.size () + 1, previous });
+	for (auto const & block : blocks)
+	{
+		node.active.generator.add (block->root (), block->hash ());
+	}
+	auto total = [&node](nano::stat::detail detail_a) {
+		auto bins (node.stats.get_histogram (nano::stat::type::vote_generator, detail_a, nano::stat::dir::in)->get_bins ());
+		return std::accumulate (bins.begin (), bins.end (), uint64_t (0), [](uint64_t total_a, auto const & bin_a) { return total_a + bin_a.value; });
+	};
+	ASSERT_TIMELY (5s, std::all_of (blocks.begin (), blocks.end (), [&node](auto const & block_a) { return !node.history.votes (block_a->root (), block_a->hash ()).empty (); }));
+	// Broadcast latency is recorded last for each vote
+	ASSERT_TIMELY (5s, total (nano::stat::detail::generator_broadcast_latency) == node.stats.count (nano::stat::type::vote_generator, nano::stat::detail::generator_broadcasts));
+	auto const broadcasts (node.stats.count (nano::stat::type::vote_generator, nano::stat::detail::generator_broadcasts));
+	ASSERT_GE (broadcasts, 2u);
+	ASSERT_EQ (broadcasts, total (nano::stat::detail::generator_queue_latency));
+	ASSERT_EQ (broadcasts, total (nano::stat::detail::generator_sign_latency));
+}
+
 TEST (vote_spacing, basic)
 {
 	nano::vote_spacing spacing{ std::chrono::milliseconds{ 100 } };
@@ -394,6 +394,38 @@ TEST (wallet, hash_password)
 	ASSERT_NE (hash1, hash3);
 }
 
+TEST (kdf, precompute)
+{
+	nano::kdf kdf1;
+	nano::kdf kdf2 (4);
+	std::vector<nano::uint256_union> salts;
+	for (auto i (0); i < 8; ++i)
+	{
+		salts.emplace_back (i);
+	}
+	kdf2.precompute (salts);
+	ASSERT_EQ (salts.size (), kdf2.precomputed_size ());
+	for (auto const & salt : salts)
+	{
+		nano::raw_key expected;
+		kdf1.phs (expected, "", salt);
+		nano::raw_key key;
+		kdf2.phs (key, "", salt);
+		ASSERT_EQ (expected, key);
+	}
+	ASSERT_EQ (0, kdf2.precomputed_size ());
+	// Only the empty password is served from precomputed keys
+	kdf2.precompute ({ salts[0] });
+	nano::raw_key expected;
+	kdf1.phs (expected, "a", salts[0]);
+	nano::raw_key key;
+	kdf2.phs (key, "a", salts[0]);
+	ASSERT_EQ (expected, key);
+	ASSERT_EQ (1, kdf2.precomputed_size ());
+	kdf2.precomputed_clear ();
+	ASSERT_EQ (0, kdf2.precomputed_size ());
+}
+
 TEST (fan, reconstitute)
 {
 	nano::raw_key value0 (0);
@@ -711,6 +743,38 @@ TEST (wallet, work_cache_delayed)
 	ASSERT_GE (nano::work_difficulty (nano::work_version::work_1, block2->hash (), work1), threshold);
 }
 
+TEST (wallet, work_precache)
+{
+	nano::system system (1);
+	auto & node1 (*system.nodes[0]);
+	auto wallet (system.wallet (0));
+	wallet->insert_adhoc (nano::dev_genesis_key.prv);
+	nano::keypair key;
+	auto block1 (wallet->send_action (nano::dev_genesis_key.pub, key.pub, 100));
+	ASSERT_NE (nullptr, block1);
+	auto threshold (node1.default_difficulty (nano::work_version::work_1));
+	uint64_t work1 (0);
+	ASSERT_TIMELY (10s, !wallet->store.work_get (node1.wallets.tx_begin_read (), nano::dev_genesis_key.pub, work1) && nano::work_difficulty (nano::work_version::work_1, block1->hash (), work1) >= threshold);
+	ASSERT_LE (1, node1.stats.count (nano::stat::type::work_precache, nano::stat::detail::precache_generated));
+	ASSERT_FALSE (node1.wallets.precache->exists (nano::dev_genesis_key.pub));
+	// The next block uses the precached work
+	auto hits (node1.stats.count (nano::stat::type::work_precache, nano::stat::detail::cache_hit));
+	auto block2 (wallet->send_action (nano::dev_genesis_key.pub, key.pub, 100));
+	ASSERT_NE (nullptr, block2);
+	ASSERT_EQ (work1, block2->block_work ());
+	ASSERT_EQ (hits + 1, node1.stats.count (nano::stat::type::work_precache, nano::stat::detail::cache_hit));
+	// Work provided by the caller is not counted as a precache hit or miss
+	auto misses (node1.stats.count (nano::stat::type::work_precache, nano::stat::detail::cache_miss));
+	auto block3 (wallet->send_action (nano::dev_genesis_key.pub, key.pub, 100, *system.work.generate (block2->hash ())));
+	ASSERT_NE (nullptr, block3);
+	ASSERT_EQ (hits + 1, node1.stats.count (nano::stat::type::work_precache, nano::stat::detail::cache_hit));
+	ASSERT_EQ (misses, node1.stats.count (nano::stat::type::work_precache, nano::stat::detail::cache_miss));
+	// Removing an account unschedules its precaching, as completed actions do for their previous root
+	node1.wallets.precache->add (wallet, key.pub, key.pub);
+	node1.wallets.precache->remove (key.pub);
+	ASSERT_FALSE (node1.wallets.precache->exists (key.pub));
+}
+
 TEST (wallet, insert_locked)
 {
 	nano::system system (1);
@@ -1239,6 +1303,82 @@ TEST (wallet, search_pending)
 	ASSERT_EQ (send->hash (), receive->link ().as_block_hash ());
 }
 
+TEST (wallet, pending_search_find)
+{
+	nano::system system;
+	nano::node_config config (nano::get_available_port (), system.logging);
+	config.enable_voting = false;
+	config.frontiers_confirmation = nano::frontiers_confirmation_mode::disabled;
+	nano::node_flags flags;
+	flags.disable_search_pending = true;
+	auto & node (*system.add_node (config, flags));
+	nano::keypair key1;
+	nano::keypair key2;
+	nano::keypair key3;
+	auto minimum (node.config.receive_minimum.number ());
+	nano::state_block_builder builder;
+	auto send1 = builder.make_block ()
+	             .account (nano::dev_genesis_key.pub)
+	             .previous (nano::genesis_hash)
+	             .representative (nano::dev_genesis_key.pub)
+	             .balance (nano::genesis_amount - minimum)
+	             .link (key1.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (nano::genesis_hash))
+	             .build_shared ();
+	auto send2 = builder.make_block ()
+	             .from (*send1)
+	             .previous (send1->hash ())
+	             .balance (nano::genesis_amount - 2 * minimum)
+	             .link (key2.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (send1->hash ()))
+	             .build_shared ();
+	// Unconfirmed, should have its confirmation requested
+	auto send3 = builder.make_block ()
+	             .from (*send2)
+	             .previous (send2->hash ())
+	             .balance (nano::genesis_amount - 3 * minimum)
+	             .link (key1.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (send2->hash ()))
+	             .build_shared ();
+	// Below the receive minimum, should be ignored
+	auto send4 = builder.make_block ()
+	             .from (*send3)
+	             .previous (send3->hash ())
+	             .balance (nano::genesis_amount - 3 * minimum - 1)
+	             .link (key3.pub)
+	             .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+	             .work (*system.work.generate (send3->hash ()))
+	             .build_shared ();
+	{
+		auto transaction (node.store.tx_begin_write ());
+		ASSERT_EQ (nano::process_result::progress, node.ledger.process (transaction, *send1).code);
+		ASSERT_EQ (nano::process_result::progress, node.ledger.process (transaction, *send2).code);
+		ASSERT_EQ (nano::process_result::progress, node.ledger.process (transaction, *send3).code);
+		ASSERT_EQ (nano::process_result::progress, node.ledger.process (transaction, *send4).code);
+		node.store.confirmation_height_put (transaction, nano::dev_genesis_key.pub, { 3, send2->hash () });
+	}
+	std::vector<nano::account> accounts{ key1.pub, key2.pub, key3.pub };
+	std::sort (accounts.begin (), accounts.end ());
+	nano::pending_search search (node);
+	auto receivables (search.find (accounts));
+	ASSERT_EQ (2, receivables.size ());
+	std::unordered_map<nano::block_hash, nano::account> found;
+	for (auto const & receivable : receivables)
+	{
+		ASSERT_EQ (minimum, receivable.amount);
+		found.emplace (receivable.hash, receivable.account);
+	}
+	ASSERT_EQ (key1.pub, found[send1->hash ()]);
+	ASSERT_EQ (key2.pub, found[send2->hash ()]);
+	ASSERT_TIMELY (5s, node.active.election (send3->qualified_root ()) != nullptr);
+	ASSERT_EQ (3, node.stats.count (nano::stat::type::pending_search, nano::stat::detail::accounts, nano::stat::dir::in));
+	ASSERT_EQ (3, node.stats.count (nano::stat::type::pending_search, nano::stat::detail::pending, nano::stat::dir::in));
+	ASSERT_EQ (2, node.stats.count (nano::stat::type::pending_search, nano::stat::detail::confirmed, nano::stat::dir::in));
+}
+
 TEST (wallet, receive_pruned)
 {
 	nano::system system;
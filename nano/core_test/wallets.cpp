@@ -242,3 +242,49 @@ TEST (wallets, search_pending)
 		ASSERT_EQ (send->hash (), receive->link ().as_block_hash ());
 	}
 }
+
+TEST (wallets, parallel_actions)
+{
+	nano::system system;
+	nano::node_config config (nano::get_available_port (), system.logging);
+	config.wallet_action_threads = 2;
+	auto & node (*system.add_node (config));
+	auto wallet (system.wallet (0));
+	nano::keypair key1;
+	nano::keypair key2;
+	std::promise<void> release;
+	auto released (release.get_future ().share ());
+	std::atomic<bool> other_done{ false };
+	// An action blocked for one account must not hold back actions for other accounts
+	node.wallets.queue_wallet_action (
+	nano::wallets::high_priority, wallet, [released](nano::wallet &) {
+		released.wait ();
+	},
+	key1.pub);
+	node.wallets.queue_wallet_action (
+	nano::wallets::high_priority, wallet, [&other_done](nano::wallet &) {
+		other_done = true;
+	},
+	key2.pub);
+	ASSERT_TIMELY (5s, other_done);
+	// Actions for the blocked account wait for it and keep their priority order
+	nano::locked<std::vector<int>> order;
+	node.wallets.queue_wallet_action (
+	1, wallet, [&order](nano::wallet &) {
+		order->push_back (2);
+	},
+	key1.pub);
+	node.wallets.queue_wallet_action (
+	2, wallet, [&order](nano::wallet &) {
+		order->push_back (1);
+	},
+	key1.pub);
+	ASSERT_EQ (2, wallet->queued_actions);
+	ASSERT_EQ (2, node.wallets.actions_size ());
+	ASSERT_TRUE (order->empty ());
+	release.set_value ();
+	ASSERT_TIMELY (5s, order->size () == 2);
+	ASSERT_EQ (1, order->at (0));
+	ASSERT_EQ (2, order->at (1));
+	ASSERT_EQ (0, wallet->queued_actions);
+}
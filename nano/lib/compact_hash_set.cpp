@@ -0,0 +1,117 @@
+#include <nano/lib/compact_hash_set.hpp>
+#include <nano/lib/utility.hpp>
+
+uint64_t nano::compact_hash_set::key (uint64_t hash_a)
+{
+	return hash_a != 0 ? hash_a : 1;
+}
+
+size_t nano::compact_hash_set::home (uint64_t key_a) const
+{
+	debug_assert (!slots.empty ());
+	// Fibonacci hashing spreads keys whose low bits are not uniformly distributed
+	return static_cast<size_t> ((key_a * 0x9e3779b97f4a7c15ULL) >> shift);
+}
+
+size_t nano::compact_hash_set::find (uint64_t key_a) const
+{
+	auto const mask (slots.size () - 1);
+	auto index (home (key_a));
+	while (slots[index] != 0 && slots[index] != key_a)
+	{
+		index = (index + 1) & mask;
+	}
+	return index;
+}
+
+bool nano::compact_hash_set::insert (uint64_t hash_a)
+{
+	if ((count + 1) * 4 > slots.size () * 3)
+	{
+		grow ();
+	}
+	auto const key_l (key (hash_a));
+	auto & slot (slots[find (key_l)]);
+	auto result (slot == 0);
+	if (result)
+	{
+		slot = key_l;
+		++count;
+	}
+	return result;
+}
+
+bool nano::compact_hash_set::erase (uint64_t hash_a)
+{
+	auto result (false);
+	if (count > 0)
+	{
+		auto const mask (slots.size () - 1);
+		auto index (find (key (hash_a)));
+		result = slots[index] != 0;
+		if (result)
+		{
+			// Shift later entries of the probe sequence back so that no lookup stops early at the freed slot
+			for (auto next ((index + 1) & mask); slots[next] != 0; next = (next + 1) & mask)
+			{
+				auto const next_home (home (slots[next]));
+				auto const stays (index <= next ? index < next_home && next_home <= next : index < next_home || next_home <= next);
+				if (!stays)
+				{
+					slots[index] = slots[next];
+					index = next;
+				}
+			}
+			slots[index] = 0;
+			--count;
+		}
+	}
+	return result;
+}
+
+bool nano::compact_hash_set::contains (uint64_t hash_a) const
+{
+	return count > 0 && slots[find (key (hash_a))] != 0;
+}
+
+size_t nano::compact_hash_set::size () const
+{
+	return count;
+}
+
+bool nano::compact_hash_set::empty () const
+{
+	return count == 0;
+}
+
+void nano::compact_hash_set::clear ()
+{
+	slots.clear ();
+	slots.shrink_to_fit ();
+	count = 0;
+	shift = 64;
+}
+
+size_t nano::compact_hash_set::memory () const
+{
+	return slots.capacity () * sizeof (uint64_t);
+}
+
+void nano::compact_hash_set::grow ()
+{
+	std::vector<uint64_t> old;
+	old.swap (slots);
+	slots.resize (old.empty () ? 16 : old.size () * 2);
+	shift = 64;
+	for (auto size (slots.size ()); size > 1; size >>= 1)
+	{
+		--shift;
+	}
+	for (auto key_l : old)
+	{
+		if (key_l != 0)
+		{
+			slots[find (key_l)] = key_l;
+		}
+	}
+}
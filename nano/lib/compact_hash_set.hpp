@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Set of 64 bit hashes stored in one open addressing table with linear probing, 8 bytes per slot and no per entry allocation.
+ * Larger keys are reduced to 64 bits by the caller, different keys with the same hash are treated as the same entry.
+ * The table doubles once it is three quarters full. Not thread safe.
+ */
+class compact_hash_set final
+{
+public:
+	/** Returns true if \p hash_a was added, false if it was already present */
+	bool insert (uint64_t hash_a);
+	/** Returns true if \p hash_a was present */
+	bool erase (uint64_t hash_a);
+	bool contains (uint64_t hash_a) const;
+	size_t size () const;
+	bool empty () const;
+	void clear ();
+	/** Bytes allocated for the table */
+	size_t memory () const;
+
+private:
+	/** Slot holding \p key_a, or the empty slot where it would be inserted */
+	size_t find (uint64_t key_a) const;
+	size_t home (uint64_t key_a) const;
+	void grow ();
+	/** Zero marks empty slots so it is stored as one */
+	static uint64_t key (uint64_t hash_a);
+	std::vector<uint64_t> slots;
+	size_t count{ 0 };
+	unsigned shift{ 64 };
+};
+}
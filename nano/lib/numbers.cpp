@@ -12,46 +12,116 @@
 namespace
 {
 char const * account_lookup ("13456789abcdefghijkmnopqrstuwxyz");
-char const * account_reverse ("~0~1234567~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~89:;<=>?@AB~CDEFGHIJK~LMNO~~~~~");
-char account_encode (uint8_t value)
-{
-	debug_assert (value < 32);
-	auto result (account_lookup[value]);
+char const * hex_lookup ("0123456789ABCDEF");
+uint8_t constexpr account_invalid = 0xff;
+/** Maps each character to its 5 bit account alphabet value, or account_invalid */
+std::array<uint8_t, 256> const account_reverse = []() {
+	std::array<uint8_t, 256> result;
+	result.fill (account_invalid);
+	for (uint8_t i (0); i < 32; ++i)
+	{
+		result[static_cast<uint8_t> (account_lookup[i])] = i;
+	}
 	return result;
+}();
+/** Account strings encode the key followed by a 40 bit checksum, as a 296 bit big endian number */
+size_t constexpr account_number_size = 32 + 5;
+size_t constexpr account_number_bits = account_number_size * 8;
+size_t constexpr account_chars = 60;
+
+void account_checksum (nano::public_key const & key_a, uint8_t (&checksum_a)[5])
+{
+	blake2b_state hash;
+	blake2b_init (&hash, sizeof (checksum_a));
+	blake2b_update (&hash, key_a.bytes.data (), key_a.bytes.size ());
+	blake2b_final (&hash, checksum_a, sizeof (checksum_a));
+}
+
+void encode_hex (uint8_t const * bytes_a, size_t size_a, char * destination_a)
+{
+	for (size_t i (0); i < size_a; ++i)
+	{
+		destination_a[2 * i] = hex_lookup[bytes_a[i] >> 4];
+		destination_a[2 * i + 1] = hex_lookup[bytes_a[i] & 0xf];
+	}
 }
-uint8_t account_decode (char value)
+
+/** Writes the big endian number in \p bytes_a as decimal, \p size_a must be a multiple of 4 */
+template <size_t size_a>
+size_t encode_dec (std::array<uint8_t, size_a> const & bytes_a, char * destination_a)
 {
-	debug_assert (value >= '0');
-	debug_assert (value <= '~');
-	auto result (account_reverse[value - 0x30]);
-	if (result != '~')
+	static_assert (size_a % 4 == 0, "Whole 32 bit limbs are required");
+	std::array<uint32_t, size_a / 4> limbs;
+	for (size_t i (0); i < limbs.size (); ++i)
 	{
-		result -= 0x30;
+		limbs[i] = (uint32_t (bytes_a[4 * i]) << 24) | (uint32_t (bytes_a[4 * i + 1]) << 16) | (uint32_t (bytes_a[4 * i + 2]) << 8) | uint32_t (bytes_a[4 * i + 3]);
 	}
-	return result;
+	// Digits are produced 9 at a time from the least significant end by long division of the limbs
+	std::array<char, (size_a * 8 + 2) / 3 + 9> digits;
+	auto end (digits.end ());
+	auto begin (end);
+	size_t first (0);
+	while (first < limbs.size ())
+	{
+		uint64_t remainder (0);
+		for (auto i (first); i < limbs.size (); ++i)
+		{
+			auto const current ((remainder << 32) | limbs[i]);
+			limbs[i] = static_cast<uint32_t> (current / 1000000000);
+			remainder = current % 1000000000;
+		}
+		while (first < limbs.size () && limbs[first] == 0)
+		{
+			++first;
+		}
+		for (auto i (0); i < 9; ++i)
+		{
+			*--begin = static_cast<char> ('0' + remainder % 10);
+			remainder /= 10;
+		}
+	}
+	while (begin + 1 < end && *begin == '0')
+	{
+		++begin;
+	}
+	if (begin == end)
+	{
+		*--begin = '0';
+	}
+	std::copy (begin, end, destination_a);
+	return static_cast<size_t> (end - begin);
 }
 }
 
 void nano::public_key::encode_account (std::string & destination_a) const
 {
 	debug_assert (destination_a.empty ());
-	destination_a.reserve (65);
-	uint64_t check (0);
-	blake2b_state hash;
-	blake2b_init (&hash, 5);
-	blake2b_update (&hash, bytes.data (), bytes.size ());
-	blake2b_final (&hash, reinterpret_cast<uint8_t *> (&check), 5);
-	nano::uint512_t number_l (number ());
-	number_l <<= 40;
-	number_l |= nano::uint512_t (check);
-	for (auto i (0); i < 60; ++i)
+	destination_a.resize (account_encoded_size);
+	encode_account (&destination_a[0]);
+}
+
+void nano::public_key::encode_account (char * destination_a) const
+{
+	std::array<uint8_t, account_number_size> number_l;
+	std::copy (bytes.begin (), bytes.end (), number_l.begin ());
+	uint8_t checksum[5];
+	account_checksum (*this, checksum);
+	// The checksum is the low 40 bits of the number, its first byte least significant
+	std::reverse_copy (std::begin (checksum), std::end (checksum), number_l.begin () + bytes.size ());
+	std::copy_n ("nano_", 5, destination_a);
+	auto characters (destination_a + 5);
+	for (size_t i (0); i < account_chars; ++i)
 	{
-		uint8_t r (number_l & static_cast<uint8_t> (0x1f));
-		number_l >>= 5;
-		destination_a.push_back (account_encode (r));
+		// Character i from the end holds bits [5 * i, 5 * i + 5)
+		auto const bit (5 * i);
+		auto const byte (account_number_size - 1 - bit / 8);
+		unsigned value (number_l[byte]);
+		if (byte > 0)
+		{
+			value |= unsigned (number_l[byte - 1]) << 8;
+		}
+		characters[account_chars - 1 - i] = account_lookup[(value >> (bit % 8)) & 0x1f];
 	}
-	destination_a.append ("_onan"); // nano_
-	std::reverse (destination_a.begin (), destination_a.end ());
 }
 
 std::string nano::public_key::to_account () const
@@ -73,46 +143,50 @@ bool nano::public_key::decode_node_id (std::string const & source_a)
 
 bool nano::public_key::decode_account (std::string const & source_a)
 {
-	auto error (source_a.size () < 5);
+	return decode_account (source_a.data (), source_a.size ());
+}
+
+bool nano::public_key::decode_account (char const * source_a, size_t size_a)
+{
+	auto error (size_a < 5);
 	if (!error)
 	{
 		auto xrb_prefix (source_a[0] == 'x' && source_a[1] == 'r' && source_a[2] == 'b' && (source_a[3] == '_' || source_a[3] == '-'));
 		auto nano_prefix (source_a[0] == 'n' && source_a[1] == 'a' && source_a[2] == 'n' && source_a[3] == 'o' && (source_a[4] == '_' || source_a[4] == '-'));
 		auto node_id_prefix = (source_a[0] == 'n' && source_a[1] == 'o' && source_a[2] == 'd' && source_a[3] == 'e' && source_a[4] == '_');
-		error = (xrb_prefix && source_a.size () != 64) || (nano_prefix && source_a.size () != 65);
+		error = (xrb_prefix && size_a != 64) || (nano_prefix && size_a != 65);
 		if (!error)
 		{
 			if (xrb_prefix || nano_prefix || node_id_prefix)
 			{
-				auto i (source_a.begin () + (xrb_prefix ? 4 : 5));
-				if (*i == '1' || *i == '3')
+				auto const characters (source_a + (xrb_prefix ? 4 : 5));
+				auto const count (size_a - (characters - source_a));
+				if (count > 0 && (characters[0] == '1' || characters[0] == '3'))
 				{
-					nano::uint512_t number_l;
-					for (auto j (source_a.end ()); !error && i != j; ++i)
+					// Character i from the end sets bits [5 * i, 5 * i + 5), bits past the checksummed key are ignored
+					std::array<uint8_t, account_number_size> number_l{};
+					for (size_t i (0); !error && i < count; ++i)
 					{
-						uint8_t character (*i);
-						error = character < 0x30 || character >= 0x80;
-						if (!error)
+						auto const value (account_reverse[static_cast<uint8_t> (characters[count - 1 - i])]);
+						error = value == account_invalid;
+						auto const bit (5 * i);
+						if (!error && bit < account_number_bits)
 						{
-							uint8_t byte (account_decode (character));
-							error = byte == '~';
-							if (!error)
+							auto const shifted (unsigned (value) << (bit % 8));
+							auto const byte (account_number_size - 1 - bit / 8);
+							number_l[byte] |= static_cast<uint8_t> (shifted);
+							if (byte > 0)
 							{
-								number_l <<= 5;
-								number_l += byte;
+								number_l[byte - 1] |= static_cast<uint8_t> (shifted >> 8);
 							}
 						}
 					}
 					if (!error)
 					{
-						*this = (number_l >> 40).convert_to<nano::uint256_t> ();
-						uint64_t check (number_l & static_cast<uint64_t> (0xffffffffff));
-						uint64_t validation (0);
-						blake2b_state hash;
-						blake2b_init (&hash, 5);
-						blake2b_update (&hash, bytes.data (), bytes.size ());
-						blake2b_final (&hash, reinterpret_cast<uint8_t *> (&validation), 5);
-						error = check != validation;
+						std::copy_n (number_l.begin (), bytes.size (), bytes.begin ());
+						uint8_t checksum[5];
+						account_checksum (*this, checksum);
+						error = !std::equal (std::begin (checksum), std::end (checksum), number_l.rbegin ());
 					}
 				}
 				else
@@ -208,10 +282,13 @@ nano::uint256_t nano::uint256_union::number () const
 void nano::uint256_union::encode_hex (std::string & text) const
 {
 	debug_assert (text.empty ());
-	std::stringstream stream;
-	stream << std::hex << std::uppercase << std::noshowbase << std::setw (64) << std::setfill ('0');
-	stream << number ();
-	text = stream.str ();
+	text.resize (64);
+	encode_hex (&text[0]);
+}
+
+void nano::uint256_union::encode_hex (char * destination_a) const
+{
+	::encode_hex (bytes.data (), bytes.size (), destination_a);
 }
 
 bool nano::uint256_union::decode_hex (std::string const & text)
@@ -246,10 +323,13 @@ bool nano::uint256_union::decode_hex (std::string const & text)
 void nano::uint256_union::encode_dec (std::string & text) const
 {
 	debug_assert (text.empty ());
-	std::stringstream stream;
-	stream << std::dec << std::noshowbase;
-	stream << number ();
-	text = stream.str ();
+	char digits[78];
+	text.assign (digits, ::encode_dec (bytes, digits));
+}
+
+size_t nano::uint256_union::encode_dec (char * destination_a) const
+{
+	return ::encode_dec (bytes, destination_a);
 }
 
 bool nano::uint256_union::decode_dec (std::string const & text)
@@ -325,10 +405,13 @@ nano::uint512_t nano::uint512_union::number () const
 void nano::uint512_union::encode_hex (std::string & text) const
 {
 	debug_assert (text.empty ());
-	std::stringstream stream;
-	stream << std::hex << std::uppercase << std::noshowbase << std::setw (128) << std::setfill ('0');
-	stream << number ();
-	text = stream.str ();
+	text.resize (128);
+	encode_hex (&text[0]);
+}
+
+void nano::uint512_union::encode_hex (char * destination_a) const
+{
+	::encode_hex (bytes.data (), bytes.size (), destination_a);
 }
 
 bool nano::uint512_union::decode_hex (std::string const & text)
@@ -486,10 +569,13 @@ nano::uint128_t nano::uint128_union::number () const
 void nano::uint128_union::encode_hex (std::string & text) const
 {
 	debug_assert (text.empty ());
-	std::stringstream stream;
-	stream << std::hex << std::uppercase << std::noshowbase << std::setw (32) << std::setfill ('0');
-	stream << number ();
-	text = stream.str ();
+	text.resize (32);
+	encode_hex (&text[0]);
+}
+
+void nano::uint128_union::encode_hex (char * destination_a) const
+{
+	::encode_hex (bytes.data (), bytes.size (), destination_a);
 }
 
 bool nano::uint128_union::decode_hex (std::string const & text)
@@ -520,10 +606,13 @@ bool nano::uint128_union::decode_hex (std::string const & text)
 void nano::uint128_union::encode_dec (std::string & text) const
 {
 	debug_assert (text.empty ());
-	std::stringstream stream;
-	stream << std::dec << std::noshowbase;
-	stream << number ();
-	text = stream.str ();
+	char digits[39];
+	text.assign (digits, ::encode_dec (bytes, digits));
+}
+
+size_t nano::uint128_union::encode_dec (char * destination_a) const
+{
+	return ::encode_dec (bytes, destination_a);
 }
 
 bool nano::uint128_union::decode_dec (std::string const & text, bool decimal)
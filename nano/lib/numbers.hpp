@@ -30,8 +30,12 @@ public:
 	bool operator< (nano::uint128_union const &) const;
 	bool operator> (nano::uint128_union const &) const;
 	void encode_hex (std::string &) const;
+	/** Writes exactly 32 characters to \p destination_a, without a terminator */
+	void encode_hex (char * destination_a) const;
 	bool decode_hex (std::string const &);
 	void encode_dec (std::string &) const;
+	/** Writes at most 39 characters to \p destination_a, without a terminator, returning the number written */
+	size_t encode_dec (char * destination_a) const;
 	bool decode_dec (std::string const &, bool = false);
 	bool decode_dec (std::string const &, nano::uint128_t);
 	std::string format_balance (nano::uint128_t scale, int precision, bool group_digits) const;
@@ -76,8 +80,12 @@ public:
 	bool operator!= (nano::uint256_union const &) const;
 	bool operator< (nano::uint256_union const &) const;
 	void encode_hex (std::string &) const;
+	/** Writes exactly 64 characters to \p destination_a, without a terminator */
+	void encode_hex (char * destination_a) const;
 	bool decode_hex (std::string const &);
 	void encode_dec (std::string &) const;
+	/** Writes at most 78 characters to \p destination_a, without a terminator, returning the number written */
+	size_t encode_dec (char * destination_a) const;
 	bool decode_dec (std::string const &);
 
 	void clear ();
@@ -118,8 +126,13 @@ public:
 	std::string to_node_id () const;
 	bool decode_node_id (std::string const & source_a);
 	void encode_account (std::string &) const;
+	/** Writes exactly account_encoded_size characters to \p destination_a, without a terminator */
+	void encode_account (char * destination_a) const;
 	std::string to_account () const;
 	bool decode_account (std::string const &);
+	bool decode_account (char const * source_a, size_t size_a);
+
+	static size_t constexpr account_encoded_size = 65;
 
 	operator nano::link const & () const;
 	operator nano::root const & () const;
@@ -198,6 +211,8 @@ public:
 	bool operator!= (nano::uint512_union const &) const;
 	nano::uint512_union & operator^= (nano::uint512_union const &);
 	void encode_hex (std::string &) const;
+	/** Writes exactly 128 characters to \p destination_a, without a terminator */
+	void encode_hex (char * destination_a) const;
 	bool decode_hex (std::string const &);
 	void clear ();
 	bool is_zero () const;
@@ -6,9 +6,11 @@
 #include <boost/format.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <algorithm>
 #include <ctime>
 #include <fstream>
 #include <sstream>
+#include <thread>
 
 nano::error nano::stat_config::deserialize_json (nano::jsonconfig & json)
 {
@@ -282,9 +284,52 @@ std::vector<nano::stat_histogram::bin> nano::stat_histogram::get_bins () const
 	return bins;
 }
 
+nano::stat::stat () :
+stat (nano::stat_config{})
+{
+}
+
 nano::stat::stat (nano::stat_config config) :
-config (config)
+config (config),
+shard_count (std::max (1u, std::min (16u, std::thread::hardware_concurrency ()))),
+counters (shard_count * counters_per_shard),
+slow_path (config.sampling_enabled || config.log_interval_counters > 0 || config.log_interval_samples > 0)
+{
+}
+
+size_t nano::stat::index_of (uint32_t key)
+{
+	auto type (key >> 16 & 0x000000ff);
+	auto detail (key >> 8 & 0x000000ff);
+	auto dir (key & 0x000000ff);
+	debug_assert (type < static_cast<uint32_t> (stat::type::_last) && detail < static_cast<uint32_t> (stat::detail::_last) && dir < 2);
+	return (type * static_cast<size_t> (stat::detail::_last) + detail) * 2 + dir;
+}
+
+uint32_t nano::stat::key_of_index (size_t index)
 {
+	auto dir (index % 2);
+	auto detail (index / 2 % static_cast<size_t> (stat::detail::_last));
+	auto type (index / 2 / static_cast<size_t> (stat::detail::_last));
+	return static_cast<uint32_t> (type << 16 | detail << 8 | dir);
+}
+
+size_t nano::stat::shard_index () const
+{
+	// Threads are spread over the shards in the order they first update a stat
+	static std::atomic<size_t> next_thread_index{ 0 };
+	thread_local size_t const thread_index (next_thread_index++);
+	return thread_index % shard_count;
+}
+
+uint64_t nano::stat::count_impl (size_t index) const
+{
+	uint64_t result (0);
+	for (size_t shard (0); shard < shard_count; ++shard)
+	{
+		result += counters[shard * counters_per_shard + index].load (std::memory_order_relaxed);
+	}
+	return result;
 }
 
 std::shared_ptr<nano::stat_entry> nano::stat::get_entry (uint32_t key)
@@ -339,16 +384,23 @@ void nano::stat::log_counters_impl (stat_log_sink & sink)
 		sink.write_header ("counters", walltime);
 	}
 
-	for (auto & it : entries)
+	// Counters only updated through the fast path have no entry and are reported with the current time
+	auto now (std::chrono::system_clock::now ());
+	for (size_t index (0); index < counters_per_shard; ++index)
 	{
-		std::time_t time = std::chrono::system_clock::to_time_t (it.second->counter.get_timestamp ());
-		tm local_tm = *localtime (&time);
+		auto key = key_of_index (index);
+		auto value (count_impl (index));
+		auto entry (entries.find (key));
+		if (value != 0 || entry != entries.end ())
+		{
+			std::time_t time = std::chrono::system_clock::to_time_t (entry != entries.end () ? entry->second->counter_timestamp : now);
+			tm local_tm = *localtime (&time);
 
-		auto key = it.first;
-		std::string type = type_to_string (key);
-		std::string detail = detail_to_string (key);
-		std::string dir = dir_to_string (key);
-		sink.write_entry (local_tm, type, detail, dir, it.second->counter.get_value (), it.second->histogram.get ());
+			std::string type = type_to_string (key);
+			std::string detail = detail_to_string (key);
+			std::string dir = dir_to_string (key);
+			sink.write_entry (local_tm, type, detail, dir, value, entry != entries.end () ? entry->second->histogram.get () : nullptr);
+		}
 	}
 	sink.entries ()++;
 	sink.finalize ();
@@ -413,6 +465,18 @@ nano::stat_histogram * nano::stat::get_histogram (stat::type type, stat::detail
 }
 
 void nano::stat::update (uint32_t key_a, uint64_t value)
+{
+	if (!stopped.load (std::memory_order_relaxed))
+	{
+		counters[shard_index () * counters_per_shard + index_of (key_a)].fetch_add (value, std::memory_order_relaxed);
+		if (slow_path.load (std::memory_order_relaxed))
+		{
+			update_slow (key_a, value);
+		}
+	}
+}
+
+void nano::stat::update_slow (uint32_t key_a, uint64_t value)
 {
 	static file_writer log_count (config.log_counters_filename);
 	static file_writer log_sample (config.log_samples_filename);
@@ -425,9 +489,13 @@ void nano::stat::update (uint32_t key_a, uint64_t value)
 		auto entry (get_entry_impl (key_a, config.interval, config.capacity));
 
 		// Counters
-		auto old (entry->counter.get_value ());
-		entry->counter.add (value);
-		entry->count_observers.notify (old, entry->counter.get_value ());
+		entry->counter_timestamp = std::chrono::system_clock::now ();
+		if (!entry->count_observers.observers.empty ())
+		{
+			// Concurrent fast path updates may be included, the observed difference is at least value
+			auto current (count_impl (index_of (key_a)));
+			entry->count_observers.notify (current - value, current);
+		}
 
 		std::chrono::duration<double, std::milli> duration = now - log_last_count_writeout;
 		if (config.log_interval_counters > 0 && duration.count () > config.log_interval_counters)
@@ -485,6 +553,10 @@ void nano::stat::stop ()
 void nano::stat::clear ()
 {
 	nano::unique_lock<nano::mutex> lock (stat_mutex);
+	for (auto & counter : counters)
+	{
+		counter.store (0, std::memory_order_relaxed);
+	}
 	entries.clear ();
 	timestamp = std::chrono::steady_clock::now ();
 }
@@ -564,6 +636,24 @@ std::string nano::stat::type_to_string (uint32_t key)
 		case nano::stat::type::vote_generator:
 			res = "vote_generator";
 			break;
+		case nano::stat::type::pending_search:
+			res = "pending_search";
+			break;
+		case nano::stat::type::work_precache:
+			res = "work_precache";
+			break;
+		case nano::stat::type::_last:
+			debug_assert (false);
+			break;
+		case nano::stat::type::pruning:
+			res = "pruning";
+			break;
+		case nano::stat::type::signature_cache:
+			res = "signature_cache";
+			break;
+		case nano::stat::type::account_info_cache:
+			res = "account_info_cache";
+			break;
 	}
 	return res;
 }
@@ -667,6 +757,9 @@ std::string nano::stat::detail_to_string (uint32_t key)
 		case nano::stat::detail::initiate_wallet_lazy:
 			res = "initiate_wallet_lazy";
 			break;
+		case nano::stat::detail::initiate_ascending:
+			res = "initiate_ascending";
+			break;
 		case nano::stat::detail::insufficient_work:
 			res = "insufficient_work";
 			break;
@@ -877,6 +970,84 @@ std::string nano::stat::detail_to_string (uint32_t key)
 		case nano::stat::detail::generator_spacing:
 			res = "generator_spacing";
 			break;
+		case nano::stat::detail::accounts:
+			res = "accounts";
+			break;
+		case nano::stat::detail::pending:
+			res = "pending";
+			break;
+		case nano::stat::detail::confirmed:
+			res = "confirmed";
+			break;
+		case nano::stat::detail::confirm_requested:
+			res = "confirm_requested";
+			break;
+		case nano::stat::detail::receive_failed:
+			res = "receive_failed";
+			break;
+		case nano::stat::detail::cache_hit:
+			res = "cache_hit";
+			break;
+		case nano::stat::detail::cache_miss:
+			res = "cache_miss";
+			break;
+		case nano::stat::detail::precache_queued:
+			res = "precache_queued";
+			break;
+		case nano::stat::detail::precache_generated:
+			res = "precache_generated";
+			break;
+		case nano::stat::detail::precache_failed:
+			res = "precache_failed";
+			break;
+		case nano::stat::detail::_last:
+			debug_assert (false);
+			break;
+		case nano::stat::detail::targets_found:
+			res = "targets_found";
+			break;
+		case nano::stat::detail::blocks_pruned:
+			res = "blocks_pruned";
+			break;
+		case nano::stat::detail::sideband_reads:
+			res = "sideband_reads";
+			break;
+		case nano::stat::detail::transition_pass:
+			res = "transition_pass";
+			break;
+		case nano::stat::detail::transition_visit:
+			res = "transition_visit";
+			break;
+		case nano::stat::detail::generator_queue_latency:
+			res = "generator_queue_latency";
+			break;
+		case nano::stat::detail::generator_sign_latency:
+			res = "generator_sign_latency";
+			break;
+		case nano::stat::detail::generator_broadcast_latency:
+			res = "generator_broadcast_latency";
+			break;
+		case nano::stat::detail::vote_hit:
+			res = "vote_hit";
+			break;
+		case nano::stat::detail::vote_miss:
+			res = "vote_miss";
+			break;
+		case nano::stat::detail::state_block_hit:
+			res = "state_block_hit";
+			break;
+		case nano::stat::detail::state_block_miss:
+			res = "state_block_miss";
+			break;
+		case nano::stat::detail::frontier_req_frontiers:
+			res = "frontier_req_frontiers";
+			break;
+		case nano::stat::detail::frontier_req_batches:
+			res = "frontier_req_batches";
+			break;
+		case nano::stat::detail::lazy_memory_limited:
+			res = "lazy_memory_limited";
+			break;
 	}
 	return res;
 }
@@ -5,12 +5,14 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <initializer_list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace nano
 {
@@ -136,8 +138,8 @@ public:
 	/** Value within the current sample interval */
 	stat_datapoint sample_current;
 
-	/** Counting value for this entry, including the time of last update. This is never reset and only increases. */
-	stat_datapoint counter;
+	/** Wall time of the last update going through the slow path. The count itself is kept by nano::stat */
+	std::chrono::system_clock::time_point counter_timestamp{ std::chrono::system_clock::now () };
 
 	/** Optional histogram for this entry */
 	std::unique_ptr<stat_histogram> histogram;
@@ -242,7 +244,13 @@ public:
 		requests,
 		filter,
 		telemetry,
-		vote_generator
+		vote_generator,
+		pending_search,
+		work_precache,
+		pruning,
+		signature_cache,
+		account_info_cache,
+		_last // Must be the last enum
 	};
 
 	/** Optional detail type */
@@ -288,6 +296,7 @@ public:
 		initiate_legacy_age,
 		initiate_lazy,
 		initiate_wallet_lazy,
+		initiate_ascending,
 
 		// bootstrap specific
 		bulk_pull,
@@ -384,7 +393,50 @@ public:
 		generator_broadcasts,
 		generator_replies,
 		generator_replies_discarded,
-		generator_spacing
+		generator_spacing,
+
+		// pending_search
+		accounts,
+		pending,
+		confirmed,
+		confirm_requested,
+		receive_failed,
+
+		// work_precache
+		cache_hit,
+		cache_miss,
+		precache_queued,
+		precache_generated,
+		precache_failed,
+
+		// pruning
+		targets_found,
+		blocks_pruned,
+		sideband_reads,
+
+		// election transitions
+		transition_pass,
+		transition_visit,
+
+		// vote generator latency, microseconds
+		generator_queue_latency,
+		generator_sign_latency,
+		generator_broadcast_latency,
+
+		// signature_cache
+		vote_hit,
+		vote_miss,
+		state_block_hit,
+		state_block_miss,
+
+		// frontier_req_server
+		frontier_req_frontiers,
+		frontier_req_batches,
+
+		// bootstrap_attempt_lazy
+		lazy_memory_limited,
+
+		_last // Must be the last enum
 	};
 
 	/** Direction of the stat. If the direction is irrelevant, use in */
@@ -395,7 +447,7 @@ public:
 	};
 
 	/** Constructor using the default config values */
-	stat () = default;
+	stat ();
 
 	/**
 	 * Initialize stats with a config.
@@ -534,6 +586,7 @@ public:
 	void observe_count (stat::type type, stat::detail detail, stat::dir dir, std::function<void(uint64_t, uint64_t)> observer)
 	{
 		get_entry (key_of (type, detail, dir))->count_observers.add (observer);
+		slow_path = true;
 	}
 
 	/** Returns a potentially empty list of the last N samples, where N is determined by the 'capacity' configuration */
@@ -551,7 +604,7 @@ public:
 	/** Returns current value for the given counter at the detail level */
 	uint64_t count (stat::type type, stat::detail detail, stat::dir dir = stat::dir::in)
 	{
-		return get_entry (key_of (type, detail, dir))->counter.get_value ();
+		return count_impl (index_of (key_of (type, detail, dir)));
 	}
 
 	/** Returns the number of seconds since clear() was last called, or node startup if it's never called. */
@@ -585,6 +638,18 @@ private:
 		return static_cast<uint8_t> (type) << 16 | static_cast<uint8_t> (detail) << 8 | static_cast<uint8_t> (dir);
 	}
 
+	/** Position of the counter for \p key within a shard */
+	static size_t index_of (uint32_t key);
+
+	/** Inverse of index_of() */
+	static uint32_t key_of_index (size_t index);
+
+	/** Shard used by the calling thread */
+	size_t shard_index () const;
+
+	/** Sum of the counter at \p index over all shards */
+	uint64_t count_impl (size_t index) const;
+
 	/** Get entry for key, creating a new entry if necessary, using interval and sample count from config */
 	std::shared_ptr<nano::stat_entry> get_entry (uint32_t key);
 
@@ -601,6 +666,9 @@ private:
 	 */
 	void update (uint32_t key, uint64_t value);
 
+	/** Locked part of update(), only taken when observers, sampling or periodic logging are configured */
+	void update_slow (uint32_t key, uint64_t value);
+
 	/** Unlocked implementation of log_counters() to avoid using recursive locking */
 	void log_counters_impl (stat_log_sink & sink);
 
@@ -613,13 +681,27 @@ private:
 	/** Configuration deserialized from config.json */
 	nano::stat_config config;
 
-	/** Stat entries are sorted by key to simplify processing of log output */
+	/** Number of counters in a shard, one for each type/detail/dir combination */
+	static size_t constexpr counters_per_shard = static_cast<size_t> (stat::type::_last) * static_cast<size_t> (stat::detail::_last) * 2;
+
+	size_t const shard_count;
+
+	/**
+	 * Flat counter storage, \p shard_count consecutive shards of \p counters_per_shard counters.
+	 * Threads add to their own shard without locking and reads sum all shards.
+	 */
+	std::vector<std::atomic<uint64_t>> counters;
+
+	/** Set when updates also need to go through update_slow () */
+	std::atomic<bool> slow_path;
+
+	/** Stat entries hold sampling, histograms and observers. They are sorted by key to simplify processing of log output */
 	std::map<uint32_t, std::shared_ptr<nano::stat_entry>> entries;
 	std::chrono::steady_clock::time_point log_last_count_writeout{ std::chrono::steady_clock::now () };
 	std::chrono::steady_clock::time_point log_last_sample_writeout{ std::chrono::steady_clock::now () };
 
 	/** Whether stats should be output */
-	bool stopped{ false };
+	std::atomic<bool> stopped{ false };
 
 	/** All access to stat is thread safe, including calls from observers on the same thread */
 	nano::mutex stat_mutex;
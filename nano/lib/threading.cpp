@@ -87,6 +87,12 @@ std::string nano::thread_role::get_string (nano::thread_role::name role)
 		case nano::thread_role::name::db_parallel_traversal:
 			thread_role_name_string = "DB par traversl";
 			break;
+		case nano::thread_role::name::work_precache:
+			thread_role_name_string = "Work precache";
+			break;
+		case nano::thread_role::name::vote_signing:
+			thread_role_name_string = "Vote signing";
+			break;
 	}
 
 	/*
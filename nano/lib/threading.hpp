@@ -38,7 +38,9 @@ namespace thread_role
 		request_aggregator,
 		state_block_signature_verification,
 		epoch_upgrader,
-		db_parallel_traversal
+		db_parallel_traversal,
+		work_precache,
+		vote_signing
 	};
 	/*
 	 * Get/Set the identifier for the current thread
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <nano/lib/utility.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Hierarchical timing wheel, values are returned by advance () once their deadline has passed.
+ * Inserting and expiring a value is constant time no matter how many values are pending, only the slots of the ticks
+ * passed since the last advance are visited. Deadlines are rounded up to the resolution. Not thread safe.
+ */
+template <typename T>
+class timing_wheel final
+{
+public:
+	timing_wheel (std::chrono::milliseconds resolution_a, std::chrono::steady_clock::time_point start_a = std::chrono::steady_clock::now ()) :
+	resolution (std::max (resolution_a, std::chrono::milliseconds (1))),
+	start (start_a)
+	{
+	}
+
+	void insert (std::chrono::steady_clock::time_point deadline_a, T const & value_a)
+	{
+		// Values already due fire on the next tick
+		place (std::max (tick_of (deadline_a), current + 1), value_a);
+		++count;
+	}
+
+	/** Appends values with a deadline at or before \p now_a to \p expired_a */
+	void advance (std::chrono::steady_clock::time_point now_a, std::vector<T> & expired_a)
+	{
+		auto const target (now_a < start ? 0 : static_cast<uint64_t> ((now_a - start) / resolution));
+		while (current < target)
+		{
+			++current;
+			// Move the values of the next higher level slot down once a level wraps around
+			for (size_t level (1); level < levels && (current & ((uint64_t (1) << (bits * level)) - 1)) == 0; ++level)
+			{
+				auto entries (std::move (slots[level][slot_index (current, level)]));
+				slots[level][slot_index (current, level)].clear ();
+				for (auto & entry : entries)
+				{
+					place (entry.first, std::move (entry.second));
+				}
+			}
+			auto & slot (slots[0][slot_index (current, 0)]);
+			for (auto & entry : slot)
+			{
+				expired_a.push_back (std::move (entry.second));
+			}
+			count -= slot.size ();
+			slot.clear ();
+		}
+	}
+
+	size_t size () const
+	{
+		return count;
+	}
+
+	bool empty () const
+	{
+		return count == 0;
+	}
+
+	static size_t constexpr levels = 4;
+	static size_t constexpr bits = 6;
+	static size_t constexpr slots_per_level = size_t (1) << bits;
+
+private:
+	uint64_t tick_of (std::chrono::steady_clock::time_point time_a) const
+	{
+		// Round up so a value never fires before its deadline
+		return time_a <= start ? 0 : static_cast<uint64_t> ((time_a - start + resolution - std::chrono::steady_clock::duration (1)) / resolution);
+	}
+
+	static size_t slot_index (uint64_t tick_a, size_t level_a)
+	{
+		return static_cast<size_t> ((tick_a >> (bits * level_a)) & (slots_per_level - 1));
+	}
+
+	void place (uint64_t tick_a, T value_a)
+	{
+		debug_assert (tick_a >= current);
+		// Deadlines past the span of the top level wait in its furthest slot and are placed again when it cascades
+		auto const slot_tick (std::min (tick_a, current + (uint64_t (1) << (bits * levels)) - 1));
+		size_t level (0);
+		while (level < levels - 1 && slot_tick - current >= (uint64_t (1) << (bits * (level + 1))))
+		{
+			++level;
+		}
+		slots[level][slot_index (slot_tick, level)].emplace_back (tick_a, std::move (value_a));
+	}
+
+	std::chrono::steady_clock::duration const resolution;
+	std::chrono::steady_clock::time_point const start;
+	uint64_t current{ 0 };
+	size_t count{ 0 };
+	std::array<std::array<std::vector<std::pair<uint64_t, T>>, slots_per_level>, levels> slots;
+};
+}
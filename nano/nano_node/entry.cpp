@@ -20,8 +20,6 @@
 #include <numeric>
 #include <sstream>
 
-#include <argon2.h>
-
 // Some builds (mac) fail due to "Boost.Stacktrace requires `_Unwind_Backtrace` function".
 #ifndef _WIN32
 #ifdef NANO_STACKTRACE_BACKTRACE
@@ -83,7 +81,7 @@ int main (int argc, char * const * argv)
 		("debug_profile_generate", "Profile work generation")
 		("debug_profile_validate", "Profile work validation")
 		("debug_opencl", "OpenCL work generation")
-		("debug_profile_kdf", "Profile kdf function")
+		("debug_profile_kdf", "Profile kdf function, <threads> sets the number of concurrent derivations")
 		("debug_output_last_backtrace_dump", "Displays the contents of the latest backtrace in the event of a nano_node crash")
 		("debug_generate_crash_report", "Consolidates the nano_node_backtrace.dump file. Requires addr2line installed on Linux")
 		("debug_sys_logging", "Test the system logger")
@@ -91,8 +89,9 @@ int main (int argc, char * const * argv)
 		("debug_verify_profile_batch", "Profile batch signature verification")
 		("debug_profile_bootstrap", "Profile bootstrap style blocks processing (at least 10GB of free storage space required)")
 		("debug_profile_sign", "Profile signature generation")
+		("debug_profile_stats", "Profile stat counter updates, <threads> sets the number of updating threads (default 16)")
 		("debug_profile_process", "Profile active blocks processing (only for nano_dev_network)")
-		("debug_profile_votes", "Profile votes processing (only for nano_dev_network)")
+		("debug_profile_votes", "Profile votes processing (only for nano_dev_network), <count> sets the number of representatives voting on each election (default 25)")
 		("debug_profile_frontiers_confirmation", "Profile frontiers confirmation speed (only for nano_dev_network)")
 		("debug_random_feed", "Generates output to RNG test suites")
 		("debug_rpc", "Read an RPC command from stdin and invoke it. Network operations will have no effect.")
@@ -421,14 +420,14 @@ int main (int argc, char * const * argv)
 			}
 
 			// Check all unchecked keys for matching frontier hashes. Indicates an issue with process_batch algorithm
-			for (auto i (node->store.unchecked_begin (transaction)), n (node->store.unchecked_end ()); i != n; ++i)
-			{
-				auto it = frontier_hashes.find (i->first.key ());
+			node->unchecked.for_each (transaction, nano::unchecked_key (0, 0), [&frontier_hashes](nano::unchecked_key const & key, nano::unchecked_info const &) {
+				auto it = frontier_hashes.find (key.key ());
 				if (it != frontier_hashes.cend ())
 				{
 					std::cout << it->to_string () << "\n";
 				}
-			}
+				return true;
+			});
 		}
 		else if (vm.count ("debug_account_count"))
 		{
@@ -440,17 +439,36 @@ int main (int argc, char * const * argv)
 		}
 		else if (vm.count ("debug_profile_kdf"))
 		{
-			nano::network_params network_params;
-			nano::uint256_union result;
-			nano::uint256_union salt (0);
-			std::string password ("");
+			unsigned threads_count (1);
+			auto threads_it = vm.find ("threads");
+			if (threads_it != vm.end ())
+			{
+				if (!boost::conversion::try_lexical_convert (threads_it->second.as<std::string> (), threads_count))
+				{
+					std::cerr << "Invalid threads count\n";
+					return -1;
+				}
+			}
+			threads_count = std::max (1u, threads_count);
+			// Simulates unlocking <threads> wallets at once, each with its own salt
+			nano::kdf kdf (threads_count);
+			std::vector<nano::uint256_union> salts (threads_count);
 			while (true)
 			{
+				for (auto & salt : salts)
+				{
+					nano::random_pool::generate_block (salt.bytes.data (), salt.bytes.size ());
+				}
 				auto begin1 (std::chrono::high_resolution_clock::now ());
-				auto success (argon2_hash (1, network_params.kdf_work, 1, password.data (), password.size (), salt.bytes.data (), salt.bytes.size (), result.bytes.data (), result.bytes.size (), NULL, 0, Argon2_d, 0x10));
-				(void)success;
+				kdf.precompute (salts);
 				auto end1 (std::chrono::high_resolution_clock::now ());
-				std::cerr << boost::str (boost::format ("Derivation time: %1%us\n") % std::chrono::duration_cast<std::chrono::microseconds> (end1 - begin1).count ());
+				for (auto & salt : salts)
+				{
+					nano::raw_key result;
+					kdf.phs (result, "", salt);
+				}
+				auto time (std::chrono::duration_cast<std::chrono::microseconds> (end1 - begin1).count ());
+				std::cerr << boost::str (boost::format ("Derivation time: %1%us for %2% concurrent derivations, %3% derivations/s\n") % time % threads_count % (threads_count * 1000000.0 / std::max<decltype (time)> (1, time)));
 			}
 		}
 		else if (vm.count ("debug_profile_generate"))
@@ -885,6 +903,44 @@ int main (int argc, char * const * argv)
 				std::cerr << boost::str (boost::format ("%|1$ 12d|\n") % std::chrono::duration_cast<std::chrono::microseconds> (end1 - begin1).count ());
 			}
 		}
+		else if (vm.count ("debug_profile_stats"))
+		{
+			unsigned threads_count (16);
+			auto threads_it = vm.find ("threads");
+			if (threads_it != vm.end ())
+			{
+				if (!boost::conversion::try_lexical_convert (threads_it->second.as<std::string> (), threads_count))
+				{
+					std::cerr << "Invalid threads count\n";
+					return -1;
+				}
+			}
+			threads_count = std::max (1u, threads_count);
+			std::cerr << boost::str (boost::format ("Starting stat counter profiling with %1% threads\n") % threads_count);
+			nano::stat stats;
+			uint64_t const iterations (1000000);
+			while (true)
+			{
+				std::vector<std::thread> threads;
+				auto begin1 (std::chrono::high_resolution_clock::now ());
+				for (unsigned i (0); i < threads_count; ++i)
+				{
+					threads.emplace_back ([&stats, iterations]() {
+						for (uint64_t j (0); j < iterations; ++j)
+						{
+							stats.inc (nano::stat::type::message, nano::stat::detail::publish, nano::stat::dir::in);
+						}
+					});
+				}
+				for (auto & thread : threads)
+				{
+					thread.join ();
+				}
+				auto end1 (std::chrono::high_resolution_clock::now ());
+				auto time (std::chrono::duration_cast<std::chrono::nanoseconds> (end1 - begin1).count ());
+				std::cerr << boost::str (boost::format ("%1% increments in %2%us, %3%ns per increment per thread\n") % (threads_count * iterations) % (time / 1000) % (time / static_cast<double> (iterations)));
+			}
+		}
 		else if (vm.count ("debug_profile_process"))
 		{
 			nano::network_constants::set_active_network (nano::nano_networks::nano_dev_network);
@@ -991,7 +1047,7 @@ int main (int argc, char * const * argv)
 				if (timer_l.after_deadline (std::chrono::seconds (15)))
 				{
 					timer_l.restart ();
-					std::cout << boost::str (boost::format ("%1% (%2%) blocks processed (unchecked), %3% remaining") % node->ledger.cache.block_count % node->store.unchecked_count (node->store.tx_begin_read ()) % node->block_processor.size ()) << std::endl;
+					std::cout << boost::str (boost::format ("%1% (%2%) blocks processed (unchecked), %3% remaining") % node->ledger.cache.block_count % node->unchecked.count (node->store.tx_begin_read ()) % node->block_processor.size ()) << std::endl;
 				}
 			}
 
@@ -1007,9 +1063,19 @@ int main (int argc, char * const * argv)
 			nano::network_constants::set_active_network (nano::nano_networks::nano_dev_network);
 			nano::network_params dev_params;
 			nano::block_builder builder;
-			size_t num_elections (40000);
 			size_t num_representatives (25);
-			size_t max_votes (num_elections * num_representatives); // 40,000 * 25 = 1,000,000 votes
+			auto count_it = vm.find ("count");
+			if (count_it != vm.end ())
+			{
+				if (!boost::conversion::try_lexical_convert (count_it->second.as<std::string> (), num_representatives) || num_representatives == 0)
+				{
+					std::cerr << "Invalid count\n";
+					return -1;
+				}
+			}
+			// Around 1,000,000 votes, more representatives means fewer elections with more votes each
+			size_t num_elections (std::max<size_t> (1, 1000000 / num_representatives));
+			size_t max_votes (num_elections * num_representatives);
 			std::cerr << boost::str (boost::format ("Starting pregenerating %1% votes\n") % max_votes);
 			nano::node_flags node_flags;
 			nano::update_flags (node_flags, vm);
@@ -1108,7 +1174,7 @@ int main (int argc, char * const * argv)
 			auto end (std::chrono::high_resolution_clock::now ());
 			auto time (std::chrono::duration_cast<std::chrono::microseconds> (end - begin).count ());
 			node->stop ();
-			std::cerr << boost::str (boost::format ("%|1$ 12d| us \n%2% votes per second\n") % time % (max_votes * 1000000 / time));
+			std::cerr << boost::str (boost::format ("%|1$ 12d| us \n%2% votes per second with %3% representatives\n") % time % (max_votes * 1000000 / time) % num_representatives);
 		}
 		else if (vm.count ("debug_profile_frontiers_confirmation"))
 		{
@@ -1845,7 +1911,7 @@ int main (int argc, char * const * argv)
 				if (timer_l.after_deadline (std::chrono::seconds (60)))
 				{
 					timer_l.restart ();
-					std::cout << boost::str (boost::format ("%1% (%2%) blocks processed (unchecked)") % node.node->ledger.cache.block_count % node.node->store.unchecked_count (node.node->store.tx_begin_read ())) << std::endl;
+					std::cout << boost::str (boost::format ("%1% (%2%) blocks processed (unchecked)") % node.node->ledger.cache.block_count % node.node->unchecked.count (node.node->store.tx_begin_read ())) << std::endl;
 				}
 			}
 
@@ -10,6 +10,7 @@
 #include <boost/format.hpp>
 #include <boost/variant/get.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 using namespace std::chrono;
@@ -17,6 +18,7 @@ using namespace std::chrono;
 size_t constexpr nano::active_transactions::max_active_elections_frontier_insertion;
 
 constexpr std::chrono::minutes nano::active_transactions::expired_optimistic_election_info_cutoff;
+constexpr std::chrono::steady_clock::time_point nano::active_transactions::deferred_deadline;
 
 nano::active_transactions::active_transactions (nano::node & node_a, nano::confirmation_height_processor & confirmation_height_processor_a) :
 confirmation_height_processor (confirmation_height_processor_a),
@@ -27,6 +29,8 @@ generator (node_a.config, node_a.ledger, node_a.wallets, node_a.vote_processor,
 check_all_elections_period (node_a.network_params.network.is_dev_network () ? 10ms : 5s),
 election_time_to_live (node_a.network_params.network.is_dev_network () ? 0s : 2s),
 prioritized_cutoff (std::max<size_t> (1, node_a.config.active_elections_size / 10)),
+transition_timers_resolution (std::max (1u, node_a.network_params.network.request_interval_ms / 4)),
+transition_timers (transition_timers_resolution),
 thread ([this]() {
 	nano::thread_role::set (nano::thread_role::name::request_loop);
 	request_loop ();
@@ -283,56 +287,156 @@ void nano::active_transactions::request_confirm (nano::unique_lock<nano::mutex>
 {
 	debug_assert (lock_a.owns_lock ());
 
-	bool const check_all_elections_l (std::chrono::steady_clock::now () - last_check_all_elections > check_all_elections_period);
-	size_t const this_loop_target_l (check_all_elections_l ? roots.size () : prioritized_cutoff);
-	auto const elections_l{ list_active_impl (this_loop_target_l) };
-
-	lock_a.unlock ();
-
-	nano::confirmation_solicitor solicitor (node.network, node.config);
-	solicitor.prepare (node.rep_crawler.principal_representatives (std::numeric_limits<size_t>::max ()));
-	nano::vote_generator_session generator_session (generator);
-
-	auto const election_ttl_cutoff_l (std::chrono::steady_clock::now () - election_time_to_live);
-	size_t unconfirmed_count_l (0);
-	nano::timer<std::chrono::milliseconds> elapsed (nano::timer_state::started);
-
-	auto const is_watched = [watched = node.wallets.watcher->list_watched ()](nano::qualified_root const & root_a) -> bool {
-		return watched.find (root_a) != watched.end ();
-	};
+	auto const now_l (std::chrono::steady_clock::now ());
+	bool const check_all_elections_l (now_l - last_check_all_elections > check_all_elections_period);
 
 	/*
-	 * Loop through active elections in descending order of proof-of-work difficulty, requesting confirmation
+	 * Periodically walk elections in descending order of proof-of-work difficulty
 	 *
-	 * Only up to a certain amount of elections are queued for confirmation request and block rebroadcasting. The remaining elections can still be confirmed if votes arrive
+	 * Elections within the first prioritized_cutoff unconfirmed ones are prioritized
 	 * Elections extending the soft config.active_elections_size limit are flushed after a certain time-to-live cutoff
 	 * Flushed elections are later re-activated via frontier confirmation
 	 */
-	for (auto const & election_l : elections_l)
+	std::vector<std::shared_ptr<nano::election>> prioritize_l;
+	std::unordered_set<std::shared_ptr<nano::election>> overflow_l;
+	size_t unconfirmed_count_l (0);
+	if (check_all_elections_l)
 	{
-		bool const confirmed_l (election_l->confirmed ());
+		auto const election_ttl_cutoff_l (now_l - election_time_to_live);
+		// Deferred elections are found again by the walk, which also drops erased ones and updates their difficulty
+		deferred.clear ();
+		for (auto const & info_l : roots.get<tag_difficulty> ())
+		{
+			auto const & election_l (info_l.election);
+			if (!election_l->prioritized () && unconfirmed_count_l < prioritized_cutoff)
+			{
+				prioritize_l.push_back (election_l);
+			}
+			unconfirmed_count_l += !election_l->confirmed ();
+			if (unconfirmed_count_l > node.config.active_elections_size && election_l->election_start < election_ttl_cutoff_l && !node.wallets.watcher->is_watched (election_l->qualified_root))
+			{
+				overflow_l.insert (election_l);
+			}
+			else if (election_l->transition_deadline == std::chrono::steady_clock::time_point::max () || election_l->transition_deadline == deferred_deadline)
+			{
+				election_l->transition_deadline = deferred_deadline;
+				deferred.emplace_hint (deferred.end (), info_l.multiplier, election_l);
+			}
+		}
+	}
 
-		if (!election_l->prioritized () && unconfirmed_count_l < prioritized_cutoff)
+	/*
+	 * Only elections whose next transition is due are visited. Elections which changed state outside of the request loop are due immediately
+	 * Timers left behind by erased, expedited or deferred elections are skipped, the deadline of a visited election is reset until it is rescheduled
+	 * Expedited elections are visited when deferred too, which leaves their deferred entry stale
+	 */
+	std::vector<std::pair<double, std::shared_ptr<nano::election>>> due_elections_l;
+	auto visit = [this, &due_elections_l, &overflow_l](nano::qualified_root const & root_a, boost::optional<std::chrono::steady_clock::time_point> const & deadline_a) {
+		auto existing (roots.get<tag_root> ().find (root_a));
+		if (existing != roots.get<tag_root> ().end () && overflow_l.count (existing->election) == 0)
 		{
-			election_l->prioritize (generator_session);
+			auto & deadline_l (existing->election->transition_deadline);
+			if (deadline_a ? deadline_l == *deadline_a : deadline_l != std::chrono::steady_clock::time_point::max ())
+			{
+				deadline_l = std::chrono::steady_clock::time_point::max ();
+				due_elections_l.emplace_back (existing->multiplier, existing->election);
+			}
 		}
+	};
+	decltype (expedited) expedited_l;
+	{
+		nano::lock_guard<nano::mutex> guard (expedited_mutex);
+		expedited_l.swap (expedited);
+	}
+	for (auto const & root_l : expedited_l)
+	{
+		visit (root_l, boost::none);
+	}
+	std::vector<transition_timer> due_l;
+	transition_timers.advance (now_l, due_l);
+	for (auto const & timer_l : due_l)
+	{
+		visit (timer_l.root, timer_l.deadline);
+	}
 
-		unconfirmed_count_l += !confirmed_l;
-		bool const overflow_l (unconfirmed_count_l > node.config.active_elections_size && election_l->election_start < election_ttl_cutoff_l && !is_watched (election_l->qualified_root));
-		if (overflow_l || election_l->transition_time (solicitor))
+	/*
+	 * Due elections are visited in descending order of difficulty so the limited requests and broadcasts of the solicitor go to the highest first
+	 * Visits per pass are capped, elections left over wait in the deferred queue and are merged with the due elections of the next passes
+	 */
+	std::sort (due_elections_l.begin (), due_elections_l.end (), [](auto const & a, auto const & b) { return a.first > b.first; });
+	size_t const visit_max_l (prioritized_cutoff + expedited_l.size ());
+	std::vector<std::shared_ptr<nano::election>> elections_l;
+	auto due_i (due_elections_l.cbegin ());
+	auto const due_n (due_elections_l.cend ());
+	while (elections_l.size () < visit_max_l && (due_i != due_n || !deferred.empty ()))
+	{
+		if (due_i != due_n && (deferred.empty () || due_i->first >= deferred.begin ()->first))
+		{
+			elections_l.push_back (due_i->second);
+			++due_i;
+		}
+		else
 		{
-			if (election_l->optimistic () && election_l->failed ())
+			auto election_l (deferred.begin ()->second);
+			deferred.erase (deferred.begin ());
+			auto existing (roots.get<tag_root> ().find (election_l->qualified_root));
+			if (existing != roots.get<tag_root> ().end () && existing->election == election_l && election_l->transition_deadline == deferred_deadline && overflow_l.count (election_l) == 0)
 			{
-				if (election_l->confirmation_request_count != 0)
-				{
-					// Locks active mutex
-					add_expired_optimistic_election (*election_l);
-				}
-				--optimistic_elections_count;
+				election_l->transition_deadline = std::chrono::steady_clock::time_point::max ();
+				elections_l.push_back (election_l);
+			}
+		}
+	}
+	for (; due_i != due_n; ++due_i)
+	{
+		due_i->second->transition_deadline = deferred_deadline;
+		deferred.emplace (due_i->first, due_i->second);
+	}
+	size_t const checked_count_l (check_all_elections_l ? roots.size () : 0);
+
+	lock_a.unlock ();
+
+	nano::confirmation_solicitor solicitor (node.network, node.config);
+	solicitor.prepare (node.rep_crawler.principal_representatives_snapshot ());
+	nano::vote_generator_session generator_session (generator);
+	nano::timer<std::chrono::milliseconds> elapsed (nano::timer_state::started);
+
+	for (auto const & election_l : prioritize_l)
+	{
+		election_l->prioritize (generator_session);
+	}
+
+	auto expire = [this](nano::election & election_a) {
+		if (election_a.optimistic () && election_a.failed ())
+		{
+			if (election_a.confirmation_request_count != 0)
+			{
+				// Locks active mutex
+				add_expired_optimistic_election (election_a);
 			}
+			--optimistic_elections_count;
+		}
 
-			// Locks active mutex, cleans up the election and erases it from the main container
-			erase (election_l->qualified_root);
+		// Locks active mutex, cleans up the election and erases it from the main container
+		erase (election_a.qualified_root);
+	};
+
+	for (auto const & election_l : overflow_l)
+	{
+		expire (*election_l);
+	}
+
+	std::vector<std::pair<std::shared_ptr<nano::election>, std::chrono::steady_clock::time_point>> reschedule_l;
+	reschedule_l.reserve (elections_l.size ());
+	for (auto const & election_l : elections_l)
+	{
+		if (election_l->transition_time (solicitor))
+		{
+			expire (*election_l);
+		}
+		else
+		{
+			reschedule_l.emplace_back (election_l, election_l->next_transition ());
 		}
 	}
 
@@ -340,17 +444,54 @@ void nano::active_transactions::request_confirm (nano::unique_lock<nano::mutex>
 	generator_session.flush ();
 	lock_a.lock ();
 
+	for (auto const & [election_l, deadline_l] : reschedule_l)
+	{
+		if (deadline_l <= now_l)
+		{
+			// Still due, for instance because the solicitor could not take its requests. Retried by difficulty on the next pass
+			auto existing (roots.get<tag_root> ().find (election_l->qualified_root));
+			if (existing != roots.get<tag_root> ().end () && existing->election == election_l && election_l->transition_deadline == std::chrono::steady_clock::time_point::max ())
+			{
+				election_l->transition_deadline = deferred_deadline;
+				deferred.emplace (existing->multiplier, election_l);
+			}
+		}
+		else
+		{
+			schedule_transition (*election_l, deadline_l);
+		}
+	}
+
+	node.stats.inc (nano::stat::type::election, nano::stat::detail::transition_pass);
+	node.stats.add (nano::stat::type::election, nano::stat::detail::transition_visit, nano::stat::dir::in, elections_l.size ());
+
 	// This is updated after the loop to ensure slow machines don't do the full check often
 	if (check_all_elections_l)
 	{
 		last_check_all_elections = std::chrono::steady_clock::now ();
-		if (node.config.logging.timing_logging () && this_loop_target_l > prioritized_cutoff)
+		if (node.config.logging.timing_logging () && checked_count_l > prioritized_cutoff)
 		{
-			node.logger.try_log (boost::str (boost::format ("Processed %1% elections (%2% were already confirmed) in %3% %4%") % this_loop_target_l % (this_loop_target_l - unconfirmed_count_l) % elapsed.value ().count () % elapsed.unit ()));
+			node.logger.try_log (boost::str (boost::format ("Checked %1% elections (%2% were already confirmed) and visited %3% due elections in %4% %5%") % checked_count_l % (checked_count_l - unconfirmed_count_l) % elections_l.size () % elapsed.value ().count () % elapsed.unit ()));
 		}
 	}
 }
 
+void nano::active_transactions::schedule_transition (nano::election & election_a, std::chrono::steady_clock::time_point deadline_a)
+{
+	// Mutex must be locked. Only the earliest timer of an election is kept valid, scheduling a deferred election leaves its deferred entry stale
+	if (deadline_a < election_a.transition_deadline || election_a.transition_deadline == deferred_deadline)
+	{
+		election_a.transition_deadline = deadline_a;
+		transition_timers.insert (deadline_a, { election_a.qualified_root, deadline_a });
+	}
+}
+
+void nano::active_transactions::expedite (nano::qualified_root const & root_a)
+{
+	nano::lock_guard<nano::mutex> guard (expedited_mutex);
+	expedited.push_back (root_a);
+}
+
 void nano::active_transactions::cleanup_election (nano::unique_lock<nano::mutex> & lock_a, nano::election_cleanup_info const & info_a)
 {
 	debug_assert (lock_a.owns_lock ());
@@ -833,6 +974,7 @@ nano::election_insertion_result nano::active_transactions::insert_impl (nano::un
 				prioritized, election_behavior_a);
 				roots.get<tag_root> ().emplace (nano::active_transactions::conflict_info{ root, multiplier, result.election, epoch, previous_balance });
 				blocks.emplace (hash, result.election);
+				schedule_transition (*result.election, std::chrono::steady_clock::now ());
 				auto const cache = find_inactive_votes_cache_impl (hash);
 				lock_a.unlock ();
 				result.election->insert_inactive_votes_cache (cache);
@@ -1560,6 +1702,8 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (ac
 	size_t blocks_count;
 	size_t recently_confirmed_count;
 	size_t recently_cemented_count;
+	size_t transition_timers_count;
+	size_t deferred_count;
 
 	{
 		nano::lock_guard<nano::mutex> guard (active_transactions.mutex);
@@ -1567,11 +1711,15 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (ac
 		blocks_count = active_transactions.blocks.size ();
 		recently_confirmed_count = active_transactions.recently_confirmed.size ();
 		recently_cemented_count = active_transactions.recently_cemented.size ();
+		transition_timers_count = active_transactions.transition_timers.size ();
+		deferred_count = active_transactions.deferred.size ();
 	}
 
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "roots", roots_count, sizeof (decltype (active_transactions.roots)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "blocks", blocks_count, sizeof (decltype (active_transactions.blocks)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "transition_timers", transition_timers_count, sizeof (nano::active_transactions::transition_timer) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "deferred", deferred_count, sizeof (decltype (active_transactions.deferred)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "election_winner_details", active_transactions.election_winner_details_size (), sizeof (decltype (active_transactions.election_winner_details)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "recently_confirmed", recently_confirmed_count, sizeof (decltype (active_transactions.recently_confirmed)::value_type) }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "recently_cemented", recently_cemented_count, sizeof (decltype (active_transactions.recently_cemented)::value_type) }));
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/timing_wheel.hpp>
 #include <nano/node/election.hpp>
 #include <nano/node/voting.hpp>
 #include <nano/secure/common.hpp>
@@ -17,6 +18,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -126,6 +128,13 @@ class active_transactions final
 		nano::uint128_t previous_balance;
 	};
 
+	class transition_timer final
+	{
+	public:
+		nano::qualified_root root;
+		std::chrono::steady_clock::time_point deadline;
+	};
+
 	friend class nano::election;
 
 	// clang-format off
@@ -215,6 +224,8 @@ public:
 	size_t election_winner_details_size ();
 	void add_election_winner_details (nano::block_hash const &, std::shared_ptr<nano::election> const &);
 	void remove_election_winner_details (nano::block_hash const &);
+	// Makes the election with root \p root_a due on the next request loop pass, used when its state changes outside of the loop
+	void expedite (nano::qualified_root const &);
 
 	nano::vote_generator generator;
 
@@ -266,6 +277,17 @@ private:
 	// Elections above this position in the queue are prioritized
 	size_t const prioritized_cutoff;
 
+	// Elections by the time their next transition is due, only those are visited by request_confirm
+	std::chrono::milliseconds const transition_timers_resolution;
+	nano::timing_wheel<transition_timer> transition_timers;
+	void schedule_transition (nano::election &, std::chrono::steady_clock::time_point);
+	nano::mutex expedited_mutex;
+	std::vector<nano::qualified_root> expedited;
+	// Due elections left over by a pass, by descending difficulty. Retried ahead of easier due elections instead of going through the timers each tick
+	std::multimap<double, std::shared_ptr<nano::election>, std::greater<double>> deferred;
+	// Transition deadline of deferred elections. Expedited elections are still visited, entries in deferred are stale once the deadline changes
+	static std::chrono::steady_clock::time_point constexpr deferred_deadline{ std::chrono::steady_clock::time_point::min () };
+
 	static size_t constexpr recently_confirmed_size{ 65536 };
 	using recent_confirmation = std::pair<nano::qualified_root, nano::block_hash>;
 	// clang-format off
@@ -332,6 +354,8 @@ private:
 	friend std::unique_ptr<container_info_component> collect_container_info (active_transactions &, const std::string &);
 
 	friend class active_transactions_vote_replays_Test;
+	friend class active_transactions_transition_timers_Test;
+	friend class active_transactions_transition_timers_saturated_Test;
 	friend class frontiers_confirmation_prioritize_frontiers_Test;
 	friend class frontiers_confirmation_prioritize_frontiers_max_optimistic_elections_Test;
 	friend class confirmation_height_prioritize_frontiers_overwrite_Test;
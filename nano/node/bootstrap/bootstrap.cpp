@@ -1,4 +1,5 @@
 #include <nano/lib/threading.hpp>
+#include <nano/node/bootstrap/bootstrap_ascending.hpp>
 #include <nano/node/bootstrap/bootstrap.hpp>
 #include <nano/node/bootstrap/bootstrap_lazy.hpp>
 #include <nano/node/bootstrap/bootstrap_legacy.hpp>
@@ -38,7 +39,19 @@ void nano::bootstrap_initiator::bootstrap (bool force, std::string id_a, uint32_
 		stop_attempts ();
 	}
 	nano::unique_lock<nano::mutex> lock (mutex);
-	if (!stopped && find_attempt (nano::bootstrap_mode::legacy) == nullptr)
+	if (!stopped && node.config.bootstrap_ascending && frontiers_age_a == std::numeric_limits<uint32_t>::max ())
+	{
+		if (find_attempt (nano::bootstrap_mode::ascending) == nullptr && find_attempt (nano::bootstrap_mode::legacy) == nullptr)
+		{
+			node.stats.inc (nano::stat::type::bootstrap, nano::stat::detail::initiate_ascending, nano::stat::dir::out);
+			auto ascending_attempt (std::make_shared<nano::bootstrap_attempt_ascending> (node.shared (), attempts.incremental++, id_a));
+			attempts_list.push_back (ascending_attempt);
+			attempts.add (ascending_attempt);
+			lock.unlock ();
+			condition.notify_all ();
+		}
+	}
+	else if (!stopped && find_attempt (nano::bootstrap_mode::legacy) == nullptr && find_attempt (nano::bootstrap_mode::ascending) == nullptr)
 	{
 		node.stats.inc (nano::stat::type::bootstrap, frontiers_age_a == std::numeric_limits<uint32_t>::max () ? nano::stat::detail::initiate : nano::stat::detail::initiate_legacy_age, nano::stat::dir::out);
 		auto legacy_attempt (std::make_shared<nano::bootstrap_attempt_legacy> (node.shared (), attempts.incremental++, id_a, frontiers_age_a));
@@ -233,7 +246,13 @@ bool nano::bootstrap_initiator::has_new_attempts ()
 std::shared_ptr<nano::bootstrap_attempt> nano::bootstrap_initiator::current_attempt ()
 {
 	nano::lock_guard<nano::mutex> lock (mutex);
-	return find_attempt (nano::bootstrap_mode::legacy);
+	// Legacy and ascending attempts never run together
+	auto result (find_attempt (nano::bootstrap_mode::legacy));
+	if (result == nullptr)
+	{
+		result = find_attempt (nano::bootstrap_mode::ascending);
+	}
+	return result;
 }
 
 std::shared_ptr<nano::bootstrap_attempt> nano::bootstrap_initiator::current_lazy_attempt ()
@@ -306,6 +325,11 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (bo
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "observers", count, sizeof_element }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "pulls_cache", cache_count, sizeof_cache_element }));
+	composite->add_component (collect_container_info (bootstrap_initiator.connections->peer_scores, "peer_scores"));
+	if (auto lazy_attempt = std::dynamic_pointer_cast<nano::bootstrap_attempt_lazy> (bootstrap_initiator.current_lazy_attempt ()))
+	{
+		composite->add_component (collect_container_info (*lazy_attempt, "lazy_attempt"));
+	}
 	return composite;
 }
 
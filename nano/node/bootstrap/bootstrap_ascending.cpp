@@ -0,0 +1,274 @@
+#include <nano/crypto_lib/random_pool.hpp>
+#include <nano/node/bootstrap/bootstrap_ascending.hpp>
+#include <nano/node/bootstrap/bootstrap_frontier.hpp>
+#include <nano/node/node.hpp>
+
+#include <boost/format.hpp>
+#include <boost/optional.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+
+constexpr uint32_t nano::bootstrap_attempt_ascending::range_count;
+constexpr uint32_t nano::bootstrap_attempt_ascending::frontiers_per_request;
+
+namespace
+{
+nano::uint256_t range_width ()
+{
+	return std::numeric_limits<nano::uint256_t>::max () / nano::bootstrap_attempt_ascending::range_count + 1;
+}
+}
+
+nano::bootstrap_attempt_ascending::bootstrap_attempt_ascending (std::shared_ptr<nano::node> const & node_a, uint64_t const incremental_id_a, std::string const & id_a) :
+nano::bootstrap_attempt (node_a, nano::bootstrap_mode::ascending, incremental_id_a, id_a)
+{
+	for (uint32_t i (0); i < range_count; ++i)
+	{
+		range range_l;
+		range_l.start = range_width () * i;
+		range_l.end = range_l.start.number () + (range_width () - 1);
+		range_l.next = range_l.start;
+		ranges.push_back (std::move (range_l));
+	}
+}
+
+uint32_t nano::bootstrap_attempt_ascending::range_of (nano::account const & account_a)
+{
+	return static_cast<uint32_t> (account_a.number () / range_width ());
+}
+
+void nano::bootstrap_attempt_ascending::stop ()
+{
+	nano::unique_lock<nano::mutex> lock (mutex);
+	stopped = true;
+	lock.unlock ();
+	condition.notify_all ();
+	lock.lock ();
+	for (auto const & client_w : frontiers)
+	{
+		if (auto client = client_w.lock ())
+		{
+			try
+			{
+				client->promise.set_value (true);
+			}
+			catch (std::future_error &)
+			{
+			}
+		}
+	}
+	lock.unlock ();
+	node->bootstrap_initiator.connections->clear_pulls (incremental_id);
+}
+
+void nano::bootstrap_attempt_ascending::add_frontier (nano::pull_info const & pull_a)
+{
+	// Prevent incorrect or malicious pulls with frontier 0 insertion
+	if (!pull_a.head.is_zero ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		ranges[range_of (pull_a.account_or_head.as_account ())].pulls.push_back (pull_a);
+	}
+}
+
+void nano::bootstrap_attempt_ascending::add_bulk_push_target (nano::block_hash const &, nano::block_hash const &)
+{
+	// Blocks peers are missing are left to their own bootstrap, ranges are requested from several peers so none is pushed to
+}
+
+void nano::bootstrap_attempt_ascending::load_progress (nano::unique_lock<nano::mutex> & lock_a)
+{
+	// The store is read without the attempt mutex, pulls and frontiers arriving meanwhile do not wait for it
+	lock_a.unlock ();
+	std::vector<std::pair<uint32_t, nano::account>> progress;
+	{
+		auto transaction (node->store.tx_begin_read ());
+		for (uint32_t i (0); i < range_count; ++i)
+		{
+			nano::account last;
+			if (!node->store.bootstrap_progress_get (transaction, i, last))
+			{
+				progress.emplace_back (i, last);
+			}
+		}
+	}
+	lock_a.lock ();
+	for (auto const & [index, last] : progress)
+	{
+		auto & range_l (ranges[index]);
+		range_l.done = last == range_l.end;
+		range_l.next = range_l.done ? range_l.end : nano::account (last.number () + 1);
+	}
+}
+
+void nano::bootstrap_attempt_ascending::save_progress (nano::unique_lock<nano::mutex> & lock_a)
+{
+	auto finished_l (finished ());
+	// Last account compared in each range, none for ranges without progress
+	std::vector<boost::optional<nano::account>> progress;
+	for (auto const & range_l : ranges)
+	{
+		if (finished_l || (!range_l.done && range_l.next == range_l.start))
+		{
+			// Completed attempts leave no progress behind so the next one starts over
+			progress.emplace_back (boost::none);
+		}
+		else
+		{
+			progress.emplace_back (range_l.done ? range_l.end : nano::account (range_l.next.number () - 1));
+		}
+	}
+	// Waiting for the write queue can take a whole block processor batch, the attempt mutex is not held meanwhile
+	lock_a.unlock ();
+	{
+		auto scoped_write_guard = node->write_database_queue.wait (nano::writer::bootstrap);
+		auto transaction (node->store.tx_begin_write ({ nano::tables::meta }));
+		for (uint32_t i (0); i < range_count; ++i)
+		{
+			if (progress[i])
+			{
+				node->store.bootstrap_progress_put (transaction, i, *progress[i]);
+			}
+			else
+			{
+				node->store.bootstrap_progress_del (transaction, i);
+			}
+		}
+	}
+	lock_a.lock ();
+}
+
+bool nano::bootstrap_attempt_ascending::finished () const
+{
+	return std::all_of (ranges.begin (), ranges.end (), [](range const & range_a) { return range_a.done; });
+}
+
+void nano::bootstrap_attempt_ascending::request_frontiers (nano::unique_lock<nano::mutex> & lock_a)
+{
+	std::vector<std::pair<uint32_t, std::shared_ptr<nano::frontier_req_client>>> requests;
+	std::vector<std::future<bool>> futures;
+	auto this_l (shared_from_this ());
+	for (uint32_t i (0); i < range_count && !stopped; ++i)
+	{
+		if (!ranges[i].done)
+		{
+			lock_a.unlock ();
+			auto connection_l (node->bootstrap_initiator.connections->connection (this_l));
+			lock_a.lock ();
+			if (connection_l != nullptr && !stopped)
+			{
+				auto client (std::make_shared<nano::frontier_req_client> (connection_l, this_l));
+				client->range_end = ranges[i].end;
+				client->run (ranges[i].next, frontiers_per_request, std::numeric_limits<uint32_t>::max ());
+				frontiers.push_back (client);
+				futures.push_back (client->promise.get_future ());
+				requests.emplace_back (i, client);
+			}
+		}
+	}
+	lock_a.unlock ();
+	std::vector<bool> errors;
+	for (auto & future : futures)
+	{
+		auto error (true);
+		try
+		{
+			error = future.get ();
+		}
+		catch (std::future_error &)
+		{
+		}
+		errors.push_back (error);
+	}
+	lock_a.lock ();
+	frontiers.clear ();
+	std::deque<nano::pull_info> frontier_pulls;
+	for (size_t i (0); i < requests.size (); ++i)
+	{
+		auto & range_l (ranges[requests[i].first]);
+		auto const & client (requests[i].second);
+		if (!errors[i])
+		{
+			frontier_pulls.insert (frontier_pulls.end (), range_l.pulls.begin (), range_l.pulls.end ());
+			range_l.done = client->exhausted || client->last_received == range_l.end;
+			range_l.next = range_l.done ? range_l.end : nano::account (client->last_received.number () + 1);
+		}
+		else
+		{
+			// Pulls of a failed request are found again when the range is requested next round
+			node->stats.inc (nano::stat::type::error, nano::stat::detail::frontier_req, nano::stat::dir::out);
+		}
+		range_l.pulls.clear ();
+	}
+	account_count += nano::narrow_cast<unsigned> (frontier_pulls.size ());
+	// Shuffle pulls so ranges are pulled side by side
+	release_assert (std::numeric_limits<CryptoPP::word32>::max () > frontier_pulls.size ());
+	if (!frontier_pulls.empty ())
+	{
+		for (auto i = static_cast<CryptoPP::word32> (frontier_pulls.size () - 1); i > 0; --i)
+		{
+			auto k = nano::random_pool::generate_word32 (0, i);
+			std::swap (frontier_pulls[i], frontier_pulls[k]);
+		}
+	}
+	lock_a.unlock ();
+	for (auto const & pull : frontier_pulls)
+	{
+		node->bootstrap_initiator.connections->add_pull (pull);
+		++pulling;
+	}
+	lock_a.lock ();
+}
+
+void nano::bootstrap_attempt_ascending::run ()
+{
+	debug_assert (started);
+	node->bootstrap_initiator.connections->populate_connections (false);
+	nano::unique_lock<nano::mutex> lock (mutex);
+	load_progress (lock);
+	while (!stopped && !finished ())
+	{
+		request_frontiers (lock);
+		frontiers_received = true;
+		while (still_pulling ())
+		{
+			while (still_pulling ())
+			{
+				condition.wait (lock, [& stopped = stopped, &pulling = pulling] { return stopped || pulling == 0; });
+			}
+			// Flushing may resolve forks which can add more pulls
+			lock.unlock ();
+			node->block_processor.flush ();
+			lock.lock ();
+		}
+		if (!stopped)
+		{
+			// Blocks of every account compared this round are processed, later rounds do not need to see these accounts again
+			save_progress (lock);
+			++rounds;
+			if (node->config.logging.network_logging ())
+			{
+				node->logger.try_log (boost::str (boost::format ("Completed ascending bootstrap round %1%, %2% of %3% account ranges done") % rounds % std::count_if (ranges.begin (), ranges.end (), [](range const & range_a) { return range_a.done; }) % range_count));
+			}
+		}
+	}
+	if (!stopped)
+	{
+		node->logger.try_log ("Completed ascending pulls");
+		node->unchecked_cleanup ();
+	}
+	lock.unlock ();
+	stop ();
+	condition.notify_all ();
+}
+
+void nano::bootstrap_attempt_ascending::get_information (boost::property_tree::ptree & tree_a)
+{
+	nano::lock_guard<nano::mutex> lock (mutex);
+	tree_a.put ("ranges", std::to_string (ranges.size ()));
+	tree_a.put ("ranges_done", std::to_string (std::count_if (ranges.begin (), ranges.end (), [](range const & range_a) { return range_a.done; })));
+	tree_a.put ("rounds", std::to_string (rounds));
+	tree_a.put ("frontier_requests", std::to_string (frontiers.size ()));
+	tree_a.put ("out_of_sync_accounts", std::to_string (account_count));
+}
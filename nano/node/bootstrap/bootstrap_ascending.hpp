@@ -0,0 +1,60 @@
+#pragma once
+
+#include <nano/node/bootstrap/bootstrap_attempt.hpp>
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace nano
+{
+class node;
+class frontier_req_client;
+
+/**
+ * Full bootstrap which splits the account space into range_count ranges of ascending accounts.
+ * Each round requests the next frontiers_per_request frontiers of every unfinished range at once, each range from its own
+ * connection, and pulls the accounts found out of sync. Once the pulled blocks are processed the last account compared in
+ * each range is written to the store, so a restarted node resumes the ranges where they stopped.
+ */
+class bootstrap_attempt_ascending final : public bootstrap_attempt
+{
+public:
+	explicit bootstrap_attempt_ascending (std::shared_ptr<nano::node> const & node_a, uint64_t const incremental_id_a, std::string const & id_a = "");
+	void run () override;
+	void stop () override;
+	void add_frontier (nano::pull_info const &) override;
+	void add_bulk_push_target (nano::block_hash const &, nano::block_hash const &) override;
+	void get_information (boost::property_tree::ptree &) override;
+	class range final
+	{
+	public:
+		nano::account start;
+		/** Last account of the range */
+		nano::account end;
+		/** First account of the next frontier request */
+		nano::account next;
+		bool done{ false };
+		/** Pulls found by the frontier request in flight */
+		std::deque<nano::pull_info> pulls;
+	};
+	static uint32_t range_of (nano::account const &);
+	std::vector<range> ranges;
+	/** Frontier requests of the current round */
+	std::vector<std::weak_ptr<nano::frontier_req_client>> frontiers;
+	std::atomic<unsigned> account_count{ 0 };
+	std::atomic<uint64_t> rounds{ 0 };
+	static uint32_t constexpr range_count = 16;
+	static uint32_t constexpr frontiers_per_request = 64 * 1024;
+
+private:
+	void load_progress (nano::unique_lock<nano::mutex> &);
+	void save_progress (nano::unique_lock<nano::mutex> &);
+	/** Runs one frontier request for each unfinished range concurrently and queues the pulls of those which completed */
+	void request_frontiers (nano::unique_lock<nano::mutex> &);
+	bool finished () const;
+};
+}
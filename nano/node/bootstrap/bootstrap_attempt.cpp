@@ -113,6 +113,10 @@ std::string nano::bootstrap_attempt::mode_text ()
 	{
 		mode_text = "wallet_lazy";
 	}
+	else if (mode == nano::bootstrap_mode::ascending)
+	{
+		mode_text = "ascending";
+	}
 	return mode_text;
 }
 
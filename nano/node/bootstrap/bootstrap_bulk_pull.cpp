@@ -13,6 +13,7 @@ head (head_a),
 head_original (head_a),
 end (end_a),
 count (count_a),
+base_count (count_a),
 retry_limit (retry_limit_a),
 bootstrap_id (bootstrap_id_a)
 {
@@ -33,10 +34,16 @@ nano::bulk_pull_client::~bulk_pull_client ()
 {
 	/* If received end block is not expected end block
 	Or if given start and end blocks are from different chains (i.e. forked node or malicious node) */
-	if (expected != pull.end && !expected.is_zero ())
+	auto incomplete (expected != pull.end && !expected.is_zero ());
+	if (request_time != std::chrono::steady_clock::time_point ())
+	{
+		// Empty pulls and unexpected first blocks are routine for lazy pulls started from a link, only network errors count against the peer
+		connection->connections->peer_scores.pull_finished (connection->channel->get_tcp_endpoint (), pull_blocks - unexpected_count, std::chrono::steady_clock::now () - request_time, latency, network_error);
+	}
+	if (incomplete)
 	{
 		pull.head = expected;
-		if (attempt->mode != nano::bootstrap_mode::legacy)
+		if (attempt->mode != nano::bootstrap_mode::legacy && attempt->mode != nano::bootstrap_mode::ascending)
 		{
 			pull.account_or_head = expected;
 		}
@@ -81,6 +88,11 @@ void nano::bulk_pull_client::request ()
 	{
 		connection->node->logger.always_log (boost::str (boost::format ("%1% accounts in pull queue") % attempt->pulling));
 	}
+	if (connection->receive_buffer->size () < receive_buffer_size)
+	{
+		connection->receive_buffer->resize (receive_buffer_size);
+	}
+	request_time = std::chrono::steady_clock::now ();
 	auto this_l (shared_from_this ());
 	connection->channel->send (
 	req, [this_l](boost::system::error_code const & ec, size_t size_a) {
@@ -103,7 +115,7 @@ void nano::bulk_pull_client::request ()
 void nano::bulk_pull_client::throttled_receive_block ()
 {
 	debug_assert (!network_error);
-	if (!connection->node->block_processor.half_full () && !connection->node->block_processor.flushing)
+	if (!throttled ())
 	{
 		receive_block ();
 	}
@@ -119,19 +131,71 @@ void nano::bulk_pull_client::throttled_receive_block ()
 	}
 }
 
+bool nano::bulk_pull_client::throttled () const
+{
+	return connection->node->block_processor.half_full () || connection->node->block_processor.flushing;
+}
+
 void nano::bulk_pull_client::receive_block ()
 {
+	auto const & buffer (*connection->receive_buffer);
+	while (true)
+	{
+		if (receive_begin == receive_end)
+		{
+			receive_more ();
+			return;
+		}
+		nano::block_type type (static_cast<nano::block_type> (buffer[receive_begin]));
+		if (type != nano::block_type::send && type != nano::block_type::receive && type != nano::block_type::open && type != nano::block_type::change && type != nano::block_type::state)
+		{
+			++receive_begin;
+			received_end (type);
+			return;
+		}
+		auto const size (nano::block::size (type));
+		if (receive_end - receive_begin < 1 + size)
+		{
+			receive_more ();
+			return;
+		}
+		nano::bufferstream stream (buffer.data () + receive_begin + 1, size);
+		receive_begin += 1 + size;
+		auto block (nano::deserialize_block (stream, type));
+		if (!received_block (block))
+		{
+			return;
+		}
+		if (throttled ())
+		{
+			throttled_receive_block ();
+			return;
+		}
+	}
+}
+
+void nano::bulk_pull_client::receive_more ()
+{
+	// Keep the partial block at the front and fill the rest of the buffer with whatever the peer sent so far
+	auto & buffer (*connection->receive_buffer);
+	if (receive_begin > 0)
+	{
+		std::copy (buffer.begin () + receive_begin, buffer.begin () + receive_end, buffer.begin ());
+		receive_end -= receive_begin;
+		receive_begin = 0;
+	}
 	auto this_l (shared_from_this ());
-	connection->socket->async_read (connection->receive_buffer, 1, [this_l](boost::system::error_code const & ec, size_t size_a) {
+	connection->socket->async_read_some (connection->receive_buffer, receive_end, buffer.size () - receive_end, [this_l](boost::system::error_code const & ec, size_t size_a) {
 		if (!ec)
 		{
-			this_l->received_type ();
+			this_l->receive_end += size_a;
+			this_l->receive_block ();
 		}
 		else
 		{
 			if (this_l->connection->node->config.logging.bulk_pull_logging ())
 			{
-				this_l->connection->node->logger.try_log (boost::str (boost::format ("Error receiving block type: %1%") % ec.message ()));
+				this_l->connection->node->logger.try_log (boost::str (boost::format ("Error bulk receiving block: %1%") % ec.message ()));
 			}
 			this_l->connection->node->stats.inc (nano::stat::type::bootstrap, nano::stat::detail::bulk_pull_receive_block_failure, nano::stat::dir::in);
 			this_l->network_error = true;
@@ -139,149 +203,91 @@ void nano::bulk_pull_client::receive_block ()
 	});
 }
 
-void nano::bulk_pull_client::received_type ()
+void nano::bulk_pull_client::received_end (nano::block_type type_a)
 {
-	auto this_l (shared_from_this ());
-	nano::block_type type (static_cast<nano::block_type> (connection->receive_buffer->data ()[0]));
-
-	auto const & socket_l = connection->socket;
-	switch (type)
+	if (type_a == nano::block_type::not_a_block)
 	{
-		case nano::block_type::send:
+		// Avoid re-using slow peers, or peers that sent the wrong blocks. Bytes past the end of the pull mean the peer is out of step with the protocol
+		if (!connection->pending_stop && receive_begin == receive_end && (expected == pull.end || (pull.count != 0 && pull.count == pull_blocks)))
 		{
-			socket_l->async_read (connection->receive_buffer, nano::send_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-				this_l->received_block (ec, size_a, type);
-			});
-			break;
+			connection->connections->pool_connection (connection);
 		}
-		case nano::block_type::receive:
+	}
+	else if (connection->node->config.logging.network_packet_logging ())
+	{
+		connection->node->logger.try_log (boost::str (boost::format ("Unknown type received as block type: %1%") % static_cast<int> (type_a)));
+	}
+}
+
+bool nano::bulk_pull_client::received_block (std::shared_ptr<nano::block> const & block)
+{
+	auto result (false);
+	if (block != nullptr && !nano::work_validate_entry (*block))
+	{
+		auto hash (block->hash ());
+		if (connection->node->config.logging.bulk_pull_logging ())
 		{
-			socket_l->async_read (connection->receive_buffer, nano::receive_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-				this_l->received_block (ec, size_a, type);
-			});
-			break;
+			std::string block_l;
+			block->serialize_json (block_l, connection->node->config.logging.single_line_record ());
+			connection->node->logger.try_log (boost::str (boost::format ("Pulled block %1% %2%") % hash.to_string () % block_l));
 		}
-		case nano::block_type::open:
+		// Is block expected?
+		bool block_expected (false);
+		// Unconfirmed head is used only for lazy destinations if legacy bootstrap is not available, see nano::bootstrap_attempt::lazy_destinations_increment (...)
+		bool unconfirmed_account_head (connection->node->flags.disable_legacy_bootstrap && pull_blocks == 0 && pull.retry_limit <= connection->node->network_params.bootstrap.lazy_retry_limit && expected == pull.account_or_head && block->account () == pull.account_or_head);
+		if (hash == expected || unconfirmed_account_head)
 		{
-			socket_l->async_read (connection->receive_buffer, nano::open_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-				this_l->received_block (ec, size_a, type);
-			});
-			break;
+			expected = block->previous ();
+			block_expected = true;
 		}
-		case nano::block_type::change:
+		else
 		{
-			socket_l->async_read (connection->receive_buffer, nano::change_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-				this_l->received_block (ec, size_a, type);
-			});
-			break;
+			unexpected_count++;
 		}
-		case nano::block_type::state:
+		if (pull_blocks == 0 && block_expected)
 		{
-			socket_l->async_read (connection->receive_buffer, nano::state_block::size, [this_l, type](boost::system::error_code const & ec, size_t size_a) {
-				this_l->received_block (ec, size_a, type);
-			});
-			break;
+			known_account = block->account ();
 		}
-		case nano::block_type::not_a_block:
+		if (pull_blocks == 0)
 		{
-			// Avoid re-using slow peers, or peers that sent the wrong blocks.
-			if (!connection->pending_stop && (expected == pull.end || (pull.count != 0 && pull.count == pull_blocks)))
-			{
-				connection->connections->pool_connection (connection);
-			}
-			break;
+			latency = std::chrono::steady_clock::now () - request_time;
 		}
-		default:
+		if (connection->block_count++ == 0)
 		{
-			if (connection->node->config.logging.network_packet_logging ())
-			{
-				connection->node->logger.try_log (boost::str (boost::format ("Unknown type received as block type: %1%") % static_cast<int> (type)));
-			}
-			break;
+			connection->set_start_time (std::chrono::steady_clock::now ());
 		}
-	}
-}
-
-void nano::bulk_pull_client::received_block (boost::system::error_code const & ec, size_t size_a, nano::block_type type_a)
-{
-	if (!ec)
-	{
-		nano::bufferstream stream (connection->receive_buffer->data (), size_a);
-		auto block (nano::deserialize_block (stream, type_a));
-		if (block != nullptr && !nano::work_validate_entry (*block))
+		attempt->total_blocks++;
+		bool stop_pull (attempt->process_block (block, known_account, pull_blocks, pull.count, block_expected, pull.retry_limit));
+		pull_blocks++;
+		if (!stop_pull && !connection->hard_stop.load ())
 		{
-			auto hash (block->hash ());
-			if (connection->node->config.logging.bulk_pull_logging ())
-			{
-				std::string block_l;
-				block->serialize_json (block_l, connection->node->config.logging.single_line_record ());
-				connection->node->logger.try_log (boost::str (boost::format ("Pulled block %1% %2%") % hash.to_string () % block_l));
-			}
-			// Is block expected?
-			bool block_expected (false);
-			// Unconfirmed head is used only for lazy destinations if legacy bootstrap is not available, see nano::bootstrap_attempt::lazy_destinations_increment (...)
-			bool unconfirmed_account_head (connection->node->flags.disable_legacy_bootstrap && pull_blocks == 0 && pull.retry_limit <= connection->node->network_params.bootstrap.lazy_retry_limit && expected == pull.account_or_head && block->account () == pull.account_or_head);
-			if (hash == expected || unconfirmed_account_head)
-			{
-				expected = block->previous ();
-				block_expected = true;
-			}
-			else
-			{
-				unexpected_count++;
-			}
-			if (pull_blocks == 0 && block_expected)
-			{
-				known_account = block->account ();
-			}
-			if (connection->block_count++ == 0)
-			{
-				connection->set_start_time (std::chrono::steady_clock::now ());
-			}
-			attempt->total_blocks++;
-			bool stop_pull (attempt->process_block (block, known_account, pull_blocks, pull.count, block_expected, pull.retry_limit));
-			pull_blocks++;
-			if (!stop_pull && !connection->hard_stop.load ())
-			{
-				/* Process block in lazy pull if not stopped
-				Stop usual pull request with unexpected block & more than 16k blocks processed
-				to prevent spam */
-				if (attempt->mode != nano::bootstrap_mode::legacy || unexpected_count < 16384)
-				{
-					throttled_receive_block ();
-				}
-			}
-			else if (stop_pull && block_expected)
-			{
-				connection->connections->pool_connection (connection);
-			}
+			/* Process block in lazy pull if not stopped
+			Stop usual pull request with unexpected block & more than 16k blocks processed
+			to prevent spam */
+			result = (attempt->mode != nano::bootstrap_mode::legacy && attempt->mode != nano::bootstrap_mode::ascending) || unexpected_count < 16384;
 		}
-		else if (block == nullptr)
+		else if (stop_pull && block_expected)
 		{
-			if (connection->node->config.logging.bulk_pull_logging ())
-			{
-				connection->node->logger.try_log ("Error deserializing block received from pull request");
-			}
-			connection->node->stats.inc (nano::stat::type::bootstrap, nano::stat::detail::bulk_pull_deserialize_receive_block, nano::stat::dir::in);
+			connection->connections->pool_connection (connection);
 		}
-		else // Work invalid
+	}
+	else if (block == nullptr)
+	{
+		if (connection->node->config.logging.bulk_pull_logging ())
 		{
-			if (connection->node->config.logging.bulk_pull_logging ())
-			{
-				connection->node->logger.try_log (boost::str (boost::format ("Insufficient work for bulk pull block: %1%") % block->hash ().to_string ()));
-			}
-			connection->node->stats.inc_detail_only (nano::stat::type::error, nano::stat::detail::insufficient_work);
+			connection->node->logger.try_log ("Error deserializing block received from pull request");
 		}
+		connection->node->stats.inc (nano::stat::type::bootstrap, nano::stat::detail::bulk_pull_deserialize_receive_block, nano::stat::dir::in);
 	}
-	else
+	else // Work invalid
 	{
 		if (connection->node->config.logging.bulk_pull_logging ())
 		{
-			connection->node->logger.try_log (boost::str (boost::format ("Error bulk receiving block: %1%") % ec.message ()));
+			connection->node->logger.try_log (boost::str (boost::format ("Insufficient work for bulk pull block: %1%") % block->hash ().to_string ()));
 		}
-		connection->node->stats.inc (nano::stat::type::bootstrap, nano::stat::detail::bulk_pull_receive_block_failure, nano::stat::dir::in);
-		network_error = true;
+		connection->node->stats.inc_detail_only (nano::stat::type::error, nano::stat::detail::insufficient_work);
 	}
+	return result;
 }
 
 nano::bulk_pull_account_client::bulk_pull_account_client (std::shared_ptr<nano::bootstrap_client> const & connection_a, std::shared_ptr<nano::bootstrap_attempt> const & attempt_a, nano::account const & account_a) :
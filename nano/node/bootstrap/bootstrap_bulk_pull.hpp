@@ -19,6 +19,8 @@ public:
 	nano::block_hash head_original{ 0 };
 	nano::block_hash end{ 0 };
 	count_t count{ 0 };
+	/** Count before scaling by the speed of the peer pulled from, 0 for pulls without a limit */
+	count_t base_count{ 0 };
 	unsigned attempts{ 0 };
 	uint64_t processed{ 0 };
 	unsigned retry_limit{ 0 };
@@ -31,10 +33,14 @@ public:
 	bulk_pull_client (std::shared_ptr<nano::bootstrap_client> const &, std::shared_ptr<nano::bootstrap_attempt> const &, nano::pull_info const &);
 	~bulk_pull_client ();
 	void request ();
+	/** Processes every complete block already buffered and only reads from the socket once none is left */
 	void receive_block ();
 	void throttled_receive_block ();
-	void received_type ();
-	void received_block (boost::system::error_code const &, size_t, nano::block_type);
+	void receive_more ();
+	void received_end (nano::block_type);
+	/** Returns true if the pull continues after \p block_a */
+	bool received_block (std::shared_ptr<nano::block> const & block_a);
+	bool throttled () const;
 	nano::block_hash first ();
 	std::shared_ptr<nano::bootstrap_client> connection;
 	std::shared_ptr<nano::bootstrap_attempt> attempt;
@@ -44,6 +50,14 @@ public:
 	uint64_t pull_blocks;
 	uint64_t unexpected_count;
 	bool network_error{ false };
+	std::chrono::steady_clock::time_point request_time;
+	/** Time from request to the first block, zero until one is received */
+	std::chrono::steady_clock::duration latency{ 0 };
+	/** Bytes received but not parsed yet are connection->receive_buffer [receive_begin, receive_end) */
+	size_t receive_begin{ 0 };
+	size_t receive_end{ 0 };
+	/** Fits a few hundred blocks so one read completion usually carries many of them */
+	static size_t constexpr receive_buffer_size = 64 * 1024;
 };
 class bulk_pull_account_client final : public std::enable_shared_from_this<nano::bulk_pull_account_client>
 {
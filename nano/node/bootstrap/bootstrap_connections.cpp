@@ -6,12 +6,19 @@
 #include <nano/node/transport/tcp.hpp>
 
 #include <boost/format.hpp>
+#include <boost/property_tree/ptree.hpp>
 
 constexpr double nano::bootstrap_limits::bootstrap_connection_scale_target_blocks;
 constexpr double nano::bootstrap_limits::bootstrap_minimum_blocks_per_sec;
 constexpr double nano::bootstrap_limits::bootstrap_minimum_termination_time_sec;
 constexpr unsigned nano::bootstrap_limits::bootstrap_max_new_connections;
 constexpr unsigned nano::bootstrap_limits::requeued_pulls_processed_blocks_factor;
+constexpr double nano::bootstrap_peer_scores::min_speed;
+constexpr double nano::bootstrap_peer_scores::max_speed;
+constexpr uint64_t nano::bootstrap_peer_scores::failing_threshold;
+constexpr std::chrono::seconds nano::bootstrap_peer_scores::failing_backoff;
+constexpr size_t nano::bootstrap_peer_scores::max_peers;
+constexpr size_t nano::bootstrap_connections::pull_lookahead;
 
 nano::bootstrap_client::bootstrap_client (std::shared_ptr<nano::node> const & node_a, std::shared_ptr<nano::bootstrap_connections> const & connections_a, std::shared_ptr<nano::transport::channel_tcp> const & channel_a, std::shared_ptr<nano::socket> const & socket_a) :
 node (node_a),
@@ -59,6 +66,111 @@ void nano::bootstrap_client::stop (bool force)
 	}
 }
 
+double nano::bootstrap_peer_score::rate () const
+{
+	auto seconds (std::chrono::duration_cast<std::chrono::duration<double>> (pull_time).count ());
+	return seconds > 0 ? static_cast<double> (blocks) / seconds : 0.0;
+}
+
+void nano::bootstrap_peer_scores::pull_finished (nano::tcp_endpoint const & endpoint_a, uint64_t blocks_a, std::chrono::steady_clock::duration elapsed_a, std::chrono::steady_clock::duration latency_a, bool failed_a)
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	auto & by_endpoint (scores.get<tag_endpoint> ());
+	auto existing (by_endpoint.find (endpoint_a));
+	if (existing == by_endpoint.end ())
+	{
+		scores.push_back (nano::bootstrap_peer_score{ endpoint_a });
+		existing = by_endpoint.find (endpoint_a);
+	}
+	else
+	{
+		// Most recently used peers are kept at the back
+		scores.relocate (scores.end (), scores.project<0> (existing));
+	}
+	auto now (std::chrono::steady_clock::now ());
+	by_endpoint.modify (existing, [blocks_a, elapsed_a, latency_a, failed_a, now](nano::bootstrap_peer_score & score_a) {
+		++score_a.pulls;
+		score_a.failures = failed_a ? score_a.failures + 1 : 0;
+		if (failed_a)
+		{
+			score_a.last_failure = now;
+		}
+		score_a.blocks += blocks_a;
+		score_a.pull_time += elapsed_a;
+		if (latency_a.count () > 0)
+		{
+			score_a.latency = score_a.latency.count () == 0 ? latency_a : (score_a.latency * 7 + latency_a) / 8;
+		}
+	});
+	total_blocks += blocks_a;
+	total_pull_time += elapsed_a;
+	if (scores.size () > max_peers)
+	{
+		total_blocks -= scores.front ().blocks;
+		total_pull_time -= scores.front ().pull_time;
+		scores.pop_front ();
+	}
+}
+
+double nano::bootstrap_peer_scores::average_rate ()
+{
+	debug_assert (!mutex.try_lock ());
+	auto seconds (std::chrono::duration_cast<std::chrono::duration<double>> (total_pull_time).count ());
+	return seconds > 0 ? static_cast<double> (total_blocks) / seconds : 0.0;
+}
+
+double nano::bootstrap_peer_scores::speed (nano::tcp_endpoint const & endpoint_a)
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	auto result (1.0);
+	auto & by_endpoint (scores.get<tag_endpoint> ());
+	auto existing (by_endpoint.find (endpoint_a));
+	auto average (average_rate ());
+	if (existing != by_endpoint.end () && existing->pull_time.count () > 0 && average > 0)
+	{
+		result = std::max (min_speed, std::min (max_speed, existing->rate () / average));
+	}
+	return result;
+}
+
+bool nano::bootstrap_peer_scores::failing (nano::tcp_endpoint const & endpoint_a, std::chrono::steady_clock::time_point now_a)
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	auto & by_endpoint (scores.get<tag_endpoint> ());
+	auto existing (by_endpoint.find (endpoint_a));
+	// Excluded peers are retried after the backoff, a further failure excludes them again
+	return existing != by_endpoint.end () && existing->failures >= failing_threshold && now_a - existing->last_failure < failing_backoff;
+}
+
+size_t nano::bootstrap_peer_scores::size ()
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	return scores.size ();
+}
+
+void nano::bootstrap_peer_scores::get_information (boost::property_tree::ptree & tree_a)
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	for (auto const & score : scores)
+	{
+		boost::property_tree::ptree entry;
+		entry.put ("endpoint", boost::str (boost::format ("%1%") % score.endpoint));
+		entry.put ("pulls", std::to_string (score.pulls));
+		entry.put ("failures", std::to_string (score.failures));
+		entry.put ("blocks", std::to_string (score.blocks));
+		entry.put ("blocks_per_sec", std::to_string (static_cast<uint64_t> (score.rate ())));
+		entry.put ("latency_ms", std::to_string (std::chrono::duration_cast<std::chrono::milliseconds> (score.latency).count ()));
+		tree_a.push_back (std::make_pair ("", entry));
+	}
+}
+
+std::unique_ptr<nano::container_info_component> nano::collect_container_info (bootstrap_peer_scores & bootstrap_peer_scores, std::string const & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "scores", bootstrap_peer_scores.size (), sizeof (decltype (bootstrap_peer_scores.scores)::value_type) }));
+	return composite;
+}
+
 nano::bootstrap_connections::bootstrap_connections (nano::node & node_a) :
 node (node_a)
 {
@@ -284,7 +396,7 @@ void nano::bootstrap_connections::populate_connections (bool repeat)
 		for (auto i = 0u; i < delta; i++)
 		{
 			auto endpoint (node.network.bootstrap_peer (true));
-			if (endpoint != nano::tcp_endpoint (boost::asio::ip::address_v6::any (), 0) && (node.flags.allow_bootstrap_peers_duplicates || endpoints.find (endpoint) == endpoints.end ()) && !node.network.excluded_peers.check (endpoint))
+			if (endpoint != nano::tcp_endpoint (boost::asio::ip::address_v6::any (), 0) && (node.flags.allow_bootstrap_peers_duplicates || endpoints.find (endpoint) == endpoints.end ()) && !node.network.excluded_peers.check (endpoint) && !peer_scores.failing (endpoint))
 			{
 				connect_client (endpoint);
 				endpoints.insert (endpoint);
@@ -341,11 +453,13 @@ void nano::bootstrap_connections::request_pull (nano::unique_lock<nano::mutex> &
 	{
 		std::shared_ptr<nano::bootstrap_attempt> attempt_l;
 		nano::pull_info pull;
+		auto speed (peer_scores.speed (connection_l->channel->get_tcp_endpoint ()));
 		// Search pulls with existing attempts
 		while (attempt_l == nullptr && !pulls.empty ())
 		{
-			pull = pulls.front ();
-			pulls.pop_front ();
+			auto selected (pulls.begin () + select_pull (speed));
+			pull = *selected;
+			pulls.erase (selected);
 			attempt_l = node.bootstrap_initiator.attempts.find (pull.bootstrap_id);
 			// Check if lazy pull is obsolete (head was processed or head is 0 for destinations requests)
 			if (attempt_l != nullptr && attempt_l->mode == nano::bootstrap_mode::lazy && !pull.head.is_zero () && attempt_l->lazy_processed_or_exists (pull.head))
@@ -360,6 +474,11 @@ void nano::bootstrap_connections::request_pull (nano::unique_lock<nano::mutex> &
 			{
 				attempt_l->add_recent_pull (pull.head);
 			}
+			else if (pull.base_count != 0)
+			{
+				// Size limited pulls are scaled by the peer speed so fast peers stay busy longer
+				pull.count = scaled_count (pull.base_count, speed);
+			}
 			// The bulk_pull_client destructor attempt to requeue_pull which can cause a deadlock if this is the last reference
 			// Dispatch request in an external thread in case it needs to be destroyed
 			node.background ([connection_l, attempt_l, pull]() {
@@ -377,6 +496,28 @@ void nano::bootstrap_connections::request_pull (nano::unique_lock<nano::mutex> &
 	}
 }
 
+nano::pull_info::count_t nano::bootstrap_connections::scaled_count (nano::pull_info::count_t base_count_a, double speed_a)
+{
+	// Requeued pulls keep their base count so retries on slow peers do not shrink them further
+	return std::max<nano::pull_info::count_t> (1, static_cast<nano::pull_info::count_t> (base_count_a * speed_a));
+}
+
+size_t nano::bootstrap_connections::select_pull (double speed_a) const
+{
+	debug_assert (!pulls.empty ());
+	// Pulls requeued after processing blocks are the long chains known so far
+	size_t result (0);
+	for (size_t i (0), n (std::min (pulls.size (), pull_lookahead)); i < n; ++i)
+	{
+		auto const & pull (pulls[i]);
+		if (speed_a >= 1.0 ? pull.processed > pulls[result].processed : pull.processed < pulls[result].processed)
+		{
+			result = i;
+		}
+	}
+	return result;
+}
+
 void nano::bootstrap_connections::requeue_pull (nano::pull_info const & pull_a, bool network_error)
 {
 	auto pull (pull_a);
@@ -394,9 +535,9 @@ void nano::bootstrap_connections::requeue_pull (nano::pull_info const & pull_a,
 		}
 		else if (attempt_l->mode == nano::bootstrap_mode::lazy)
 		{
-			pull.count = attempt_l->lazy_batch_size ();
+			pull.base_count = pull.count = attempt_l->lazy_batch_size ();
 		}
-		if (attempt_l->mode == nano::bootstrap_mode::legacy && (pull.attempts < pull.retry_limit + (pull.processed / nano::bootstrap_limits::requeued_pulls_processed_blocks_factor)))
+		if ((attempt_l->mode == nano::bootstrap_mode::legacy || attempt_l->mode == nano::bootstrap_mode::ascending) && (pull.attempts < pull.retry_limit + (pull.processed / nano::bootstrap_limits::requeued_pulls_processed_blocks_factor)))
 		{
 			{
 				nano::lock_guard<nano::mutex> lock (mutex);
@@ -430,7 +571,7 @@ void nano::bootstrap_connections::requeue_pull (nano::pull_info const & pull_a,
 			{
 				attempt_l->lazy_add (pull);
 			}
-			else if (attempt_l->mode == nano::bootstrap_mode::legacy)
+			else if (attempt_l->mode == nano::bootstrap_mode::legacy || attempt_l->mode == nano::bootstrap_mode::ascending)
 			{
 				node.bootstrap_initiator.cache.add (pull);
 			}
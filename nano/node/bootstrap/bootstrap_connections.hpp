@@ -4,8 +4,16 @@
 #include <nano/node/common.hpp>
 #include <nano/node/socket.hpp>
 
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/property_tree/ptree_fwd.hpp>
+
 #include <atomic>
 
+namespace mi = boost::multi_index;
+
 namespace nano
 {
 class node;
@@ -43,6 +51,66 @@ private:
 	std::chrono::steady_clock::time_point start_time_m;
 };
 
+class bootstrap_peer_score final
+{
+public:
+	nano::tcp_endpoint endpoint;
+	uint64_t pulls{ 0 };
+	/** Consecutive pulls ended by a network error */
+	uint64_t failures{ 0 };
+	std::chrono::steady_clock::time_point last_failure;
+	uint64_t blocks{ 0 };
+	/** Time spent pulling, from request to the end of the pull */
+	std::chrono::steady_clock::duration pull_time{ 0 };
+	/** Moving average of the time from request to first block */
+	std::chrono::steady_clock::duration latency{ 0 };
+	double rate () const;
+};
+
+/**
+ * Pull history of the peers bootstrapped from, kept for the least recently used max_peers endpoints.
+ * Used to hand long pulls to fast peers and to stop reconnecting to peers whose pulls keep failing, for failing_backoff after their last failure.
+ */
+class bootstrap_peer_scores final
+{
+public:
+	/** Records a pull of \p blocks_a valid blocks, \p latency_a is zero if no block was received */
+	void pull_finished (nano::tcp_endpoint const & endpoint_a, uint64_t blocks_a, std::chrono::steady_clock::duration elapsed_a, std::chrono::steady_clock::duration latency_a, bool failed_a);
+	/** Rate of \p endpoint_a relative to the average of all peers, clamped to [min_speed, max_speed], 1 when either is not known yet */
+	double speed (nano::tcp_endpoint const & endpoint_a);
+	/** True once the last failing_threshold pulls from \p endpoint_a failed, until failing_backoff has passed since the last of them */
+	bool failing (nano::tcp_endpoint const & endpoint_a, std::chrono::steady_clock::time_point now_a = std::chrono::steady_clock::now ());
+	size_t size ();
+	void get_information (boost::property_tree::ptree &);
+	static double constexpr min_speed = 0.25;
+	static double constexpr max_speed = 4.0;
+	static uint64_t constexpr failing_threshold = 4;
+	static std::chrono::seconds constexpr failing_backoff = std::chrono::seconds (5 * 60);
+	static size_t constexpr max_peers = 4096;
+
+private:
+	double average_rate ();
+	class tag_endpoint
+	{
+	};
+	nano::mutex mutex;
+	// clang-format off
+	boost::multi_index_container<nano::bootstrap_peer_score,
+	mi::indexed_by<
+		mi::sequenced<>,
+		mi::hashed_unique<mi::tag<tag_endpoint>,
+			mi::member<nano::bootstrap_peer_score, nano::tcp_endpoint, &nano::bootstrap_peer_score::endpoint>>>>
+	scores;
+	// clang-format on
+	/** Totals over the peers in scores */
+	uint64_t total_blocks{ 0 };
+	std::chrono::steady_clock::duration total_pull_time{ 0 };
+
+	friend std::unique_ptr<container_info_component> collect_container_info (bootstrap_peer_scores &, std::string const &);
+};
+
+std::unique_ptr<container_info_component> collect_container_info (bootstrap_peer_scores & bootstrap_peer_scores, std::string const & name);
+
 class bootstrap_connections final : public std::enable_shared_from_this<bootstrap_connections>
 {
 public:
@@ -58,6 +126,10 @@ public:
 	void start_populate_connections ();
 	void add_pull (nano::pull_info const & pull_a);
 	void request_pull (nano::unique_lock<nano::mutex> & lock_a);
+	/** Index in pulls of the next pull for a peer with relative \p speed_a, fast peers take the longest known chains */
+	size_t select_pull (double speed_a) const;
+	/** Count of a pull of \p base_count_a blocks for a peer with relative \p speed_a, at least one block */
+	static nano::pull_info::count_t scaled_count (nano::pull_info::count_t base_count_a, double speed_a);
 	void requeue_pull (nano::pull_info const & pull_a, bool network_error = false);
 	void clear_pulls (uint64_t);
 	void run ();
@@ -67,6 +139,9 @@ public:
 	nano::node & node;
 	std::deque<std::shared_ptr<nano::bootstrap_client>> idle;
 	std::deque<nano::pull_info> pulls;
+	nano::bootstrap_peer_scores peer_scores;
+	/** Number of queued pulls considered by select_pull */
+	static size_t constexpr pull_lookahead = 16;
 	std::atomic<bool> populate_connections_started{ false };
 	std::atomic<bool> new_connections_empty{ false };
 	std::atomic<bool> stopped{ false };
@@ -13,12 +13,24 @@ constexpr unsigned nano::bootstrap_limits::bulk_push_cost_limit;
 constexpr size_t nano::frontier_req_client::size_frontier;
 
 void nano::frontier_req_client::run (uint32_t const frontiers_age_a)
+{
+	run (nano::account (0), std::numeric_limits<uint32_t>::max (), frontiers_age_a);
+}
+
+void nano::frontier_req_client::run (nano::account const & start_a, uint32_t const count_a, uint32_t const frontiers_age_a)
 {
 	nano::frontier_req request;
-	request.start.clear ();
+	request.start = start_a;
 	request.age = frontiers_age_a;
-	request.count = std::numeric_limits<decltype (request.count)>::max ();
+	request.count = count_a;
 	frontiers_age = frontiers_age_a;
+	requested = count_a;
+	// Local accounts before the start are not compared
+	last_received = start_a.is_zero () ? nano::account (0) : nano::account (start_a.number () - 1);
+	if (connection->receive_buffer->size () < receive_buffer_size)
+	{
+		connection->receive_buffer->resize (receive_buffer_size);
+	}
 	auto this_l (shared_from_this ());
 	connection->channel->send (
 	request, [this_l](boost::system::error_code const & ec, size_t size_a) {
@@ -32,6 +44,7 @@ void nano::frontier_req_client::run (uint32_t const frontiers_age_a)
 			{
 				this_l->connection->node->logger.try_log (boost::str (boost::format ("Error while sending bootstrap request %1%") % ec.message ()));
 			}
+			this_l->fail ();
 		}
 	},
 	nano::buffer_drop_policy::no_limiter_drop);
@@ -40,20 +53,18 @@ void nano::frontier_req_client::run (uint32_t const frontiers_age_a)
 nano::frontier_req_client::frontier_req_client (std::shared_ptr<nano::bootstrap_client> const & connection_a, std::shared_ptr<nano::bootstrap_attempt> const & attempt_a) :
 connection (connection_a),
 attempt (attempt_a),
-current (0),
 count (0),
 bulk_push_cost (0)
 {
-	next ();
 }
 
 void nano::frontier_req_client::receive_frontier ()
 {
 	auto this_l (shared_from_this ());
-	connection->socket->async_read (connection->receive_buffer, nano::frontier_req_client::size_frontier, [this_l](boost::system::error_code const & ec, size_t size_a) {
+	connection->socket->async_read_some (connection->receive_buffer, receive_end, connection->receive_buffer->size () - receive_end, [this_l](boost::system::error_code const & ec, size_t size_a) {
 		// An issue with asio is that sometimes, instead of reporting a bad file descriptor during disconnect,
 		// we simply get a size of 0.
-		if (size_a == nano::frontier_req_client::size_frontier)
+		if (size_a > 0 || ec)
 		{
 			this_l->received_frontier (ec, size_a);
 		}
@@ -61,8 +72,9 @@ void nano::frontier_req_client::receive_frontier ()
 		{
 			if (this_l->connection->node->config.logging.network_message_logging ())
 			{
-				this_l->connection->node->logger.try_log (boost::str (boost::format ("Invalid size: expected %1%, got %2%") % nano::frontier_req_client::size_frontier % size_a));
+				this_l->connection->node->logger.try_log ("Invalid size: received no frontier bytes");
 			}
+			this_l->fail ();
 		}
 	});
 }
@@ -87,22 +99,36 @@ void nano::frontier_req_client::received_frontier (boost::system::error_code con
 {
 	if (!ec)
 	{
-		debug_assert (size_a == nano::frontier_req_client::size_frontier);
-		nano::account account;
-		nano::bufferstream account_stream (connection->receive_buffer->data (), sizeof (account));
-		auto error1 (nano::try_read (account_stream, account));
-		(void)error1;
-		debug_assert (!error1);
-		nano::block_hash latest;
-		nano::bufferstream latest_stream (connection->receive_buffer->data () + sizeof (account), sizeof (latest));
-		auto error2 (nano::try_read (latest_stream, latest));
-		(void)error2;
-		debug_assert (!error2);
-		if (count == 0)
+		receive_end += size_a;
+		auto & buffer (*connection->receive_buffer);
+		std::vector<std::pair<nano::account, nano::block_hash>> batch;
+		auto final_l (false);
+		size_t offset (0);
+		for (; !final_l && !exhausted && receive_end - offset >= nano::frontier_req_client::size_frontier; offset += nano::frontier_req_client::size_frontier)
 		{
-			start_time = std::chrono::steady_clock::now ();
+			nano::account account;
+			nano::block_hash latest;
+			nano::bufferstream stream (buffer.data () + offset, nano::frontier_req_client::size_frontier);
+			auto error (nano::try_read (stream, account) || nano::try_read (stream, latest));
+			(void)error;
+			debug_assert (!error);
+			if (count++ == 0)
+			{
+				start_time = std::chrono::steady_clock::now ();
+			}
+			final_l = account.is_zero ();
+			if (!final_l && account.number () <= range_end.number ())
+			{
+				batch.emplace_back (account, latest);
+			}
+			else if (!final_l)
+			{
+				exhausted = true;
+			}
 		}
-		++count;
+		// Keep the partially received frontier for the next read
+		std::copy (buffer.begin () + offset, buffer.begin () + receive_end, buffer.begin ());
+		receive_end -= offset;
 		std::chrono::duration<double> time_span = std::chrono::duration_cast<std::chrono::duration<double>> (std::chrono::steady_clock::now () - start_time);
 
 		double elapsed_sec = std::max (time_span.count (), nano::bootstrap_limits::bootstrap_minimum_elapsed_seconds_blockrate);
@@ -117,109 +143,179 @@ void nano::frontier_req_client::received_frontier (boost::system::error_code con
 		{
 			connection->node->logger.always_log (boost::str (boost::format ("Received %1% frontiers from %2%") % std::to_string (count) % connection->channel->to_string ()));
 		}
-		if (!account.is_zero ())
+		// Frontiers past range_end are of no use, the request is finished without reading the rest of the reply
+		auto past_range (!final_l && exhausted);
+		if (past_range)
+		{
+			// The peer is still sending, so the connection can't be reused
+			connection->stop (false);
+		}
+		auto done (final_l || past_range);
+		auto receive (!done);
+		if (!batch.empty () || done)
 		{
-			while (!current.is_zero () && current < account)
+			auto start (last_received);
+			if (!batch.empty ())
 			{
-				// We know about an account they don't.
-				unsynced (frontier, 0);
-				next ();
+				last_received = batch.back ().first;
+			}
+			// Frontiers missing from a count limited reply were cut off, not unknown to the peer
+			exhausted = exhausted || (final_l && count - 1 < requested);
+			uint64_t sequence;
+			{
+				nano::lock_guard<nano::mutex> guard (mutex);
+				sequence = batches_sent++;
+				final_received = done;
+				receive_paused = receive && ++batches_in_flight >= max_batches_in_flight;
+				receive = receive && !receive_paused;
 			}
-			if (!current.is_zero ())
+			compare (sequence, start, std::move (batch), done && exhausted);
+		}
+		if (receive)
+		{
+			receive_frontier ();
+		}
+	}
+	else
+	{
+		if (connection->node->config.logging.network_logging ())
+		{
+			connection->node->logger.try_log (boost::str (boost::format ("Error while receiving frontier %1%") % ec.message ()));
+		}
+		fail ();
+	}
+}
+
+void nano::frontier_req_client::compare (uint64_t sequence_a, nano::account const & start_a, std::vector<std::pair<nano::account, nano::block_hash>> batch_a, bool final_a)
+{
+	auto this_l (shared_from_this ());
+	connection->node->workers.push_task ([this_l, sequence_a, start_a, batch = std::move (batch_a), final_a]() {
+		auto & node (*this_l->connection->node);
+		// Accounts only known locally are recorded while they can still become bulk push targets, each costing 2
+		uint64_t push_budget (0);
+		{
+			nano::lock_guard<nano::mutex> guard (this_l->mutex);
+			if (this_l->bulk_push_cost < nano::bootstrap_limits::bulk_push_cost_limit && this_l->frontiers_age == std::numeric_limits<decltype (this_l->frontiers_age)>::max ())
 			{
-				if (account == current)
+				push_budget = (nano::bootstrap_limits::bulk_push_cost_limit - this_l->bulk_push_cost + 1) / 2;
+			}
+		}
+		std::vector<difference> differences;
+		{
+			auto transaction (node.store.tx_begin_read ());
+			auto i (node.store.accounts_begin (transaction, start_a.number () + 1));
+			auto n (node.store.accounts_end ());
+			for (auto const & [account, latest] : batch)
+			{
+				for (; i != n && i->first < account; ++i)
 				{
-					if (latest == frontier)
+					// We know about an account they don't.
+					if (push_budget > 0)
 					{
-						// In sync
+						differences.push_back ({ i->first, nano::block_hash (0), i->second.head, false });
+						--push_budget;
 					}
-					else
+				}
+				if (i != n && i->first == account)
+				{
+					if (i->second.head != latest)
 					{
-						if (connection->node->ledger.block_or_pruned_exists (latest))
-						{
-							// We know about a block they don't.
-							unsynced (frontier, latest);
-						}
-						else
-						{
-							attempt->add_frontier (nano::pull_info (account, latest, frontier, attempt->incremental_id, 0, connection->node->network_params.bootstrap.frontier_retry_limit));
-							// Either we're behind or there's a fork we differ on
-							// Either way, bulk pushing will probably not be effective
-							bulk_push_cost += 5;
-						}
+						differences.push_back ({ account, latest, i->second.head, node.ledger.block_or_pruned_exists (transaction, latest) });
 					}
-					next ();
+					++i;
 				}
 				else
 				{
-					debug_assert (account < current);
-					attempt->add_frontier (nano::pull_info (account, latest, nano::block_hash (0), attempt->incremental_id, 0, connection->node->network_params.bootstrap.frontier_retry_limit));
+					differences.push_back ({ account, latest, nano::block_hash (0), false });
 				}
 			}
-			else
+			for (; final_a && push_budget > 0 && i != n && i->first.number () <= this_l->range_end.number (); ++i, --push_budget)
 			{
-				attempt->add_frontier (nano::pull_info (account, latest, nano::block_hash (0), attempt->incremental_id, 0, connection->node->network_params.bootstrap.frontier_retry_limit));
+				// We know about an account they don't.
+				differences.push_back ({ i->first, nano::block_hash (0), i->second.head, false });
 			}
-			receive_frontier ();
 		}
-		else
+		nano::unique_lock<nano::mutex> lock (this_l->mutex);
+		this_l->compared.emplace (sequence_a, std::move (differences));
+		for (auto existing (this_l->compared.find (this_l->batches_applied)); existing != this_l->compared.end (); existing = this_l->compared.find (this_l->batches_applied))
 		{
-			while (!current.is_zero ())
-			{
-				// We know about an account they don't.
-				unsynced (frontier, 0);
-				next ();
-			}
-			if (connection->node->config.logging.bulk_pull_logging ())
+			for (auto const & difference : existing->second)
 			{
-				connection->node->logger.try_log ("Bulk push cost: ", bulk_push_cost);
-			}
-			{
-				try
-				{
-					promise.set_value (false);
-				}
-				catch (std::future_error &)
-				{
-				}
-				connection->connections->pool_connection (connection);
+				this_l->apply (difference);
 			}
+			this_l->compared.erase (existing);
+			++this_l->batches_applied;
+		}
+		--this_l->batches_in_flight;
+		auto resume (this_l->receive_paused);
+		this_l->receive_paused = false;
+		auto finished (this_l->final_received && this_l->batches_applied == this_l->batches_sent);
+		lock.unlock ();
+		if (resume)
+		{
+			this_l->receive_frontier ();
+		}
+		if (finished)
+		{
+			this_l->finish ();
 		}
+	});
+}
+
+void nano::frontier_req_client::apply (difference const & difference_a)
+{
+	auto const retry_limit (connection->node->network_params.bootstrap.frontier_retry_limit);
+	if (difference_a.remote.is_zero ())
+	{
+		unsynced (difference_a.local, 0);
+	}
+	else if (difference_a.local.is_zero ())
+	{
+		attempt->add_frontier (nano::pull_info (difference_a.account, difference_a.remote, nano::block_hash (0), attempt->incremental_id, 0, retry_limit));
+	}
+	else if (difference_a.remote_known)
+	{
+		// We know about a block they don't.
+		unsynced (difference_a.local, difference_a.remote);
 	}
 	else
 	{
-		if (connection->node->config.logging.network_logging ())
-		{
-			connection->node->logger.try_log (boost::str (boost::format ("Error while receiving frontier %1%") % ec.message ()));
-		}
+		attempt->add_frontier (nano::pull_info (difference_a.account, difference_a.remote, difference_a.local, attempt->incremental_id, 0, retry_limit));
+		// Either we're behind or there's a fork we differ on
+		// Either way, bulk pushing will probably not be effective
+		bulk_push_cost += 5;
 	}
 }
 
-void nano::frontier_req_client::next ()
+void nano::frontier_req_client::fail ()
 {
-	// Filling accounts deque to prevent often read transactions
-	if (accounts.empty ())
+	try
+	{
+		promise.set_value (true);
+	}
+	catch (std::future_error &)
 	{
-		size_t max_size (128);
-		auto transaction (connection->node->store.tx_begin_read ());
-		for (auto i (connection->node->store.accounts_begin (transaction, current.number () + 1)), n (connection->node->store.accounts_end ()); i != n && accounts.size () != max_size; ++i)
-		{
-			nano::account_info const & info (i->second);
-			nano::account const & account (i->first);
-			accounts.emplace_back (account, info.head);
-		}
-		/* If loop breaks before max_size, then accounts_end () is reached
-		Add empty record */
-		if (accounts.size () != max_size)
-		{
-			accounts.emplace_back (nano::account (0), nano::block_hash (0));
-		}
 	}
-	// Retrieving accounts from deque
-	auto const & account_pair (accounts.front ());
-	current = account_pair.first;
-	frontier = account_pair.second;
-	accounts.pop_front ();
+}
+
+void nano::frontier_req_client::finish ()
+{
+	if (connection->node->config.logging.bulk_pull_logging ())
+	{
+		connection->node->logger.try_log ("Bulk push cost: ", bulk_push_cost);
+	}
+	try
+	{
+		promise.set_value (false);
+	}
+	catch (std::future_error &)
+	{
+	}
+	// Bytes past the final frontier mean the peer is out of step with the protocol
+	if (receive_end == 0)
+	{
+		connection->connections->pool_connection (connection);
+	}
 }
 
 nano::frontier_req_server::frontier_req_server (std::shared_ptr<nano::bootstrap_server> const & connection_a, std::unique_ptr<nano::frontier_req> request_a) :
@@ -237,19 +333,42 @@ void nano::frontier_req_server::send_next ()
 	if (!current.is_zero () && count < request->count)
 	{
 		std::vector<uint8_t> send_buffer;
+		size_t batch (0);
+		read_ahead = false;
 		{
 			nano::vectorstream stream (send_buffer);
-			write (stream, current.bytes);
-			write (stream, frontier.bytes);
-			debug_assert (!current.is_zero ());
-			debug_assert (!frontier.is_zero ());
+			while (!read_ahead && !current.is_zero () && count < request->count)
+			{
+				write (stream, current.bytes);
+				write (stream, frontier.bytes);
+				debug_assert (!current.is_zero ());
+				debug_assert (!frontier.is_zero ());
+				if (connection->node->config.logging.bulk_pull_logging ())
+				{
+					connection->node->logger.try_log (boost::str (boost::format ("Sending frontier for %1% %2%") % current.to_account () % frontier.to_string ()));
+				}
+				++count;
+				++batch;
+				// Frontiers following the last one sent are read while this batch is written
+				read_ahead = accounts.empty ();
+				if (!read_ahead)
+				{
+					next ();
+				}
+			}
 		}
+		read_ahead = read_ahead && count < request->count;
+		connection->node->stats.add (nano::stat::type::bootstrap, nano::stat::detail::frontier_req_frontiers, nano::stat::dir::out, batch);
+		connection->node->stats.inc (nano::stat::type::bootstrap, nano::stat::detail::frontier_req_batches, nano::stat::dir::out);
+		pending = read_ahead ? 2 : 1;
 		auto this_l (shared_from_this ());
-		if (connection->node->config.logging.bulk_pull_logging ())
+		if (read_ahead)
 		{
-			connection->node->logger.try_log (boost::str (boost::format ("Sending frontier for %1% %2%") % current.to_account () % frontier.to_string ()));
+			connection->node->workers.push_task ([this_l]() {
+				this_l->refill (this_l->current);
+				this_l->batch_done ();
+			});
 		}
-		next ();
 		connection->socket->async_write (nano::shared_const_buffer (std::move (send_buffer)), [this_l](boost::system::error_code const & ec, size_t size_a) {
 			this_l->sent_action (ec, size_a);
 		});
@@ -296,18 +415,28 @@ void nano::frontier_req_server::no_block_sent (boost::system::error_code const &
 
 void nano::frontier_req_server::sent_action (boost::system::error_code const & ec, size_t size_a)
 {
-	if (!ec)
-	{
-		count++;
-		send_next ();
-	}
-	else
+	if (ec)
 	{
+		write_error = true;
 		if (connection->node->config.logging.network_logging ())
 		{
 			connection->node->logger.try_log (boost::str (boost::format ("Error sending frontier pair: %1%") % ec.message ()));
 		}
 	}
+	batch_done ();
+}
+
+void nano::frontier_req_server::batch_done ()
+{
+	// Whichever of the write and the read ahead completes last carries on with the next batch
+	if (--pending == 0 && !write_error)
+	{
+		if (read_ahead)
+		{
+			next ();
+		}
+		send_next ();
+	}
 }
 
 void nano::frontier_req_server::next ()
@@ -315,25 +444,7 @@ void nano::frontier_req_server::next ()
 	// Filling accounts deque to prevent often read transactions
 	if (accounts.empty ())
 	{
-		auto now (nano::seconds_since_epoch ());
-		bool disable_age_filter (request->age == std::numeric_limits<decltype (request->age)>::max ());
-		size_t max_size (128);
-		auto transaction (connection->node->store.tx_begin_read ());
-		for (auto i (connection->node->store.accounts_begin (transaction, current.number () + 1)), n (connection->node->store.accounts_end ()); i != n && accounts.size () != max_size; ++i)
-		{
-			nano::account_info const & info (i->second);
-			if (disable_age_filter || (now - info.modified) <= request->age)
-			{
-				nano::account const & account (i->first);
-				accounts.emplace_back (account, info.head);
-			}
-		}
-		/* If loop breaks before max_size, then accounts_end () is reached
-		Add empty record to finish frontier_req_server */
-		if (accounts.size () != max_size)
-		{
-			accounts.emplace_back (nano::account (0), nano::block_hash (0));
-		}
+		refill (current);
 	}
 	// Retrieving accounts from deque
 	auto const & account_pair (accounts.front ());
@@ -341,3 +452,27 @@ void nano::frontier_req_server::next ()
 	frontier = account_pair.second;
 	accounts.pop_front ();
 }
+
+void nano::frontier_req_server::refill (nano::account const & start_a)
+{
+	debug_assert (accounts.empty ());
+	auto now (nano::seconds_since_epoch ());
+	bool disable_age_filter (request->age == std::numeric_limits<decltype (request->age)>::max ());
+	size_t max_size (connection->node->config.bootstrap_frontier_refill_size);
+	auto transaction (connection->node->store.tx_begin_read ());
+	for (auto i (connection->node->store.accounts_begin (transaction, start_a.number () + 1)), n (connection->node->store.accounts_end ()); i != n && accounts.size () != max_size; ++i)
+	{
+		nano::account_info const & info (i->second);
+		if (disable_age_filter || (now - info.modified) <= request->age)
+		{
+			nano::account const & account (i->first);
+			accounts.emplace_back (account, info.head);
+		}
+	}
+	/* If loop breaks before max_size, then accounts_end () is reached
+	Add empty record to finish frontier_req_server */
+	if (accounts.size () != max_size)
+	{
+		accounts.emplace_back (nano::account (0), nano::block_hash (0));
+	}
+}
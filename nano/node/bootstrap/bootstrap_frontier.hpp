@@ -1,9 +1,13 @@
 #pragma once
 
+#include <nano/lib/locks.hpp>
 #include <nano/node/common.hpp>
 
+#include <atomic>
 #include <deque>
 #include <future>
+#include <map>
+#include <vector>
 
 namespace nano
 {
@@ -14,14 +18,22 @@ class frontier_req_client final : public std::enable_shared_from_this<nano::fron
 public:
 	explicit frontier_req_client (std::shared_ptr<nano::bootstrap_client> const &, std::shared_ptr<nano::bootstrap_attempt> const &);
 	void run (uint32_t const frontiers_age_a);
+	/** Requests at most \p count_a frontiers of accounts from \p start_a on */
+	void run (nano::account const & start_a, uint32_t const count_a, uint32_t const frontiers_age_a);
 	void receive_frontier ();
+	/** Splits off every complete frontier received so far as one batch, reading stops at the first frontier past range_end */
 	void received_frontier (boost::system::error_code const &, size_t);
 	void unsynced (nano::block_hash const &, nano::block_hash const &);
-	void next ();
+	/**
+	 * Compares \p batch_a with the local accounts after \p start_a on a worker thread, walking the accounts table alongside the sorted batch.
+	 * The walk ends with the last account of the batch, or with the ledger or range_end for the \p final_a batch
+	 */
+	void compare (uint64_t sequence_a, nano::account const & start_a, std::vector<std::pair<nano::account, nano::block_hash>> batch_a, bool final_a);
+	void finish ();
+	/** Completes the request as failed, requesters holding on to the client are not left waiting for its destruction */
+	void fail ();
 	std::shared_ptr<nano::bootstrap_client> connection;
 	std::shared_ptr<nano::bootstrap_attempt> attempt;
-	nano::account current;
-	nano::block_hash frontier;
 	unsigned count;
 	nano::account landing;
 	nano::account faucet;
@@ -29,9 +41,46 @@ public:
 	std::promise<bool> promise;
 	/** A very rough estimate of the cost of `bulk_push`ing missing blocks */
 	uint64_t bulk_push_cost;
-	std::deque<std::pair<nano::account, nano::block_hash>> accounts;
 	uint32_t frontiers_age{ std::numeric_limits<uint32_t>::max () };
+	uint32_t requested{ std::numeric_limits<uint32_t>::max () };
+	/** Received and local accounts after this one are not compared */
+	nano::account range_end{ std::numeric_limits<nano::uint256_t>::max () };
+	/** Last account received, the next batch is compared with local accounts after it */
+	nano::account last_received{ 0 };
+	/** Set once the peer has no more accounts up to range_end */
+	std::atomic<bool> exhausted{ false };
 	static size_t constexpr size_frontier = sizeof (nano::account) + sizeof (nano::block_hash);
+	static size_t constexpr receive_buffer_size = 1024 * size_frontier;
+	/** Reading from the peer pauses while this many batches are being compared */
+	static size_t constexpr max_batches_in_flight = 4;
+
+private:
+	/** An account whose frontier differs, a zero frontier stands for an account unknown on that side */
+	class difference final
+	{
+	public:
+		nano::account account;
+		nano::block_hash remote;
+		nano::block_hash local;
+		/** The remote frontier is in the local ledger, so the peer is behind */
+		bool remote_known;
+	};
+	void apply (difference const &);
+	/** Bytes of a partially received frontier at the front of connection->receive_buffer */
+	size_t receive_end{ 0 };
+	nano::mutex mutex;
+	/** Batches compared out of order wait here to be applied in the order they were received */
+	std::map<uint64_t, std::vector<difference>> compared;
+	uint64_t batches_sent{ 0 };
+	uint64_t batches_applied{ 0 };
+	size_t batches_in_flight{ 0 };
+	bool receive_paused{ false };
+	bool final_received{ false };
+
+	friend class frontier_req_client_compare_out_of_order_Test;
+	friend class frontier_req_client_compare_push_budget_Test;
+	friend class frontier_req_client_receive_pause_Test;
+	friend class frontier_req_client_past_range_end_Test;
 };
 class bootstrap_server;
 class frontier_req;
@@ -39,16 +88,24 @@ class frontier_req_server final : public std::enable_shared_from_this<nano::fron
 {
 public:
 	frontier_req_server (std::shared_ptr<nano::bootstrap_server> const &, std::unique_ptr<nano::frontier_req>);
+	/** Sends every frontier read so far in a single write, the next frontiers are read on a worker thread meanwhile */
 	void send_next ();
 	void sent_action (boost::system::error_code const &, size_t);
+	void batch_done ();
 	void send_finished ();
 	void no_block_sent (boost::system::error_code const &, size_t);
 	void next ();
+	/** Reads up to bootstrap_frontier_refill_size frontiers of accounts after \p start_a into accounts */
+	void refill (nano::account const & start_a);
 	std::shared_ptr<nano::bootstrap_server> connection;
 	nano::account current;
 	nano::block_hash frontier;
 	std::unique_ptr<nano::frontier_req> request;
 	size_t count;
 	std::deque<std::pair<nano::account, nano::block_hash>> accounts;
+	/** The write and, if read_ahead is set, the refill in flight for the current batch */
+	std::atomic<unsigned> pending{ 0 };
+	std::atomic<bool> write_error{ false };
+	bool read_ahead{ false };
 };
 }
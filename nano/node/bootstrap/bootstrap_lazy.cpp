@@ -252,13 +252,24 @@ bool nano::bootstrap_attempt_lazy::process_block_lazy (std::shared_ptr<nano::blo
 		// Adding lazy balances for first processed block in pull
 		if (pull_blocks == 0 && (block_a->type () == nano::block_type::state || block_a->type () == nano::block_type::send))
 		{
-			lazy_balances.emplace (hash, block_a->balance ().number ());
+			if (!lazy_memory_full ())
+			{
+				lazy_balances.emplace (hash, block_a->balance ().number ());
+			}
+			else
+			{
+				lazy_dropped_balances.insert (std::hash<::nano::block_hash> () (hash));
+			}
 		}
 		// Clearing lazy balances for previous block
 		if (!block_a->previous ().is_zero () && lazy_balances.find (block_a->previous ()) != lazy_balances.end ())
 		{
 			lazy_balances.erase (block_a->previous ());
 		}
+		else if (!block_a->previous ().is_zero () && !lazy_dropped_balances.empty ())
+		{
+			lazy_dropped_balances.erase (std::hash<::nano::block_hash> () (block_a->previous ()));
+		}
 		lazy_block_state_backlog_check (block_a, hash);
 		lock.unlock ();
 		nano::unchecked_info info (block_a, known_account_a, 0, nano::signature_verification::unknown, retry_limit > node->network_params.bootstrap.lazy_retry_limit);
@@ -315,12 +326,23 @@ void nano::bootstrap_attempt_lazy::lazy_block_state (std::shared_ptr<nano::block
 					}
 					lazy_balances.erase (previous_balance);
 				}
+				else if (lazy_dropped_balances.erase (std::hash<::nano::block_hash> () (previous)))
+				{
+					// The balance was dropped at the memory limit
+					node->stats.inc (nano::stat::type::bootstrap, nano::stat::detail::lazy_memory_limited);
+					lazy_add_undefined (link);
+				}
 			}
 			// Insert in backlog state blocks if previous wasn't already processed
-			else
+			else if (!lazy_memory_full ())
 			{
 				lazy_state_backlog.emplace (previous, nano::lazy_state_backlog_item{ link, balance, retry_limit });
 			}
+			else
+			{
+				node->stats.inc (nano::stat::type::bootstrap, nano::stat::detail::lazy_memory_limited);
+				lazy_add_undefined (link);
+			}
 		}
 	}
 }
@@ -341,10 +363,9 @@ void nano::bootstrap_attempt_lazy::lazy_block_state_backlog_check (std::shared_p
 			}
 		}
 		// Assumption for other legacy block types
-		else if (lazy_undefined_links.find (next_block.link.as_block_hash ()) == lazy_undefined_links.end ())
+		else
 		{
-			lazy_add (next_block.link, node->network_params.bootstrap.lazy_retry_limit); // Head is not confirmed. It can be account or hash or non-existing
-			lazy_undefined_links.insert (next_block.link.as_block_hash ());
+			lazy_add_undefined (next_block.link);
 		}
 		lazy_state_backlog.erase (find_state);
 	}
@@ -388,11 +409,31 @@ void nano::bootstrap_attempt_lazy::lazy_backlog_cleanup ()
 	}
 }
 
+void nano::bootstrap_attempt_lazy::lazy_add_undefined (nano::link const & link_a)
+{
+	debug_assert (!mutex.try_lock ());
+	if (lazy_undefined_links.insert (std::hash<::nano::block_hash> () (link_a.as_block_hash ())))
+	{
+		lazy_add (link_a, node->network_params.bootstrap.lazy_retry_limit); // Head is not confirmed. It can be account or hash or non-existing
+	}
+}
+
+size_t nano::bootstrap_attempt_lazy::lazy_memory () const
+{
+	// Node based containers allocate a node with a next pointer and a bucket pointer per entry
+	auto constexpr node_overhead (2 * sizeof (void *));
+	return lazy_blocks.memory () + lazy_undefined_links.memory () + lazy_dropped_balances.memory () + lazy_state_backlog.size () * (sizeof (decltype (lazy_state_backlog)::value_type) + node_overhead) + lazy_balances.size () * (sizeof (decltype (lazy_balances)::value_type) + node_overhead) + lazy_keys.size () * (sizeof (decltype (lazy_keys)::value_type) + node_overhead) + lazy_pulls.size () * sizeof (decltype (lazy_pulls)::value_type);
+}
+
+bool nano::bootstrap_attempt_lazy::lazy_memory_full () const
+{
+	return lazy_memory () >= node->config.lazy_bootstrap_memory_limit;
+}
+
 void nano::bootstrap_attempt_lazy::lazy_blocks_insert (nano::block_hash const & hash_a)
 {
 	debug_assert (!mutex.try_lock ());
-	auto inserted (lazy_blocks.insert (std::hash<::nano::block_hash> () (hash_a)));
-	if (inserted.second)
+	if (lazy_blocks.insert (std::hash<::nano::block_hash> () (hash_a)))
 	{
 		++lazy_blocks_count;
 		debug_assert (lazy_blocks_count > 0);
@@ -402,8 +443,7 @@ void nano::bootstrap_attempt_lazy::lazy_blocks_insert (nano::block_hash const &
 void nano::bootstrap_attempt_lazy::lazy_blocks_erase (nano::block_hash const & hash_a)
 {
 	debug_assert (!mutex.try_lock ());
-	auto erased (lazy_blocks.erase (std::hash<::nano::block_hash> () (hash_a)));
-	if (erased)
+	if (lazy_blocks.erase (std::hash<::nano::block_hash> () (hash_a)))
 	{
 		--lazy_blocks_count;
 		debug_assert (lazy_blocks_count != std::numeric_limits<size_t>::max ());
@@ -412,7 +452,7 @@ void nano::bootstrap_attempt_lazy::lazy_blocks_erase (nano::block_hash const & h
 
 bool nano::bootstrap_attempt_lazy::lazy_blocks_processed (nano::block_hash const & hash_a)
 {
-	return lazy_blocks.find (std::hash<::nano::block_hash> () (hash_a)) != lazy_blocks.end ();
+	return lazy_blocks.contains (std::hash<::nano::block_hash> () (hash_a));
 }
 
 bool nano::bootstrap_attempt_lazy::lazy_processed_or_exists (nano::block_hash const & hash_a)
@@ -459,6 +499,45 @@ void nano::bootstrap_attempt_lazy::get_information (boost::property_tree::ptree
 	{
 		tree_a.put ("lazy_key_1", (*(lazy_keys.begin ())).to_string ());
 	}
+	tree_a.put ("lazy_memory", std::to_string (lazy_memory ()));
+	tree_a.put ("lazy_dropped_balances", std::to_string (lazy_dropped_balances.size ()));
+}
+
+std::unique_ptr<nano::container_info_component> nano::collect_container_info (bootstrap_attempt_lazy & bootstrap_attempt_lazy, std::string const & name)
+{
+	size_t blocks_count;
+	size_t blocks_memory;
+	size_t undefined_links_count;
+	size_t undefined_links_memory;
+	size_t state_backlog_count;
+	size_t balances_count;
+	size_t dropped_balances_count;
+	size_t dropped_balances_memory;
+	size_t keys_count;
+	size_t pulls_count;
+	{
+		nano::lock_guard<nano::mutex> guard (bootstrap_attempt_lazy.mutex);
+		blocks_count = bootstrap_attempt_lazy.lazy_blocks.size ();
+		blocks_memory = bootstrap_attempt_lazy.lazy_blocks.memory ();
+		undefined_links_count = bootstrap_attempt_lazy.lazy_undefined_links.size ();
+		undefined_links_memory = bootstrap_attempt_lazy.lazy_undefined_links.memory ();
+		state_backlog_count = bootstrap_attempt_lazy.lazy_state_backlog.size ();
+		balances_count = bootstrap_attempt_lazy.lazy_balances.size ();
+		dropped_balances_count = bootstrap_attempt_lazy.lazy_dropped_balances.size ();
+		dropped_balances_memory = bootstrap_attempt_lazy.lazy_dropped_balances.memory ();
+		keys_count = bootstrap_attempt_lazy.lazy_keys.size ();
+		pulls_count = bootstrap_attempt_lazy.lazy_pulls.size ();
+	}
+	auto composite = std::make_unique<container_info_composite> (name);
+	// The hash sets report their whole table, which is more than count times the element size
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lazy_blocks", blocks_count, blocks_count == 0 ? 0 : blocks_memory / blocks_count }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lazy_undefined_links", undefined_links_count, undefined_links_count == 0 ? 0 : undefined_links_memory / undefined_links_count }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lazy_state_backlog", state_backlog_count, sizeof (decltype (bootstrap_attempt_lazy.lazy_state_backlog)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lazy_balances", balances_count, sizeof (decltype (bootstrap_attempt_lazy.lazy_balances)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lazy_dropped_balances", dropped_balances_count, dropped_balances_count == 0 ? 0 : dropped_balances_memory / dropped_balances_count }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lazy_keys", keys_count, sizeof (decltype (bootstrap_attempt_lazy.lazy_keys)::value_type) }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "lazy_pulls", pulls_count, sizeof (decltype (bootstrap_attempt_lazy.lazy_pulls)::value_type) }));
+	return composite;
 }
 
 nano::bootstrap_attempt_wallet::bootstrap_attempt_wallet (std::shared_ptr<nano::node> const & node_a, uint64_t incremental_id_a, std::string id_a) :
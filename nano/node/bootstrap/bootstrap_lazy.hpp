@@ -1,5 +1,6 @@
 #pragma once
 
+#include <nano/lib/compact_hash_set.hpp>
 #include <nano/node/bootstrap/bootstrap_attempt.hpp>
 
 #include <boost/multi_index/hashed_index.hpp>
@@ -46,12 +47,26 @@ public:
 	void lazy_blocks_erase (nano::block_hash const &);
 	bool lazy_blocks_processed (nano::block_hash const &);
 	bool lazy_processed_or_exists (nano::block_hash const &) override;
+	/** Pulls \p link_a once without knowing whether it is a source block, used when the balances needed to tell are not known */
+	void lazy_add_undefined (nano::link const & link_a);
 	unsigned lazy_retry_limit_confirmed ();
+	/** Estimated bytes used by the lazy containers */
+	size_t lazy_memory () const;
+	/**
+	 * Returns true once the lazy containers reach lazy_bootstrap_memory_limit. The limit is soft, only balances and backlog entries stop
+	 * being recorded past it. Processed blocks, pulls and keys are needed to complete the attempt and keep growing, processed blocks are
+	 * bounded by lazy_blocks_restart_limit while legacy bootstrap is enabled
+	 */
+	bool lazy_memory_full () const;
 	void get_information (boost::property_tree::ptree &) override;
-	std::unordered_set<size_t> lazy_blocks;
+	/** Truncated hashes of processed blocks */
+	nano::compact_hash_set lazy_blocks;
 	std::unordered_map<nano::block_hash, nano::lazy_state_backlog_item> lazy_state_backlog;
-	std::unordered_set<nano::block_hash> lazy_undefined_links;
+	/** Truncated hashes of links pulled by lazy_add_undefined */
+	nano::compact_hash_set lazy_undefined_links;
 	std::unordered_map<nano::block_hash, nano::uint128_t> lazy_balances;
+	/** Truncated hashes of blocks whose balance was not recorded in lazy_balances because of the memory limit */
+	nano::compact_hash_set lazy_dropped_balances;
 	std::unordered_set<nano::block_hash> lazy_keys;
 	std::deque<std::pair<nano::hash_or_account, unsigned>> lazy_pulls;
 	std::chrono::steady_clock::time_point lazy_start_time;
@@ -74,4 +89,6 @@ public:
 	void get_information (boost::property_tree::ptree &) override;
 	std::deque<nano::account> wallet_accounts;
 };
+
+std::unique_ptr<container_info_component> collect_container_info (bootstrap_attempt_lazy & bootstrap_attempt_lazy, std::string const & name);
 }
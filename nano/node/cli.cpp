@@ -4,6 +4,7 @@
 #include <nano/node/common.hpp>
 #include <nano/node/daemonconfig.hpp>
 #include <nano/node/node.hpp>
+#include <nano/secure/ledger_snapshot.hpp>
 
 #include <boost/format.hpp>
 
@@ -59,6 +60,8 @@ void nano::add_node_options (boost::program_options::options_description & descr
 	("final_vote_clear", "Clear final votes")
 	("rebuild_database", "Rebuild LMDB database with vacuum for best compaction")
 	("migrate_database_lmdb_to_rocksdb", "Migrates LMDB database to RocksDB")
+	("snapshot_export", "Write the ledger to the snapshot <file>, for provisioning nodes with --snapshot_import")
+	("snapshot_import", "Read the ledger from the snapshot <file> in to an empty database")
 	("diagnostics", "Run internal diagnostics")
 	("generate_config", boost::program_options::value<std::string> (), "Write configuration to stdout, populated with defaults suitable for this system. Pass the configuration type node or rpc. See also use_defaults.")
 	("key_create", "Generates a adhoc random keypair and prints it to stdout")
@@ -105,6 +108,7 @@ void nano::add_node_flag_options (boost::program_options::options_description &
 		("enable_pruning", "Enable experimental ledger pruning")
 		("allow_bootstrap_peers_duplicates", "Allow multiple connections to same peer in bootstrap attempts")
 		("fast_bootstrap", "Increase bootstrap speed for high end nodes with higher limits")
+		("startup_profile", "Log the wall and CPU time of each node startup phase once the node has started")
 		("block_processor_batch_size", boost::program_options::value<std::size_t>(), "Increase block processor transaction batch write size, default 0 (limited by config block_processor_batch_max_time), 256k for fast_bootstrap")
 		("block_processor_full_size", boost::program_options::value<std::size_t>(), "Increase block processor allowed blocks queue size before dropping live network packets and holding bootstrap download, default 65536, 1 million for fast_bootstrap")
 		("block_processor_verification_size", boost::program_options::value<std::size_t>(), "Increase batch signature verification size in block processor, default 0 (limited by config signature_checker_threads), unlimited for fast_bootstrap")
@@ -142,6 +146,7 @@ std::error_code nano::update_flags (nano::node_flags & flags_a, boost::program_o
 	flags_a.enable_pruning = (vm.count ("enable_pruning") > 0);
 	flags_a.allow_bootstrap_peers_duplicates = (vm.count ("allow_bootstrap_peers_duplicates") > 0);
 	flags_a.fast_bootstrap = (vm.count ("fast_bootstrap") > 0);
+	flags_a.startup_profile = (vm.count ("startup_profile") > 0);
 	if (flags_a.fast_bootstrap)
 	{
 		flags_a.disable_block_processor_unchecked_deletion = true;
@@ -220,7 +225,7 @@ bool copy_database (boost::filesystem::path const & data_path, boost::program_op
 		auto transaction (node.node->store.tx_begin_write ());
 		if (vm.count ("unchecked_clear"))
 		{
-			node.node->store.unchecked_clear (transaction);
+			node.node->unchecked.clear (transaction);
 		}
 		if (vm.count ("clear_send_ids"))
 		{
@@ -465,7 +470,7 @@ std::error_code nano::handle_node_options (boost::program_options::variables_map
 		if (!node.node->init_error ())
 		{
 			std::cout << "Migrating LMDB database to RocksDB, might take a while..." << std::endl;
-			error = node.node->ledger.migrate_lmdb_to_rocksdb (data_path);
+			error = node.node->ledger.migrate_lmdb_to_rocksdb (data_path, [](std::string const & progress_a) { std::cout << progress_a << std::endl; });
 		}
 		else
 		{
@@ -481,6 +486,50 @@ std::error_code nano::handle_node_options (boost::program_options::variables_map
 			std::cerr << "There was an error migrating" << std::endl;
 		}
 	}
+	else if (vm.count ("snapshot_export") || vm.count ("snapshot_import"))
+	{
+		auto import (vm.count ("snapshot_import") != 0);
+		if (vm.count ("file") == 1)
+		{
+			boost::filesystem::path file_path (vm["file"].as<std::string> ());
+			auto data_path = vm.count ("data_path") ? boost::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
+			auto node_flags = nano::inactive_node_flag_defaults ();
+			node_flags.read_only = !import;
+			nano::update_flags (node_flags, vm);
+			nano::inactive_node node (data_path, node_flags);
+			if (!node.node->init_error ())
+			{
+				nano::ledger_snapshot snapshot (node.node->ledger);
+				std::cout << (import ? "Importing ledger snapshot " : "Exporting ledger snapshot ") << file_path << ", might take a while..." << std::endl;
+				auto error (import ? snapshot.import_file (file_path) : snapshot.export_file (file_path));
+				if (!error)
+				{
+					auto seconds (std::max<double> (snapshot.elapsed.count (), 1) / 1000.0);
+					auto megabytes (snapshot.bytes / (1024.0 * 1024.0));
+					std::cout << boost::str (boost::format ("%1% %2% records in %3% chunks, %4$.1f MB in %5$.1f seconds (%6$.1f MB/s)") % (import ? "Imported" : "Exported") % snapshot.records.load () % snapshot.chunks.load () % megabytes % seconds % (megabytes / seconds)) << std::endl;
+				}
+				else if (import)
+				{
+					std::cerr << "Snapshot import failed, the snapshot is corrupt, belongs to another network or database version, or the database is not empty" << std::endl;
+					ec = nano::error_cli::generic;
+				}
+				else
+				{
+					std::cerr << "Snapshot export failed writing " << file_path << std::endl;
+					ec = nano::error_cli::generic;
+				}
+			}
+			else
+			{
+				database_write_lock_error (ec);
+			}
+		}
+		else
+		{
+			std::cerr << (import ? "snapshot_import" : "snapshot_export") << " requires one <file> option\n";
+			ec = nano::error_cli::invalid_arguments;
+		}
+	}
 	else if (vm.count ("unchecked_clear"))
 	{
 		boost::filesystem::path data_path = vm.count ("data_path") ? boost::filesystem::path (vm["data_path"].as<std::string> ()) : nano::working_path ();
@@ -491,7 +540,7 @@ std::error_code nano::handle_node_options (boost::program_options::variables_map
 		if (!node.node->init_error ())
 		{
 			auto transaction (node.node->store.tx_begin_write ());
-			node.node->store.unchecked_clear (transaction);
+			node.node->unchecked.clear (transaction);
 			std::cout << "Unchecked blocks deleted" << std::endl;
 		}
 		else
@@ -13,17 +13,23 @@ config (config_a)
 {
 }
 
-void nano::confirmation_solicitor::prepare (std::vector<nano::representative> const & representatives_a)
+void nano::confirmation_solicitor::prepare (std::shared_ptr<nano::representatives_snapshot const> const & representatives_a)
 {
 	debug_assert (!prepared);
+	debug_assert (representatives_a != nullptr);
 	requests.clear ();
 	rebroadcasted = 0;
-	/** Two copies are required as representatives can be erased from \p representatives_requests */
-	representatives_requests = representatives_a;
-	representatives_broadcasts = representatives_a;
+	representatives = representatives_a;
 	prepared = true;
 }
 
+void nano::confirmation_solicitor::prepare (std::vector<nano::representative> const & representatives_a)
+{
+	auto snapshot (std::make_shared<nano::representatives_snapshot> ());
+	snapshot->representatives = representatives_a;
+	prepare (snapshot);
+}
+
 bool nano::confirmation_solicitor::broadcast (nano::election const & election_a)
 {
 	debug_assert (prepared);
@@ -34,7 +40,7 @@ bool nano::confirmation_solicitor::broadcast (nano::election const & election_a)
 		nano::publish winner (election_a.status.winner);
 		unsigned count = 0;
 		// Directed broadcasting to principal representatives
-		for (auto i (representatives_broadcasts.begin ()), n (representatives_broadcasts.end ()); i != n && count < max_election_broadcasts; ++i)
+		for (auto i (representatives->representatives.begin ()), n (representatives->representatives.end ()); i != n && count < max_election_broadcasts; ++i)
 		{
 			auto existing (election_a.last_votes.find (i->account));
 			bool const exists (existing != election_a.last_votes.end ());
@@ -59,15 +65,15 @@ bool nano::confirmation_solicitor::add (nano::election const & election_a)
 	unsigned count = 0;
 	auto const max_channel_requests (config.confirm_req_batches_max * nano::network::confirm_req_hashes_max);
 	auto const & hash (election_a.status.winner->hash ());
-	for (auto i (representatives_requests.begin ()); i != representatives_requests.end () && count < max_election_requests;)
+	for (auto i (representatives->representatives.begin ()), n (representatives->representatives.end ()); i != n && count < max_election_requests; ++i)
 	{
-		bool full_queue (false);
-		auto rep (*i);
+		auto const & rep (*i);
 		auto existing (election_a.last_votes.find (rep.account));
 		bool const exists (existing != election_a.last_votes.end ());
 		bool const different (exists && existing->second.hash != hash);
 		if (!exists || different)
 		{
+			// Channels with a full queue are skipped, the shared snapshot is never modified
 			auto & request_queue (requests[rep.channel]);
 			if (request_queue.size () < max_channel_requests)
 			{
@@ -75,12 +81,7 @@ bool nano::confirmation_solicitor::add (nano::election const & election_a)
 				count += different ? 0 : 1;
 				error = false;
 			}
-			else
-			{
-				full_queue = true;
-			}
 		}
-		i = !full_queue ? i + 1 : representatives_requests.erase (i);
 	}
 	return error;
 }
@@ -16,6 +16,7 @@ class confirmation_solicitor final
 public:
 	confirmation_solicitor (nano::network &, nano::node_config const &);
 	/** Prepare object for batching election confirmation requests*/
+	void prepare (std::shared_ptr<nano::representatives_snapshot const> const &);
 	void prepare (std::vector<nano::representative> const &);
 	/** Broadcast the winner of an election if the broadcast limit has not been reached. Returns false if the broadcast was performed */
 	bool broadcast (nano::election const &);
@@ -35,8 +36,7 @@ private:
 	nano::node_config const & config;
 
 	unsigned rebroadcasted{ 0 };
-	std::vector<nano::representative> representatives_requests;
-	std::vector<nano::representative> representatives_broadcasts;
+	std::shared_ptr<nano::representatives_snapshot const> representatives;
 	using vector_root_hashes = std::vector<std::pair<nano::block_hash, nano::root>>;
 	std::unordered_map<std::shared_ptr<nano::transport::channel>, vector_root_hashes> requests;
 	bool prepared{ false };
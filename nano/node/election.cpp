@@ -29,8 +29,8 @@ height (block_a->sideband ().height),
 root (block_a->root ()),
 qualified_root (block_a->qualified_root ())
 {
-	last_votes.emplace (node.network_params.random.not_an_account, nano::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () });
 	last_blocks.emplace (block_a->hash (), block_a);
+	vote_put (node.network_params.random.not_an_account, nano::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () });
 }
 
 void nano::election::confirm_once (nano::unique_lock<nano::mutex> & lock_a, nano::election_status_type type_a)
@@ -50,6 +50,7 @@ void nano::election::confirm_once (nano::unique_lock<nano::mutex> & lock_a, nano
 		status.type = type_a;
 		auto const status_l = status;
 		lock_a.unlock ();
+		node.active.expedite (qualified_root);
 		node.active.add_recently_confirmed (status_l.winner->qualified_root (), status_l.winner->hash ());
 		node.process_confirmed (status_l);
 		node.background ([node_l = node.shared (), status_l, confirmation_action_l = confirmation_action]() {
@@ -151,7 +152,10 @@ void nano::election::send_confirm_req (nano::confirmation_solicitor & solicitor_
 
 void nano::election::transition_active ()
 {
-	state_change (nano::election::state_t::passive, nano::election::state_t::active);
+	if (!state_change (nano::election::state_t::passive, nano::election::state_t::active))
+	{
+		node.active.expedite (qualified_root);
+	}
 }
 
 bool nano::election::confirmed () const
@@ -179,6 +183,10 @@ void nano::election::broadcast_block (nano::confirmation_solicitor & solicitor_a
 bool nano::election::transition_time (nano::confirmation_solicitor & solicitor_a)
 {
 	bool result = false;
+	if (!confirmed ())
+	{
+		refresh_tally ();
+	}
 	switch (state_m)
 	{
 		case nano::election::state_t::passive:
@@ -210,9 +218,7 @@ bool nano::election::transition_time (nano::confirmation_solicitor & solicitor_a
 			debug_assert (false);
 			break;
 	}
-	auto const optimistic_expiration_time = node.network_params.network.is_dev_network () ? 500 : 60 * 1000;
-	auto const expire_time = std::chrono::milliseconds (optimistic () ? optimistic_expiration_time : 5 * 60 * 1000);
-	if (!confirmed () && expire_time < std::chrono::steady_clock::now () - election_start)
+	if (!confirmed () && expire_time () < std::chrono::steady_clock::now () - election_start)
 	{
 		nano::lock_guard<nano::mutex> guard (mutex);
 		// It is possible the election confirmed while acquiring the mutex
@@ -230,6 +236,42 @@ bool nano::election::transition_time (nano::confirmation_solicitor & solicitor_a
 	return result;
 }
 
+std::chrono::steady_clock::time_point nano::election::next_transition () const
+{
+	auto const base_latency_l (base_latency ());
+	std::chrono::steady_clock::time_point const state_start_l (state_start.load ());
+	auto result (std::chrono::steady_clock::now ());
+	switch (state_m)
+	{
+		case nano::election::state_t::passive:
+			result = state_start_l + base_latency_l * passive_duration_factor;
+			break;
+		case nano::election::state_t::active:
+			result = last_req + base_latency_l * (optimistic () ? 10 : 5);
+			break;
+		case nano::election::state_t::broadcasting:
+			result = std::min (last_req + base_latency_l * (optimistic () ? 10 : 5), last_block + base_latency_l * 15);
+			break;
+		case nano::election::state_t::confirmed:
+			result = state_start_l + base_latency_l * confirmed_duration_factor;
+			break;
+		case nano::election::state_t::expired_unconfirmed:
+		case nano::election::state_t::expired_confirmed:
+			break;
+	}
+	if (!confirmed ())
+	{
+		result = std::min (result, election_start + expire_time ());
+	}
+	return result;
+}
+
+std::chrono::milliseconds nano::election::expire_time () const
+{
+	auto const optimistic_expiration_time = node.network_params.network.is_dev_network () ? 500 : 60 * 1000;
+	return std::chrono::milliseconds (optimistic () ? optimistic_expiration_time : 5 * 60 * 1000);
+}
+
 bool nano::election::have_quorum (nano::tally_t const & tally_a) const
 {
 	auto i (tally_a.begin ());
@@ -249,51 +291,153 @@ nano::tally_t nano::election::tally () const
 
 nano::tally_t nano::election::tally_impl () const
 {
-	std::unordered_map<nano::block_hash, nano::uint128_t> block_weights;
-	for (auto const & [account, info] : last_votes)
+	nano::tally_t result;
+	auto const & by_weight (last_tally.get<tag_weight> ());
+	for (auto i (by_weight.begin ()), n (by_weight.end ()); i != n && i->known; ++i)
 	{
-		auto rep_weight (node.ledger.weight (account));
-		block_weights[info.hash] += rep_weight;
+		auto block (last_blocks.find (i->hash));
+		debug_assert (block != last_blocks.end ());
+		result.emplace (i->weight, block->second);
 	}
-	last_tally = block_weights;
-	nano::tally_t result;
-	for (auto const & [hash, amount] : block_weights)
+	return result;
+}
+
+bool nano::election::have_quorum_impl () const
+{
+	auto const & by_weight (last_tally.get<tag_weight> ());
+	auto i (by_weight.begin ());
+	debug_assert (i != by_weight.end () && i->known);
+	auto first (i->weight);
+	++i;
+	auto second (i != by_weight.end () && i->known ? i->weight : 0);
+	return (first - second) >= node.online_reps.delta ();
+}
+
+void nano::election::vote_put (nano::account const & rep_a, nano::vote_info const & info_a)
+{
+	auto existing (last_votes.find (rep_a));
+	if (existing != last_votes.end ())
+	{
+		tally_remove (existing->second.hash, existing->second.weight);
+		existing->second = info_a;
+	}
+	else
 	{
-		auto block (last_blocks.find (hash));
-		if (block != last_blocks.end ())
+		last_votes.emplace (rep_a, info_a);
+	}
+	tally_add (info_a.hash, info_a.weight);
+}
+
+void nano::election::vote_erase (std::unordered_map<nano::account, nano::vote_info>::iterator vote_a)
+{
+	tally_remove (vote_a->second.hash, vote_a->second.weight);
+	last_votes.erase (vote_a);
+}
+
+void nano::election::tally_add (nano::block_hash const & hash_a, nano::uint128_t const & weight_a)
+{
+	auto & by_hash (last_tally.get<tag_hash> ());
+	auto existing (by_hash.find (hash_a));
+	if (existing == by_hash.end ())
+	{
+		by_hash.insert (tally_entry{ hash_a, weight_a, 1, last_blocks.find (hash_a) != last_blocks.end () });
+	}
+	else
+	{
+		by_hash.modify (existing, [&weight_a](tally_entry & entry_a) {
+			entry_a.weight += weight_a;
+			++entry_a.votes;
+		});
+	}
+}
+
+void nano::election::tally_remove (nano::block_hash const & hash_a, nano::uint128_t const & weight_a)
+{
+	auto & by_hash (last_tally.get<tag_hash> ());
+	auto existing (by_hash.find (hash_a));
+	if (existing != by_hash.end ())
+	{
+		debug_assert (existing->votes > 0 && existing->weight >= weight_a);
+		if (existing->votes == 1)
 		{
-			result.emplace (amount, block->second);
+			by_hash.erase (existing);
+		}
+		else
+		{
+			by_hash.modify (existing, [&weight_a](tally_entry & entry_a) {
+				entry_a.weight -= weight_a;
+				--entry_a.votes;
+			});
 		}
 	}
-	return result;
+}
+
+void nano::election::tally_known (nano::block_hash const & hash_a, bool known_a)
+{
+	auto & by_hash (last_tally.get<tag_hash> ());
+	auto existing (by_hash.find (hash_a));
+	if (existing != by_hash.end () && existing->known != known_a)
+	{
+		by_hash.modify (existing, [known_a](tally_entry & entry_a) {
+			entry_a.known = known_a;
+		});
+	}
+}
+
+void nano::election::refresh_tally ()
+{
+	auto now (std::chrono::steady_clock::now ());
+	nano::unique_lock<nano::mutex> lock (mutex);
+	if (now - last_tally_refresh < base_latency ())
+	{
+		return;
+	}
+	last_tally_refresh = now;
+	auto changed (false);
+	for (auto & [account, info] : last_votes)
+	{
+		auto weight (node.ledger.weight (account));
+		if (weight != info.weight)
+		{
+			tally_remove (info.hash, info.weight);
+			info.weight = weight;
+			tally_add (info.hash, info.weight);
+			changed = true;
+		}
+	}
+	if (changed && !confirmed ())
+	{
+		confirm_if_quorum (lock);
+	}
 }
 
 void nano::election::confirm_if_quorum (nano::unique_lock<nano::mutex> & lock_a)
 {
 	debug_assert (lock_a.owns_lock ());
-	auto tally_l (tally_impl ());
-	debug_assert (!tally_l.empty ());
-	auto winner (tally_l.begin ());
-	auto block_l (winner->second);
+	auto const & by_weight (last_tally.get<tag_weight> ());
+	debug_assert (!by_weight.empty () && by_weight.begin ()->known);
+	auto block_l (last_blocks.find (by_weight.begin ()->hash)->second);
 	auto const & winner_hash_l (block_l->hash ());
-	status.tally = winner->first;
+	status.tally = by_weight.begin ()->weight;
 	auto const & status_winner_hash_l (status.winner->hash ());
+	// Known blocks come first and there are at most max_blocks of them
 	nano::uint128_t sum (0);
-	for (auto & i : tally_l)
+	for (auto i (by_weight.begin ()), n (by_weight.end ()); i != n && i->known; ++i)
 	{
-		sum += i.first;
+		sum += i->weight;
 	}
+	auto quorum (have_quorum_impl ());
 	if (sum >= node.online_reps.delta () && winner_hash_l != status_winner_hash_l)
 	{
 		status.winner = block_l;
 		remove_votes (status_winner_hash_l);
 		node.block_processor.force (block_l);
 	}
-	if (have_quorum (tally_l))
+	if (quorum)
 	{
 		if (node.config.logging.vote_logging () || (node.config.logging.election_fork_tally_logging () && last_blocks.size () > 1))
 		{
-			log_votes (tally_l);
+			log_votes (tally_impl ());
 		}
 		confirm_once (lock_a, nano::election_status_type::active_confirmed_quorum);
 	}
@@ -373,7 +517,7 @@ nano::election_vote_result nano::election::vote (nano::account const & rep, uint
 		if (should_process)
 		{
 			node.stats.inc (nano::stat::type::election, nano::stat::detail::vote_new);
-			last_votes[rep] = { std::chrono::steady_clock::now (), timestamp_a, block_hash_a };
+			vote_put (rep, { std::chrono::steady_clock::now (), timestamp_a, block_hash_a, weight });
 			live_vote_action (rep);
 			if (!confirmed ())
 			{
@@ -405,6 +549,7 @@ bool nano::election::publish (std::shared_ptr<nano::block> const & block_a)
 		if (existing == last_blocks.end ())
 		{
 			last_blocks.emplace (std::make_pair (block_a->hash (), block_a));
+			tally_known (block_a->hash (), true);
 		}
 		else
 		{
@@ -447,9 +592,9 @@ size_t nano::election::insert_inactive_votes_cache (nano::inactive_cache_informa
 	nano::unique_lock<nano::mutex> lock (mutex);
 	for (auto const & [rep, timestamp] : cache_a.voters)
 	{
-		auto inserted (last_votes.emplace (rep, nano::vote_info{ std::chrono::steady_clock::time_point::min (), timestamp, cache_a.hash }));
-		if (inserted.second)
+		if (last_votes.find (rep) == last_votes.end ())
 		{
+			vote_put (rep, nano::vote_info{ std::chrono::steady_clock::time_point::min (), timestamp, cache_a.hash, node.ledger.weight (rep) });
 			node.stats.inc (nano::stat::type::election, nano::stat::detail::vote_cached);
 		}
 	}
@@ -528,7 +673,11 @@ void nano::election::remove_votes (nano::block_hash const & hash_a)
 		auto list_generated_votes (node.history.votes (root, hash_a));
 		for (auto const & vote : list_generated_votes)
 		{
-			last_votes.erase (vote->account);
+			auto existing (last_votes.find (vote->account));
+			if (existing != last_votes.end ())
+			{
+				vote_erase (existing);
+			}
 		}
 		// Clear votes cache
 		node.history.erase (root);
@@ -546,6 +695,7 @@ void nano::election::remove_block (nano::block_hash const & hash_a)
 			{
 				if (i->second.hash == hash_a)
 				{
+					tally_remove (i->second.hash, i->second.weight);
 					i = last_votes.erase (i);
 				}
 				else
@@ -555,6 +705,7 @@ void nano::election::remove_block (nano::block_hash const & hash_a)
 			}
 			node.network.publish_filter.clear (existing->second);
 			last_blocks.erase (hash_a);
+			tally_known (hash_a, false);
 		}
 	}
 }
@@ -567,7 +718,10 @@ bool nano::election::replace_by_weight (nano::unique_lock<nano::mutex> & lock_a,
 	// Sort existing blocks tally
 	std::vector<std::pair<nano::block_hash, nano::uint128_t>> sorted;
 	sorted.reserve (last_tally.size ());
-	std::copy (last_tally.begin (), last_tally.end (), std::back_inserter (sorted));
+	for (auto const & entry : last_tally)
+	{
+		sorted.emplace_back (entry.hash, entry.weight);
+	}
 	lock_a.unlock ();
 	// Sort in ascending order
 	std::sort (sorted.begin (), sorted.end (), [](auto const & left, auto const & right) { return left.second < right.second; });
@@ -4,6 +4,12 @@
 #include <nano/secure/common.hpp>
 #include <nano/secure/ledger.hpp>
 
+#include <boost/multi_index/composite_key.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index_container.hpp>
+
 #include <atomic>
 #include <chrono>
 #include <memory>
@@ -22,6 +28,8 @@ public:
 	std::chrono::steady_clock::time_point time;
 	uint64_t timestamp;
 	nano::block_hash hash;
+	// Representative weight counted for this vote in the election tally
+	nano::uint128_t weight{ 0 };
 };
 class vote_with_weight_info final
 {
@@ -91,9 +99,14 @@ private: // State management
 	bool state_change (nano::election::state_t, nano::election::state_t);
 	std::atomic<bool> prioritized_m = { false };
 
+	// Guarded by the active_transactions mutex
+	std::chrono::steady_clock::time_point transition_deadline{ std::chrono::steady_clock::time_point::max () };
+
 public: // State transitions
 	bool transition_time (nano::confirmation_solicitor &);
 	void transition_active ();
+	// Earliest time at which transition_time may have work to do
+	std::chrono::steady_clock::time_point next_transition () const;
 
 public: // Status
 	bool confirmed () const;
@@ -130,6 +143,16 @@ public: // Information
 
 private:
 	nano::tally_t tally_impl () const;
+	bool have_quorum_impl () const;
+	std::chrono::milliseconds expire_time () const;
+	// Adds or replaces the vote of a representative, keeping the tally up to date
+	void vote_put (nano::account const &, nano::vote_info const &);
+	void vote_erase (std::unordered_map<nano::account, nano::vote_info>::iterator);
+	void tally_add (nano::block_hash const &, nano::uint128_t const &);
+	void tally_remove (nano::block_hash const &, nano::uint128_t const &);
+	void tally_known (nano::block_hash const &, bool);
+	// Updates the weight of votes from representatives whose weight changed since voting, at most once per base latency
+	void refresh_tally ();
 	// lock_a does not own the mutex on return
 	void confirm_once (nano::unique_lock<nano::mutex> & lock_a, nano::election_status_type = nano::election_status_type::active_confirmed_quorum);
 	void broadcast_block (nano::confirmation_solicitor &);
@@ -144,7 +167,37 @@ private:
 private:
 	std::unordered_map<nano::block_hash, std::shared_ptr<nano::block>> last_blocks;
 	std::unordered_map<nano::account, nano::vote_info> last_votes;
-	mutable std::unordered_map<nano::block_hash, nano::uint128_t> last_tally;
+	// Votes are weighed when they arrive, so only weight changes since then need refreshing
+	std::chrono::steady_clock::time_point last_tally_refresh{ std::chrono::steady_clock::now () };
+
+	class tally_entry final
+	{
+	public:
+		nano::block_hash hash;
+		nano::uint128_t weight;
+		size_t votes;
+		// Only blocks in last_blocks take part in the tally, votes for other hashes are kept in case the block is published
+		bool known;
+	};
+	class tag_hash
+	{
+	};
+	class tag_weight
+	{
+	};
+	// Sum of vote weights per block, maintained on every vote change. Known blocks are ordered first by descending weight
+	// clang-format off
+	boost::multi_index_container<tally_entry,
+	boost::multi_index::indexed_by<
+		boost::multi_index::hashed_unique<boost::multi_index::tag<tag_hash>,
+			boost::multi_index::member<tally_entry, nano::block_hash, &tally_entry::hash>>,
+		boost::multi_index::ordered_non_unique<boost::multi_index::tag<tag_weight>,
+			boost::multi_index::composite_key<tally_entry,
+				boost::multi_index::member<tally_entry, bool, &tally_entry::known>,
+				boost::multi_index::member<tally_entry, nano::uint128_t, &tally_entry::weight>>,
+			boost::multi_index::composite_key_compare<std::greater<bool>, std::greater<nano::uint128_t>>>>>
+	last_tally;
+	// clang-format on
 
 	nano::election_behavior const behavior{ nano::election_behavior::normal };
 	std::chrono::steady_clock::time_point const election_start = { std::chrono::steady_clock::now () };
@@ -167,5 +220,7 @@ public: // Only used in tests
 	friend class confirmation_solicitor_bypass_max_requests_cap_Test;
 	friend class votes_add_existing_Test;
 	friend class votes_add_old_Test;
+	friend class election_tally_incremental_Test;
+	friend class active_transactions_transition_timers_Test;
 };
 }
@@ -1319,7 +1319,7 @@ void nano::json_handler::block_account ()
 void nano::json_handler::block_count ()
 {
 	response_l.put ("count", std::to_string (node.ledger.cache.block_count));
-	response_l.put ("unchecked", std::to_string (node.store.unchecked_count (node.store.tx_begin_read ())));
+	response_l.put ("unchecked", std::to_string (node.unchecked.count (node.store.tx_begin_read ())));
 	response_l.put ("cemented", std::to_string (node.ledger.cache.cemented_count));
 	if (node.flags.enable_pruning)
 	{
@@ -1774,6 +1774,9 @@ void nano::json_handler::bootstrap_status ()
 		connections.put ("pulls", std::to_string (node.bootstrap_initiator.connections->pulls.size ()));
 	}
 	response_l.add_child ("connections", connections);
+	boost::property_tree::ptree peers;
+	node.bootstrap_initiator.connections->peer_scores.get_information (peers);
+	response_l.add_child ("peers", peers);
 	boost::property_tree::ptree attempts;
 	{
 		nano::lock_guard<nano::mutex> attempts_lock (node.bootstrap_initiator.attempts.bootstrap_attempts_mutex);
@@ -3696,6 +3699,12 @@ void nano::json_handler::sign ()
 	response_errors ();
 }
 
+void nano::json_handler::startup_profile ()
+{
+	node.startup_profile.serialize (response_l);
+	response_errors ();
+}
+
 void nano::json_handler::stats ()
 {
 	auto sink = node.stats.log_sink_json ();
@@ -3780,7 +3789,7 @@ void nano::json_handler::telemetry ()
 					if (address.is_loopback () && port == rpc_l->node.network.endpoint ().port ())
 					{
 						// Requesting telemetry metrics locally
-						auto telemetry_data = nano::local_telemetry_data (rpc_l->node.ledger, rpc_l->node.network, rpc_l->node.config.bandwidth_limit, rpc_l->node.network_params, rpc_l->node.startup_time, rpc_l->node.active.active_difficulty (), rpc_l->node.node_id);
+						auto telemetry_data = nano::local_telemetry_data (rpc_l->node.ledger, rpc_l->node.unchecked, rpc_l->node.network, rpc_l->node.config.bandwidth_limit, rpc_l->node.network_params, rpc_l->node.startup_time, rpc_l->node.active.active_difficulty (), rpc_l->node.node_id);
 
 						nano::jsonconfig config_l;
 						auto const should_ignore_identification_metrics = false;
@@ -3928,9 +3937,7 @@ void nano::json_handler::unchecked ()
 	{
 		boost::property_tree::ptree unchecked;
 		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.unchecked_begin (transaction)), n (node.store.unchecked_end ()); i != n && unchecked.size () < count; ++i)
-		{
-			nano::unchecked_info const & info (i->second);
+		node.unchecked.for_each (transaction, nano::unchecked_key (0, 0), [&unchecked, count, json_block_l](nano::unchecked_key const &, nano::unchecked_info const & info) {
 			if (json_block_l)
 			{
 				boost::property_tree::ptree block_node_l;
@@ -3943,7 +3950,8 @@ void nano::json_handler::unchecked ()
 				info.block->serialize_json (contents);
 				unchecked.put (info.block->hash ().to_string (), contents);
 			}
-		}
+			return unchecked.size () < count;
+		});
 		response_l.add_child ("blocks", unchecked);
 	}
 	response_errors ();
@@ -3952,8 +3960,8 @@ void nano::json_handler::unchecked ()
 void nano::json_handler::unchecked_clear ()
 {
 	node.workers.push_task (create_worker_task ([](std::shared_ptr<nano::json_handler> const & rpc_l) {
-		auto transaction (rpc_l->node.store.tx_begin_write ({ tables::unchecked }));
-		rpc_l->node.store.unchecked_clear (transaction);
+		auto transaction (rpc_l->node.store.tx_begin_write ({ tables::unchecked, tables::unchecked_expiry }));
+		rpc_l->node.unchecked.clear (transaction);
 		rpc_l->response_l.put ("success", "");
 		rpc_l->response_errors ();
 	}));
@@ -3966,12 +3974,10 @@ void nano::json_handler::unchecked_get ()
 	if (!ec)
 	{
 		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.unchecked_begin (transaction)), n (node.store.unchecked_end ()); i != n; ++i)
-		{
-			nano::unchecked_key const & key (i->first);
-			if (key.hash == hash)
+		node.unchecked.for_each (transaction, nano::unchecked_key (0, 0), [this, &hash, json_block_l](nano::unchecked_key const & key, nano::unchecked_info const & info) {
+			auto found (key.hash == hash);
+			if (found)
 			{
-				nano::unchecked_info const & info (i->second);
 				response_l.put ("modified_timestamp", std::to_string (info.modified));
 
 				if (json_block_l)
@@ -3986,9 +3992,9 @@ void nano::json_handler::unchecked_get ()
 					info.block->serialize_json (contents);
 					response_l.put ("contents", contents);
 				}
-				break;
 			}
-		}
+			return !found;
+		});
 		if (response_l.empty ())
 		{
 			ec = nano::error_blocks::not_found;
@@ -4014,11 +4020,9 @@ void nano::json_handler::unchecked_keys ()
 	{
 		boost::property_tree::ptree unchecked;
 		auto transaction (node.store.tx_begin_read ());
-		for (auto i (node.store.unchecked_begin (transaction, nano::unchecked_key (key, 0))), n (node.store.unchecked_end ()); i != n && unchecked.size () < count; ++i)
-		{
+		node.unchecked.for_each (transaction, nano::unchecked_key (key, 0), [&unchecked, count, json_block_l](nano::unchecked_key const & unchecked_key, nano::unchecked_info const & info) {
 			boost::property_tree::ptree entry;
-			nano::unchecked_info const & info (i->second);
-			entry.put ("key", i->first.key ().to_string ());
+			entry.put ("key", unchecked_key.key ().to_string ());
 			entry.put ("hash", info.block->hash ().to_string ());
 			entry.put ("modified_timestamp", std::to_string (info.modified));
 			if (json_block_l)
@@ -4034,7 +4038,8 @@ void nano::json_handler::unchecked_keys ()
 				entry.put ("contents", contents);
 			}
 			unchecked.push_back (std::make_pair ("", entry));
-		}
+			return unchecked.size () < count;
+		});
 		response_l.add_child ("unchecked", unchecked);
 	}
 	response_errors ();
@@ -4227,6 +4232,7 @@ void nano::json_handler::wallet_info ()
 		response_l.put ("deterministic_count", std::to_string (deterministic_count));
 		response_l.put ("adhoc_count", std::to_string (adhoc_count));
 		response_l.put ("deterministic_index", std::to_string (deterministic_index));
+		response_l.put ("queued_actions", std::to_string (wallet->queued_actions));
 	}
 	response_errors ();
 }
@@ -5118,6 +5124,7 @@ ipc_json_handler_no_arg_func_map create_ipc_json_handler_no_arg_func_map ()
 	no_arg_funcs.emplace ("search_pending_all", &nano::json_handler::search_pending_all);
 	no_arg_funcs.emplace ("send", &nano::json_handler::send);
 	no_arg_funcs.emplace ("sign", &nano::json_handler::sign);
+	no_arg_funcs.emplace ("startup_profile", &nano::json_handler::startup_profile);
 	no_arg_funcs.emplace ("stats", &nano::json_handler::stats);
 	no_arg_funcs.emplace ("stats_clear", &nano::json_handler::stats_clear);
 	no_arg_funcs.emplace ("stop", &nano::json_handler::stop);
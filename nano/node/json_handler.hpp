@@ -95,6 +95,7 @@ public:
 	void search_pending_all ();
 	void send ();
 	void sign ();
+	void startup_profile ();
 	void stats ();
 	void stats_clear ();
 	void stop ();
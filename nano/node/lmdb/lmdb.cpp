@@ -200,6 +200,7 @@ void nano::mdb_store::open_databases (bool & error_a, nano::transaction const &
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "pending", flags, &pending_v0) != 0;
 	pending = pending_v0;
 	error_a |= mdb_dbi_open (env.tx (transaction_a), "final_votes", flags, &final_votes) != 0;
+	error_a |= mdb_dbi_open (env.tx (transaction_a), "unchecked_expiry", flags, &unchecked_expiry) != 0;
 
 	auto version_l = version_get (transaction_a);
 	if (version_l < 19)
@@ -284,6 +285,9 @@ bool nano::mdb_store::do_upgrades (nano::write_transaction & transaction_a, bool
 			upgrade_v20_to_v21 (transaction_a);
 			[[fallthrough]];
 		case 21:
+			upgrade_v21_to_v22 (transaction_a);
+			[[fallthrough]];
+		case 22:
 			break;
 		default:
 			logger.always_log (boost::str (boost::format ("The version of the ledger (%1%) is too high for this node") % version_l));
@@ -757,6 +761,15 @@ void nano::mdb_store::upgrade_v20_to_v21 (nano::write_transaction const & transa
 	logger.always_log ("Finished creating new final_vote table");
 }
 
+void nano::mdb_store::upgrade_v21_to_v22 (nano::write_transaction const & transaction_a)
+{
+	logger.always_log ("Preparing v21 to v22 database upgrade...");
+	mdb_dbi_open (env.tx (transaction_a), "unchecked_expiry", MDB_CREATE, &unchecked_expiry);
+	unchecked_expiry_rebuild (transaction_a);
+	version_put (transaction_a, 22);
+	logger.always_log ("Finished creating new unchecked_expiry table");
+}
+
 /** Takes a filepath, appends '_backup_<timestamp>' to the end (but before any extension) and saves that file in the same directory */
 void nano::mdb_store::create_backup_file (nano::mdb_env & env_a, boost::filesystem::path const & filepath_a, nano::logger_mt & logger_a)
 {
@@ -867,6 +880,8 @@ MDB_dbi nano::mdb_store::table_to_dbi (tables table_a) const
 			return pending;
 		case tables::unchecked:
 			return unchecked;
+		case tables::unchecked_expiry:
+			return unchecked_expiry;
 		case tables::online_weight:
 			return online_weight;
 		case tables::meta:
@@ -1196,5 +1211,12 @@ unsigned nano::mdb_store::max_block_write_batch_num () const
 	return std::numeric_limits<unsigned>::max ();
 }
 
+bool nano::mdb_store::snapshot_id (nano::transaction const & transaction_a, uint64_t & id_a) const
+{
+	// Read transactions carry the id of the last commit they see, write transactions the id they will commit as
+	id_a = mdb_txn_id (env.tx (transaction_a));
+	return false;
+}
+
 // Explicitly instantiate
 template class nano::block_store_partial<MDB_val, nano::mdb_store>;
@@ -52,6 +52,7 @@ public:
 	void serialize_memory_stats (boost::property_tree::ptree &) override;
 
 	unsigned max_block_write_batch_num () const override;
+	bool snapshot_id (nano::transaction const &, uint64_t &) const override;
 
 private:
 	nano::logger_mt & logger;
@@ -156,6 +157,12 @@ public:
 	 */
 	MDB_dbi unchecked{ 0 };
 
+	/**
+	 * Unchecked blocks ordered by the time they were stored, used to expire them.
+	 * nano::unchecked_expiry_key -> nano::no_value
+	 */
+	MDB_dbi unchecked_expiry{ 0 };
+
 	/**
 	 * Samples of online vote weight
 	 * uint64_t -> nano::amount
@@ -241,6 +248,7 @@ private:
 	void upgrade_v18_to_v19 (nano::write_transaction const &);
 	void upgrade_v19_to_v20 (nano::write_transaction const &);
 	void upgrade_v20_to_v21 (nano::write_transaction const &);
+	void upgrade_v21_to_v22 (nano::write_transaction const &);
 
 	std::shared_ptr<nano::block> block_get_v18 (nano::transaction const & transaction_a, nano::block_hash const & hash_a) const;
 	nano::mdb_val block_raw_get_v18 (nano::transaction const & transaction_a, nano::block_hash const & hash_a, nano::block_type & type_a) const;
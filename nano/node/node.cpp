@@ -95,13 +95,15 @@ flags (flags_a),
 work (work_a),
 distributed_work (*this),
 logger (config_a.logging.min_time_between_log_output),
-store_impl (nano::make_store (logger, application_path_a, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, config_a.backup_before_upgrade)),
+store_impl (startup_profile.measure ("store open", [&]() { return nano::make_store (logger, application_path_a, flags.read_only, true, config_a.rocksdb_config, config_a.diagnostics_config.txn_tracking, config_a.block_processor_batch_max_time, config_a.lmdb_config, config_a.backup_before_upgrade); })),
 store (*store_impl),
-wallets_store_impl (std::make_unique<nano::mdb_wallets_store> (application_path_a / "wallets.ldb", config_a.lmdb_config)),
+wallets_store_impl (startup_profile.measure ("wallets store open", [&]() { return std::make_unique<nano::mdb_wallets_store> (application_path_a / "wallets.ldb", config_a.lmdb_config); })),
 wallets_store (*wallets_store_impl),
 gap_cache (*this),
-ledger (store, stats, flags_a.generate_cache),
+ledger (startup_profile.measure ("ledger initialize", [&]() { return nano::ledger (store, stats, flags_a.generate_cache, config_a.account_info_cache_size); })),
+unchecked (store, config.unchecked_memory_limit),
 checker (config.signature_checker_threads),
+signature_cache (config.signature_cache_size),
 network (*this, config.peering_port),
 telemetry (std::make_shared<nano::telemetry> (network, workers, observers.telemetry, stats, network_params, flags.disable_ongoing_telemetry_requests)),
 bootstrap_initiator (*this),
@@ -109,7 +111,7 @@ bootstrap (config.peering_port, *this),
 application_path (application_path_a),
 port_mapping (*this),
 rep_crawler (*this),
-vote_processor (checker, active, observers, stats, config, flags, logger, online_reps, rep_crawler, ledger, network_params),
+vote_processor (checker, signature_cache, active, observers, stats, config, flags, logger, online_reps, rep_crawler, ledger, network_params),
 warmed_up (0),
 block_processor (*this, write_database_queue),
 // clang-format off
@@ -124,12 +126,13 @@ vote_uniquer (block_uniquer),
 confirmation_height_processor (ledger, write_database_queue, config.conf_height_processor_batch_min_time, config.logging, logger, node_initialized_latch, flags.confirmation_height_processor_mode),
 active (*this, confirmation_height_processor),
 aggregator (network_params.network, config, stats, active.generator, history, ledger, wallets, active),
-wallets (wallets_store.init_error (), *this),
+wallets (startup_profile.measure ("wallets load", [&]() { return nano::wallets (wallets_store.init_error (), *this); })),
 startup_time (std::chrono::steady_clock::now ()),
 node_seq (seq)
 {
 	if (!init_error ())
 	{
+		nano::startup_profile::phase initialization_phase (startup_profile, "node initialization");
 		telemetry->start ();
 
 		if (config.websocket_config.enabled)
@@ -364,6 +367,17 @@ node_seq (seq)
 			store.initialize (transaction, genesis, ledger.cache);
 		}
 
+		for (auto const & timing : ledger.initialize_timings)
+		{
+			logger.always_log (boost::str (boost::format ("Ledger cache %1% in %2% ms") % timing.first % timing.second.count ()));
+		}
+		startup_profile.add_steps ("ledger initialize", ledger.initialize_timings);
+		if (!flags.read_only)
+		{
+			// The ledger is written to from now on, a checkpoint loaded at startup would go stale
+			ledger.checkpoint_clear ();
+		}
+
 		if (!ledger.block_exists (genesis.hash ()))
 		{
 			std::stringstream ss;
@@ -417,12 +431,20 @@ node_seq (seq)
 			// Drop unchecked blocks if initial bootstrap is completed
 			if (!flags.disable_unchecked_drop && !use_bootstrap_weight && !flags.read_only)
 			{
-				auto transaction (store.tx_begin_write ({ tables::unchecked }));
-				store.unchecked_clear (transaction);
+				auto transaction (store.tx_begin_write ({ tables::unchecked, tables::unchecked_expiry }));
+				unchecked.clear (transaction);
 				logger.always_log ("Dropping unchecked blocks");
 			}
 		}
 
+		// Unchecked blocks stored in the ledger by an earlier run would otherwise never be processed nor expired
+		if (unchecked.memory () && !flags.read_only && store.unchecked_count (store.tx_begin_read ()) > 0)
+		{
+			auto transaction (store.tx_begin_write ({ tables::unchecked, tables::unchecked_expiry }));
+			store.unchecked_clear (transaction);
+			logger.always_log ("Dropping unchecked blocks stored in the ledger, unchecked blocks are kept in memory");
+		}
+
 		ledger.pruning = flags.enable_pruning || store.pruned_count (store.tx_begin_read ()) > 0;
 
 		if (ledger.pruning)
@@ -545,7 +567,7 @@ void nano::node::process_fork (nano::transaction const & transaction_a, std::sha
 				if (auto this_l = this_w.lock ())
 				{
 					auto attempt (this_l->bootstrap_initiator.current_attempt ());
-					if (attempt && attempt->mode == nano::bootstrap_mode::legacy)
+					if (attempt && (attempt->mode == nano::bootstrap_mode::legacy || attempt->mode == nano::bootstrap_mode::ascending))
 					{
 						auto transaction (this_l->store.tx_begin_read ());
 						nano::account account{ 0 };
@@ -579,6 +601,7 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (no
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (collect_container_info (node.work, "work"));
 	composite->add_component (collect_container_info (node.gap_cache, "gap_cache"));
+	composite->add_component (collect_container_info (node.unchecked, "unchecked"));
 	composite->add_component (collect_container_info (node.ledger, "ledger"));
 	composite->add_component (collect_container_info (node.active, "active"));
 	composite->add_component (collect_container_info (node.bootstrap_initiator, "bootstrap_initiator"));
@@ -592,6 +615,7 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (no
 	composite->add_component (collect_container_info (node.observers, "observers"));
 	composite->add_component (collect_container_info (node.wallets, "wallets"));
 	composite->add_component (collect_container_info (node.vote_processor, "vote_processor"));
+	composite->add_component (collect_container_info (node.signature_cache, "signature_cache"));
 	composite->add_component (collect_container_info (node.rep_crawler, "rep_crawler"));
 	composite->add_component (collect_container_info (node.block_processor, "block_processor"));
 	composite->add_component (collect_container_info (node.block_arrival, "block_arrival"));
@@ -643,9 +667,9 @@ void nano::node::process_local_async (std::shared_ptr<nano::block> const & block
 
 void nano::node::start ()
 {
-	long_inactivity_cleanup ();
-	network.start ();
-	add_initial_peers ();
+	startup_profile.measure ("long inactivity cleanup", [this]() { long_inactivity_cleanup (); });
+	startup_profile.measure ("network start", [this]() { network.start (); });
+	startup_profile.measure ("initial peers", [this]() { add_initial_peers (); });
 	if (!flags.disable_legacy_bootstrap && !flags.disable_ongoing_bootstrap)
 	{
 		ongoing_bootstrap ();
@@ -674,16 +698,16 @@ void nano::node::start ()
 	bool tcp_enabled (false);
 	if (config.tcp_incoming_connections_max > 0 && !(flags.disable_bootstrap_listener && flags.disable_tcp_realtime))
 	{
-		bootstrap.start ();
+		startup_profile.measure ("bootstrap listener start", [this]() { bootstrap.start (); });
 		tcp_enabled = true;
 	}
 	if (!flags.disable_backup)
 	{
-		backup_wallet ();
+		startup_profile.measure ("wallet backup", [this]() { backup_wallet (); });
 	}
 	if (!flags.disable_search_pending)
 	{
-		search_pending ();
+		startup_profile.measure ("search pending", [this]() { search_pending (); });
 	}
 	if (!flags.disable_wallet_bootstrap)
 	{
@@ -698,6 +722,14 @@ void nano::node::start ()
 	{
 		port_mapping.start ();
 	}
+	startup_profile.complete ();
+	if (flags.startup_profile)
+	{
+		for (auto const & line : startup_profile.to_strings ())
+		{
+			logger.always_log (line);
+		}
+	}
 }
 
 void nano::node::stop ()
@@ -735,6 +767,11 @@ void nano::node::stop ()
 			epoch_upgrade->wait ();
 		}
 		workers.stop ();
+		if (!flags.read_only && !flags.inactive_node)
+		{
+			// Written last so no commit follows it, which would invalidate it
+			ledger.checkpoint_write ();
+		}
 		// work pool is not stopped on purpose due to testing setup
 	}
 }
@@ -968,44 +1005,29 @@ void nano::node::bootstrap_wallet ()
 void nano::node::unchecked_cleanup ()
 {
 	std::vector<nano::uint128_t> digests;
-	std::deque<nano::unchecked_key> cleaning_list;
 	auto attempt (bootstrap_initiator.current_attempt ());
 	bool long_attempt (attempt != nullptr && std::chrono::duration_cast<std::chrono::seconds> (std::chrono::steady_clock::now () - attempt->attempt_start).count () > config.unchecked_cutoff_time.count ());
-	// Collect old unchecked keys
 	if (ledger.cache.block_count >= ledger.bootstrap_weight_max_blocks && !long_attempt)
 	{
-		auto now (nano::seconds_since_epoch ());
-		auto transaction (store.tx_begin_read ());
-		// Max 1M records to clean, max 2 minutes reading to prevent slow i/o systems issues
-		for (auto i (store.unchecked_begin (transaction)), n (store.unchecked_end ()); i != n && cleaning_list.size () < 1024 * 1024 && nano::seconds_since_epoch () - now < 120; ++i)
+		auto cutoff (nano::seconds_since_epoch () - static_cast<uint64_t> (config.unchecked_cutoff_time.count ()));
+		// Old entries are deleted in time order in batches, at most 1M per cleanup
+		size_t const batch_size (2 * 1024);
+		for (auto done (false); !done && digests.size () < 1024 * 1024;)
 		{
-			nano::unchecked_key const & key (i->first);
-			nano::unchecked_info const & info (i->second);
-			if ((now - info.modified) > static_cast<uint64_t> (config.unchecked_cutoff_time.count ()))
+			std::vector<nano::unchecked_info> expired;
+			{
+				auto transaction (store.tx_begin_write ({ tables::unchecked, tables::unchecked_expiry }));
+				done = unchecked.expire (transaction, cutoff, batch_size, expired) < batch_size;
+			}
+			for (auto const & info : expired)
 			{
 				digests.push_back (network.publish_filter.hash (info.block));
-				cleaning_list.push_back (key);
 			}
 		}
 	}
-	if (!cleaning_list.empty ())
+	if (!digests.empty ())
 	{
-		logger.always_log (boost::str (boost::format ("Deleting %1% old unchecked blocks") % cleaning_list.size ()));
-	}
-	// Delete old unchecked keys in batches
-	while (!cleaning_list.empty ())
-	{
-		size_t deleted_count (0);
-		auto transaction (store.tx_begin_write ({ tables::unchecked }));
-		while (deleted_count++ < 2 * 1024 && !cleaning_list.empty ())
-		{
-			auto key (cleaning_list.front ());
-			cleaning_list.pop_front ();
-			if (store.unchecked_exists (transaction, key))
-			{
-				store.unchecked_del (transaction, key);
-			}
-		}
+		logger.always_log (boost::str (boost::format ("Deleted %1% old unchecked blocks") % digests.size ()));
 	}
 	// Delete from the duplicate filter
 	network.publish_filter.clear (digests);
@@ -1022,107 +1044,176 @@ void nano::node::ongoing_unchecked_cleanup ()
 
 bool nano::node::collect_ledger_pruning_targets (std::deque<nano::block_hash> & pruning_targets_a, nano::account & last_account_a, uint64_t const batch_read_size_a, uint64_t const max_depth_a, uint64_t const cutoff_time_a)
 {
-	uint64_t read_operations (0);
-	bool finish_transaction (false);
-	auto transaction (store.tx_begin_read ());
-	for (auto i (store.confirmation_height_begin (transaction, last_account_a)), n (store.confirmation_height_end ()); i != n && !finish_transaction;)
+	// Read the frontiers of the next window of accounts
+	std::vector<nano::block_hash> frontiers;
+	bool finished (true);
 	{
-		++read_operations;
-		auto const & account (i->first);
-		nano::block_hash hash (i->second.frontier);
-		uint64_t depth (0);
-		while (!hash.is_zero () && depth < max_depth_a)
+		auto transaction (store.tx_begin_read ());
+		for (auto i (store.confirmation_height_begin (transaction, last_account_a)), n (store.confirmation_height_end ()); i != n && finished; ++i)
 		{
-			auto block (store.block_get (transaction, hash));
-			if (block != nullptr)
+			if (frontiers.size () < batch_read_size_a)
 			{
-				if (block->sideband ().timestamp > cutoff_time_a || depth == 0)
+				frontiers.push_back (i->second.frontier);
+			}
+			else
+			{
+				last_account_a = i->first;
+				finished = false;
+			}
+		}
+	}
+	// Walk the chains of the window in parallel, only the previous hash and the sideband timestamp of each block are read
+	size_t const chains_per_thread (256);
+	size_t const thread_count (std::min<size_t> (std::max (1u, std::thread::hardware_concurrency ()), (frontiers.size () + chains_per_thread - 1) / chains_per_thread));
+	std::vector<std::vector<nano::block_hash>> targets (thread_count);
+	std::atomic<uint64_t> reads{ 0 };
+	auto collect = [this, &frontiers, &targets, &reads, thread_count, batch_read_size_a, max_depth_a, cutoff_time_a](size_t const thread_a) {
+		auto transaction (store.tx_begin_read ());
+		uint64_t reads_l (0);
+		for (auto i (frontiers.size () * thread_a / thread_count), n (frontiers.size () * (thread_a + 1) / thread_count); i < n; ++i)
+		{
+			nano::block_hash hash (frontiers[i]);
+			uint64_t depth (0);
+			while (!hash.is_zero () && depth < max_depth_a)
+			{
+				nano::block_hash previous;
+				uint64_t timestamp (0);
+				if (!store.block_previous_timestamp_get (transaction, hash, previous, timestamp))
 				{
-					hash = block->previous ();
+					if (timestamp > cutoff_time_a || depth == 0)
+					{
+						hash = previous;
+					}
+					else
+					{
+						break;
+					}
 				}
 				else
 				{
-					break;
+					release_assert (depth != 0);
+					hash = 0;
+				}
+				++depth;
+				if (++reads_l % batch_read_size_a == 0)
+				{
+					transaction.refresh ();
 				}
 			}
-			else
-			{
-				release_assert (depth != 0);
-				hash = 0;
-			}
-			if (++depth % batch_read_size_a == 0)
+			if (!hash.is_zero ())
 			{
-				transaction.refresh ();
+				targets[thread_a].push_back (hash);
 			}
 		}
-		if (!hash.is_zero ())
-		{
-			pruning_targets_a.push_back (hash);
-		}
-		read_operations += depth;
-		if (read_operations >= batch_read_size_a)
+		reads += reads_l;
+	};
+	if (thread_count > 0)
+	{
+		std::vector<std::thread> threads;
+		threads.reserve (thread_count - 1);
+		for (size_t thread (1); thread < thread_count; ++thread)
 		{
-			last_account_a = account.number () + 1;
-			finish_transaction = true;
+			threads.emplace_back ([&collect, thread]() {
+				nano::thread_role::set (nano::thread_role::name::db_parallel_traversal);
+				collect (thread);
+			});
 		}
-		else
+		collect (0);
+		for (auto & thread : threads)
 		{
-			++i;
+			thread.join ();
 		}
 	}
-	return !finish_transaction || last_account_a.is_zero ();
+	size_t targets_count (0);
+	for (auto const & targets_l : targets)
+	{
+		pruning_targets_a.insert (pruning_targets_a.end (), targets_l.begin (), targets_l.end ());
+		targets_count += targets_l.size ();
+	}
+	stats.add (nano::stat::type::pruning, nano::stat::detail::sideband_reads, nano::stat::dir::in, reads);
+	stats.add (nano::stat::type::pruning, nano::stat::detail::targets_found, nano::stat::dir::in, targets_count);
+	return finished;
 }
 
 void nano::node::ledger_pruning (uint64_t const batch_size_a, bool bootstrap_weight_reached_a, bool log_to_cout_a)
 {
 	uint64_t const max_depth (config.max_pruning_depth != 0 ? config.max_pruning_depth : std::numeric_limits<uint64_t>::max ());
 	uint64_t const cutoff_time (bootstrap_weight_reached_a ? nano::seconds_since_epoch () - config.max_pruning_age.count () : std::numeric_limits<uint64_t>::max ());
+	class pruning_window final
+	{
+	public:
+		std::deque<nano::block_hash> targets;
+		nano::account next;
+		bool finished;
+	};
+	auto collect = [this, batch_size_a, max_depth, cutoff_time](nano::account const & start_a) {
+		pruning_window result{ {}, start_a, false };
+		result.finished = collect_ledger_pruning_targets (result.targets, result.next, batch_size_a * 2, max_depth, cutoff_time);
+		return result;
+	};
+	auto log = [this, log_to_cout_a](std::string const & message_a, bool always_a) {
+		if (log_to_cout_a)
+		{
+			std::cout << message_a << std::endl;
+		}
+		else if (always_a)
+		{
+			logger.always_log (message_a);
+		}
+		else
+		{
+			logger.try_log (message_a);
+		}
+	};
+	auto const start_time (std::chrono::steady_clock::now ());
+	auto blocks_per_second = [&start_time](uint64_t const count_a) {
+		auto elapsed (std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - start_time).count ());
+		return count_a * 1000 / std::max<uint64_t> (elapsed, 1);
+	};
 	uint64_t pruned_count (0);
-	uint64_t transaction_write_count (0);
-	nano::account last_account (1); // 0 Burn account is never opened. So it can be used to break loop
-	std::deque<nano::block_hash> pruning_targets;
-	bool target_finished (false);
-	while ((transaction_write_count != 0 || !target_finished) && !stopped)
+	// An interrupted pass resumes from its last completed window. 0 Burn account is never opened, so a new pass starts from 1
+	nano::account start (store.pruning_progress_get (store.tx_begin_read ()));
+	auto window (collect (start.is_zero () ? nano::account (1) : start));
+	while (!stopped)
 	{
-		// Search pruning targets
-		while (pruning_targets.size () < batch_size_a && !target_finished && !stopped)
+		// Read ahead the next window while the targets of the current one are deleted
+		std::future<pruning_window> next;
+		if (!window.finished)
 		{
-			target_finished = collect_ledger_pruning_targets (pruning_targets, last_account, batch_size_a * 2, max_depth, cutoff_time);
+			next = std::async (std::launch::async, collect, window.next);
 		}
-		// Pruning write operation
-		transaction_write_count = 0;
-		if (!pruning_targets.empty () && !stopped)
+		while (!window.targets.empty () && !stopped)
 		{
 			auto scoped_write_guard = write_database_queue.wait (nano::writer::pruning);
-			auto write_transaction (store.tx_begin_write ({ tables::blocks, tables::pruned }));
-			while (!pruning_targets.empty () && transaction_write_count < batch_size_a && !stopped)
+			auto write_transaction (store.tx_begin_write ({ tables::blocks, tables::meta, tables::pruned }));
+			uint64_t transaction_write_count (0);
+			while (!window.targets.empty () && transaction_write_count < batch_size_a && !stopped)
 			{
-				auto const & pruning_hash (pruning_targets.front ());
-				auto account_pruned_count (ledger.pruning_action (write_transaction, pruning_hash, batch_size_a));
-				transaction_write_count += account_pruned_count;
-				pruning_targets.pop_front ();
+				transaction_write_count += ledger.pruning_action (write_transaction, window.targets.front (), batch_size_a);
+				window.targets.pop_front ();
 			}
-			pruned_count += transaction_write_count;
-			auto log_message (boost::str (boost::format ("%1% blocks pruned") % pruned_count));
-			if (!log_to_cout_a)
+			if (window.targets.empty ())
 			{
-				logger.try_log (log_message);
-			}
-			else
-			{
-				std::cout << log_message << std::endl;
+				store.pruning_progress_put (write_transaction, window.finished ? nano::account (0) : window.next);
 			}
+			pruned_count += transaction_write_count;
+			stats.add (nano::stat::type::pruning, nano::stat::detail::blocks_pruned, nano::stat::dir::out, transaction_write_count);
+			log (boost::str (boost::format ("%1% blocks pruned (%2% blocks/s)") % pruned_count % blocks_per_second (pruned_count)), false);
 		}
+		if (window.finished || stopped)
+		{
+			break;
+		}
+		window = next.get ();
 	}
-	auto log_message (boost::str (boost::format ("Total recently pruned block count: %1%") % pruned_count));
-	if (!log_to_cout_a)
-	{
-		logger.always_log (log_message);
-	}
-	else
+	if (window.finished && !stopped && !store.pruning_progress_get (store.tx_begin_read ()).is_zero ())
 	{
-		std::cout << log_message << std::endl;
+		// The last windows had nothing to prune, the next pass starts over
+		auto scoped_write_guard = write_database_queue.wait (nano::writer::pruning);
+		auto write_transaction (store.tx_begin_write ({ tables::meta }));
+		store.pruning_progress_put (write_transaction, nano::account (0));
 	}
+	log (boost::str (boost::format ("Total recently pruned block count: %1% (%2% blocks/s)") % pruned_count % blocks_per_second (pruned_count)), true);
 }
 
 void nano::node::ongoing_ledger_pruning ()
@@ -111,6 +111,15 @@ nano::error nano::node_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("frontiers_confirmation", serialize_frontiers_confirmation (frontiers_confirmation), "Mode controlling frontier confirmation rate.\ntype:string,{auto,always,disabled}");
 	toml.put ("max_queued_requests", max_queued_requests, "Limit for number of queued confirmation requests for one channel, after which new requests are dropped until the queue drops below this value.\ntype:uint32");
 	toml.put ("confirm_req_batches_max", confirm_req_batches_max, "Limit for the number of confirmation requests for one channel per request attempt\ntype:uint32");
+	toml.put ("wallet_action_threads", wallet_action_threads, "Number of threads executing wallet actions (sends, receives, changes and work caching) for different accounts concurrently. Defaults to the number of CPU threads, at most 4.\ntype:uint64");
+	toml.put ("kdf_threads", kdf_threads, "Number of wallet password key derivations running concurrently, for example when unlocking wallets at startup. Each derivation uses 64MB of memory.\ntype:uint64");
+	toml.put ("unchecked_memory_limit", unchecked_memory_limit, "Keep unchecked blocks only in memory instead of in the ledger, bounded to this many entries, the oldest being dropped first. Unchecked blocks are then lost on restart. 0 stores them in the ledger.\ntype:uint64");
+	toml.put ("vote_generator_threads", vote_generator_threads, "Number of threads signing votes generated by this node when it is a representative. Defaults to half the number of CPU threads, at most 4.\ntype:uint64");
+	toml.put ("signature_cache_size", signature_cache_size, "Number of recently verified vote and block signatures remembered so that duplicates are not verified again. Each entry uses 128 bytes, 0 disables the cache.\ntype:uint64");
+	toml.put ("account_info_cache_size", account_info_cache_size, "Memory in bytes used to cache account info of recently used accounts so that block processing and RPC lookups skip the ledger. Only used with LMDB, 0 disables the cache.\ntype:uint64");
+	toml.put ("bootstrap_frontier_refill_size", bootstrap_frontier_refill_size, "Number of frontiers read from the ledger at a time when serving a frontier request, each read is sent to the peer as a single write.\ntype:uint64");
+	toml.put ("lazy_bootstrap_memory_limit", lazy_bootstrap_memory_limit, "Soft limit in bytes on the memory used by a lazy bootstrap attempt. Past the limit block balances and state blocks waiting for their previous block are no longer tracked and their links are pulled speculatively instead. Processed blocks and queued pulls are not limited.\ntype:uint64");
+	toml.put ("bootstrap_ascending", bootstrap_ascending, "Run full bootstraps as ascending attempts, which split the account space into ranges requested from several peers at once and remember their progress across restarts.\ntype:bool");
 
 	auto work_peers_l (toml.create_array ("work_peers", "A list of \"address:port\" entries to identify work peers."));
 	for (auto i (work_peers.begin ()), n (work_peers.end ()); i != n; ++i)
@@ -374,6 +383,15 @@ nano::error nano::node_config::deserialize_toml (nano::tomlconfig & toml)
 
 		toml.get<uint32_t> ("max_queued_requests", max_queued_requests);
 		toml.get<uint32_t> ("confirm_req_batches_max", confirm_req_batches_max);
+		toml.get<unsigned> ("wallet_action_threads", wallet_action_threads);
+		toml.get<unsigned> ("kdf_threads", kdf_threads);
+		toml.get<uint64_t> ("unchecked_memory_limit", unchecked_memory_limit);
+		toml.get<unsigned> ("vote_generator_threads", vote_generator_threads);
+		toml.get<size_t> ("signature_cache_size", signature_cache_size);
+		toml.get<size_t> ("account_info_cache_size", account_info_cache_size);
+		toml.get<size_t> ("bootstrap_frontier_refill_size", bootstrap_frontier_refill_size);
+		toml.get<uint64_t> ("lazy_bootstrap_memory_limit", lazy_bootstrap_memory_limit);
+		toml.get<bool> ("bootstrap_ascending", bootstrap_ascending);
 
 		if (toml.has_key ("frontiers_confirmation"))
 		{
@@ -447,6 +465,22 @@ nano::error nano::node_config::deserialize_toml (nano::tomlconfig & toml)
 		{
 			toml.get_error ().set ("confirm_req_batches_max must be between 1 and 100");
 		}
+		if (wallet_action_threads == 0)
+		{
+			toml.get_error ().set ("wallet_action_threads must be non-zero");
+		}
+		if (kdf_threads == 0)
+		{
+			toml.get_error ().set ("kdf_threads must be non-zero");
+		}
+		if (vote_generator_threads == 0)
+		{
+			toml.get_error ().set ("vote_generator_threads must be non-zero");
+		}
+		if (bootstrap_frontier_refill_size == 0)
+		{
+			toml.get_error ().set ("bootstrap_frontier_refill_size must be non-zero");
+		}
 	}
 	catch (std::runtime_error const & ex)
 	{
@@ -101,6 +101,19 @@ public:
 	uint32_t max_queued_requests{ 512 };
 	/** Maximum amount of confirmation requests (batches) to be sent to each channel */
 	uint32_t confirm_req_batches_max{ network_params.network.is_dev_network () ? 1u : 2u };
+	/** Number of threads executing queued wallet actions, actions for the same account are never executed concurrently */
+	unsigned wallet_action_threads{ std::min<unsigned> (4, std::max<unsigned> (1, std::thread::hardware_concurrency ())) };
+	/** Number of wallet password key derivations run concurrently, each one allocates 64MB */
+	unsigned kdf_threads{ std::min<unsigned> (2, std::max<unsigned> (1, std::thread::hardware_concurrency ())) };
+	/** Keep unchecked blocks only in memory, bounded to this many entries. 0 stores them in the ledger */
+	uint64_t unchecked_memory_limit{ 0 };
+	unsigned vote_generator_threads{ std::min<unsigned> (4, std::max<unsigned> (1, std::thread::hardware_concurrency () / 2)) };
+	size_t signature_cache_size{ 64 * 1024 };
+	/** Memory in bytes of the ledger account info cache, 0 disables it */
+	size_t account_info_cache_size{ 0 };
+	size_t bootstrap_frontier_refill_size{ 1024 };
+	uint64_t lazy_bootstrap_memory_limit{ 256 * 1024 * 1024 };
+	bool bootstrap_ascending{ false };
 	std::chrono::seconds max_pruning_age{ !network_params.network.is_beta_network () ? std::chrono::seconds (24 * 60 * 60) : std::chrono::seconds (5 * 60) }; // 1 day; 5 minutes for beta network
 	uint64_t max_pruning_depth{ 0 };
 	nano::rocksdb_config rocksdb_config;
@@ -147,6 +160,7 @@ public:
 	bool disable_search_pending{ false }; // For testing only
 	bool enable_pruning{ false };
 	bool fast_bootstrap{ false };
+	bool startup_profile{ false };
 	bool read_only{ false };
 	nano::confirmation_height_mode confirmation_height_processor_mode{ nano::confirmation_height_mode::automatic };
 	nano::generate_cache generate_cache;
@@ -12,22 +12,42 @@ config{ config_a }
 		auto transaction (ledger.store.tx_begin_read ());
 		trended_m = calculate_trend (transaction);
 	}
+	update_delta ();
 }
 
 void nano::online_reps::observe (nano::account const & rep_a)
 {
-	if (ledger.weight (rep_a) > 0)
+	auto weight (ledger.weight (rep_a));
+	if (weight > 0)
 	{
 		nano::lock_guard<nano::mutex> lock (mutex);
 		auto now = std::chrono::steady_clock::now ();
-		auto new_insert = reps.get<tag_account> ().erase (rep_a) == 0;
-		reps.insert ({ now, rep_a });
-		auto cutoff = reps.get<tag_time> ().lower_bound (now - std::chrono::seconds (config.network_params.node.weight_period));
-		auto trimmed = reps.get<tag_time> ().begin () != cutoff;
-		reps.get<tag_time> ().erase (reps.get<tag_time> ().begin (), cutoff);
-		if (new_insert || trimmed)
+		auto online_l (online_m);
+		auto & by_account (reps.get<tag_account> ());
+		auto existing (by_account.find (rep_a));
+		if (existing != by_account.end ())
 		{
-			online_m = calculate_online ();
+			online_l = online_l - existing->weight + weight;
+			by_account.modify (existing, [now, &weight](rep_info & info_a) {
+				info_a.time = now;
+				info_a.weight = weight;
+			});
+		}
+		else
+		{
+			online_l += weight;
+			reps.insert ({ now, rep_a, weight });
+		}
+		auto & by_time (reps.get<tag_time> ());
+		auto cutoff = by_time.lower_bound (now - std::chrono::seconds (config.network_params.node.weight_period));
+		for (auto i (by_time.begin ()); i != cutoff; i = by_time.erase (i))
+		{
+			online_l -= i->weight;
+		}
+		if (online_l != online_m)
+		{
+			online_m = online_l;
+			update_delta ();
 		}
 	}
 }
@@ -35,6 +55,8 @@ void nano::online_reps::observe (nano::account const & rep_a)
 void nano::online_reps::sample ()
 {
 	nano::unique_lock<nano::mutex> lock (mutex);
+	// Weights of representatives that have not voted recently may have changed, correct the running sum
+	online_m = calculate_online ();
 	nano::uint128_t online_l = online_m;
 	lock.unlock ();
 	nano::uint128_t trend_l;
@@ -52,18 +74,31 @@ void nano::online_reps::sample ()
 	}
 	lock.lock ();
 	trended_m = trend_l;
+	update_delta ();
 }
 
-nano::uint128_t nano::online_reps::calculate_online () const
+nano::uint128_t nano::online_reps::calculate_online ()
 {
 	nano::uint128_t current;
-	for (auto & i : reps)
+	auto & by_account (reps.get<tag_account> ());
+	for (auto i (by_account.begin ()), n (by_account.end ()); i != n; ++i)
 	{
-		current += ledger.weight (i.account);
+		auto weight (ledger.weight (i->account));
+		by_account.modify (i, [&weight](rep_info & info_a) {
+			info_a.weight = weight;
+		});
+		current += weight;
 	}
 	return current;
 }
 
+void nano::online_reps::update_delta ()
+{
+	// Using a larger container to ensure maximum precision
+	auto weight = static_cast<nano::uint256_t> (std::max ({ online_m, trended_m, config.online_weight_minimum.number () }));
+	delta_m.store (((weight * online_weight_quorum) / 100).convert_to<nano::uint128_t> ());
+}
+
 nano::uint128_t nano::online_reps::calculate_trend (nano::transaction & transaction_a) const
 {
 	std::vector<nano::uint128_t> items;
@@ -95,10 +130,7 @@ nano::uint128_t nano::online_reps::online () const
 
 nano::uint128_t nano::online_reps::delta () const
 {
-	nano::lock_guard<nano::mutex> lock (mutex);
-	// Using a larger container to ensure maximum precision
-	auto weight = static_cast<nano::uint256_t> (std::max ({ online_m, trended_m, config.online_weight_minimum.number () }));
-	return ((weight * online_weight_quorum) / 100).convert_to<nano::uint128_t> ();
+	return delta_m.load ();
 }
 
 std::vector<nano::account> nano::online_reps::list ()
@@ -114,6 +146,34 @@ void nano::online_reps::clear ()
 	nano::lock_guard<nano::mutex> lock (mutex);
 	reps.clear ();
 	online_m = 0;
+	update_delta ();
+}
+
+nano::uint128_t nano::online_reps::amount_snapshot::load () const
+{
+	uint64_t sequence_begin;
+	uint64_t sequence_end;
+	uint64_t high_l;
+	uint64_t low_l;
+	do
+	{
+		sequence_begin = sequence.load (std::memory_order_acquire);
+		high_l = high.load (std::memory_order_relaxed);
+		low_l = low.load (std::memory_order_relaxed);
+		std::atomic_thread_fence (std::memory_order_acquire);
+		sequence_end = sequence.load (std::memory_order_relaxed);
+	} while (sequence_begin != sequence_end || sequence_begin % 2 != 0);
+	return (nano::uint128_t (high_l) << 64) | low_l;
+}
+
+void nano::online_reps::amount_snapshot::store (nano::uint128_t const & amount_a)
+{
+	auto sequence_l (sequence.load (std::memory_order_relaxed));
+	sequence.store (sequence_l + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence (std::memory_order_release);
+	high.store (static_cast<uint64_t> (amount_a >> 64), std::memory_order_relaxed);
+	low.store (static_cast<uint64_t> (amount_a & std::numeric_limits<uint64_t>::max ()), std::memory_order_relaxed);
+	sequence.store (sequence_l + 2, std::memory_order_release);
 }
 
 std::unique_ptr<nano::container_info_component> nano::collect_container_info (online_reps & online_reps, std::string const & name)
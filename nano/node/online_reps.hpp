@@ -9,6 +9,7 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <atomic>
 #include <memory>
 #include <unordered_set>
 #include <vector>
@@ -32,7 +33,7 @@ public:
 	nano::uint128_t trended () const;
 	/** Returns the current online stake */
 	nano::uint128_t online () const;
-	/** Returns the quorum required for confirmation*/
+	/** Returns the quorum required for confirmation, without locking */
 	nano::uint128_t delta () const;
 	/** List of online representatives, both the currently sampling ones and the ones observed in the previous sampling period */
 	std::vector<nano::account> list ();
@@ -45,6 +46,21 @@ private:
 	public:
 		std::chrono::steady_clock::time_point time;
 		nano::account account;
+		/** Weight of the representative when last observed, included in online_m */
+		nano::uint128_t weight;
+	};
+	/** Amount that can be read without locking. Writers must be serialized, which the online_reps mutex does */
+	class amount_snapshot final
+	{
+	public:
+		nano::uint128_t load () const;
+		void store (nano::uint128_t const &);
+
+	private:
+		// Odd while a store is in progress
+		std::atomic<uint64_t> sequence{ 0 };
+		std::atomic<uint64_t> high{ 0 };
+		std::atomic<uint64_t> low{ 0 };
 	};
 	class tag_time
 	{
@@ -53,7 +69,9 @@ private:
 	{
 	};
 	nano::uint128_t calculate_trend (nano::transaction &) const;
-	nano::uint128_t calculate_online () const;
+	/** Refreshes the weight of every representative and returns the sum */
+	nano::uint128_t calculate_online ();
+	void update_delta ();
 	mutable nano::mutex mutex;
 	nano::ledger & ledger;
 	nano::node_config const & config;
@@ -65,8 +83,10 @@ private:
 	boost::multi_index::member<rep_info, nano::account, &rep_info::account>>>>
 	reps;
 	nano::uint128_t trended_m;
+	/** Running sum of the weight of representatives in reps */
 	nano::uint128_t online_m;
 	nano::uint128_t minimum;
+	amount_snapshot delta_m;
 
 	friend class election_quorum_minimum_update_weight_before_quorum_checks_Test;
 	friend std::unique_ptr<container_info_component> collect_container_info (online_reps & online_reps, std::string const & name);
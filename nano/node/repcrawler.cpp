@@ -69,6 +69,7 @@ void nano::rep_crawler::validate ()
 				lock.unlock ();
 				if (updated_or_inserted)
 				{
+					update_principals ();
 					node.logger.try_log (boost::str (boost::format ("Found a representative at %1%") % channel->to_string ()));
 				}
 			}
@@ -283,7 +284,7 @@ void nano::rep_crawler::cleanup_reps ()
 
 void nano::rep_crawler::update_weights ()
 {
-	nano::lock_guard<nano::mutex> lock (probable_reps_mutex);
+	nano::unique_lock<nano::mutex> lock (probable_reps_mutex);
 	for (auto i (probable_reps.get<tag_last_request> ().begin ()), n (probable_reps.get<tag_last_request> ().end ()); i != n;)
 	{
 		auto weight (node.ledger.weight (i->account));
@@ -303,6 +304,22 @@ void nano::rep_crawler::update_weights ()
 			i = probable_reps.get<tag_last_request> ().erase (i);
 		}
 	}
+	lock.unlock ();
+	// Also picks up reps removed by cleanup_reps, which always runs right before
+	update_principals ();
+}
+
+void nano::rep_crawler::update_principals ()
+{
+	auto snapshot (std::make_shared<nano::representatives_snapshot> ());
+	snapshot->representatives = principal_representatives ();
+	snapshot->version = ++principals_version;
+	std::atomic_store (&principals, std::shared_ptr<nano::representatives_snapshot const> (std::move (snapshot)));
+}
+
+std::shared_ptr<nano::representatives_snapshot const> nano::rep_crawler::principal_representatives_snapshot () const
+{
+	return std::atomic_load (&principals);
 }
 
 std::vector<nano::representative> nano::rep_crawler::representatives (size_t count_a, nano::uint128_t const weight_a, boost::optional<decltype (nano::protocol_constants::protocol_version)> const & opt_version_min_a)
@@ -11,6 +11,7 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/optional.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <unordered_set>
@@ -48,6 +49,16 @@ public:
 	std::chrono::steady_clock::time_point last_response{ std::chrono::steady_clock::time_point () };
 };
 
+/**
+ * Principal representatives in descending order of weight at the time of \p version. Never modified once published
+ */
+class representatives_snapshot final
+{
+public:
+	uint64_t version{ 0 };
+	std::vector<nano::representative> representatives;
+};
+
 /**
  * Crawls the network for representatives. Queries are performed by requesting confirmation of a
  * random block and observing the corresponding vote.
@@ -108,6 +119,9 @@ public:
 	/** Request a list of the top \p count_a known principal representatives in descending order of weight, optionally with a minimum version \p opt_version_min_a */
 	std::vector<representative> principal_representatives (size_t count_a = std::numeric_limits<size_t>::max (), boost::optional<decltype (nano::protocol_constants::protocol_version)> const & opt_version_min_a = boost::none);
 
+	/** Latest published principal representatives, obtaining it neither locks nor copies the list */
+	std::shared_ptr<nano::representatives_snapshot const> principal_representatives_snapshot () const;
+
 	/** Request a list of the top \p count_a known representative endpoints. */
 	std::vector<std::shared_ptr<nano::transport::channel>> representative_endpoints (size_t count_a);
 
@@ -141,15 +155,24 @@ private:
 	/** Update representatives weights from ledger */
 	void update_weights ();
 
+	/** Publish a new principal representatives snapshot from the probable representatives */
+	void update_principals ();
+
 	/** Protects the probable_reps container */
 	mutable nano::mutex probable_reps_mutex;
 
 	/** Probable representatives */
 	probably_rep_t probable_reps;
 
+	/** Only accessed through std::atomic_load and std::atomic_store */
+	std::shared_ptr<nano::representatives_snapshot const> principals{ std::make_shared<nano::representatives_snapshot> () };
+	std::atomic<uint64_t> principals_version{ 0 };
+
 	friend class active_transactions_confirm_active_Test;
 	friend class active_transactions_confirm_frontier_Test;
+	friend class active_transactions_transition_timers_saturated_Test;
 	friend class rep_crawler_local_Test;
+	friend class rep_crawler_principal_snapshot_Test;
 	friend class node_online_reps_rep_crawler_Test;
 
 	std::deque<std::pair<std::shared_ptr<nano::transport::channel>, std::shared_ptr<nano::vote>>> responses;
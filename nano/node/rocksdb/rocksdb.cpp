@@ -94,6 +94,7 @@ std::unordered_map<const char *, nano::tables> nano::rocksdb_store::create_cf_na
 		{ "blocks", tables::blocks },
 		{ "pending", tables::pending },
 		{ "unchecked", tables::unchecked },
+		{ "unchecked_expiry", tables::unchecked_expiry },
 		{ "vote", tables::vote },
 		{ "online_weight", tables::online_weight },
 		{ "meta", tables::meta },
@@ -147,11 +148,22 @@ void nano::rocksdb_store::open (bool & error_a, boost::filesystem::path const &
 			logger.always_log (boost::str (boost::format ("The version of the ledger (%1%) is too high for this node") % version_l));
 		}
 	}
+
+	if (!error_a && !open_read_only_a)
+	{
+		// Unchecked entries stored before the expiry index existed are indexed once
+		auto transaction = tx_begin_write ({ tables::unchecked, tables::unchecked_expiry });
+		if (unchecked_expiry_begin (transaction) == unchecked_expiry_end () && unchecked_begin (transaction) != unchecked_end ())
+		{
+			unchecked_expiry_rebuild (transaction);
+		}
+	}
 }
 
 void nano::rocksdb_store::generate_tombstone_map ()
 {
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::unchecked), std::forward_as_tuple (0, 50000));
+	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::unchecked_expiry), std::forward_as_tuple (0, 50000));
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::blocks), std::forward_as_tuple (0, 25000));
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::accounts), std::forward_as_tuple (0, 25000));
 	tombstone_map.emplace (std::piecewise_construct, std::forward_as_tuple (nano::tables::pending), std::forward_as_tuple (0, 25000));
@@ -210,6 +222,12 @@ rocksdb::ColumnFamilyOptions nano::rocksdb_store::get_cf_options (std::string co
 		// L1 size, compaction is triggered for L0 at this size (2 SST files in L1)
 		cf_options.max_bytes_for_level_base = memtable_size_bytes * 2;
 	}
+	else if (cf_name_a == "unchecked_expiry")
+	{
+		// Appended in time order and deleted from the front when entries expire
+		std::shared_ptr<rocksdb::TableFactory> table_factory (rocksdb::NewBlockBasedTableFactory (get_active_table_options (block_cache_size_bytes)));
+		cf_options = get_active_cf_options (table_factory, memtable_size_bytes);
+	}
 	else if (cf_name_a == "blocks")
 	{
 		std::shared_ptr<rocksdb::TableFactory> table_factory (rocksdb::NewBlockBasedTableFactory (get_active_table_options (block_cache_size_bytes * 4)));
@@ -349,6 +367,8 @@ rocksdb::ColumnFamilyHandle * nano::rocksdb_store::table_to_column_family (table
 			return get_handle ("pending");
 		case tables::unchecked:
 			return get_handle ("unchecked");
+		case tables::unchecked_expiry:
+			return get_handle ("unchecked_expiry");
 		case tables::vote:
 			return get_handle ("vote");
 		case tables::online_weight:
@@ -496,7 +516,7 @@ uint64_t nano::rocksdb_store::count (nano::transaction const & transaction_a, ta
 		}
 	}
 	// This is only an estimation
-	else if (table_a == tables::unchecked)
+	else if (table_a == tables::unchecked || table_a == tables::unchecked_expiry)
 	{
 		db->GetIntProperty (table_to_column_family (table_a), "rocksdb.estimate-num-keys", &sum);
 	}
@@ -755,7 +775,7 @@ void nano::rocksdb_store::on_flush (rocksdb::FlushJobInfo const & flush_job_info
 
 std::vector<nano::tables> nano::rocksdb_store::all_tables () const
 {
-	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::frontiers, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::unchecked, tables::vote };
+	return std::vector<nano::tables>{ tables::accounts, tables::blocks, tables::confirmation_height, tables::final_votes, tables::frontiers, tables::meta, tables::online_weight, tables::peers, tables::pending, tables::pruned, tables::unchecked, tables::unchecked_expiry, tables::vote };
 }
 
 bool nano::rocksdb_store::copy_db (boost::filesystem::path const & destination_path)
@@ -833,6 +853,116 @@ void nano::rocksdb_store::rebuild_db (nano::write_transaction const & transactio
 	// Not available for RocksDB
 }
 
+std::unique_ptr<nano::bulk_loader> nano::rocksdb_store::make_bulk_loader (nano::tables table_a)
+{
+	return std::make_unique<nano::rocksdb_bulk_loader> (*this, table_a);
+}
+
+constexpr uint64_t nano::rocksdb_bulk_loader::file_size;
+
+nano::rocksdb_bulk_loader::rocksdb_bulk_loader (nano::rocksdb_store & store_a, nano::tables table_a) :
+store (store_a),
+handle (store_a.table_to_column_family (table_a)),
+options (store_a.get_db_options (), store_a.get_cf_options (handle->GetName ())),
+writer (rocksdb::EnvOptions (), options, handle)
+{
+}
+
+nano::rocksdb_bulk_loader::~rocksdb_bulk_loader ()
+{
+	// Files are moved in to the database when ingested, only those of failed or abandoned loaders are left
+	if (open)
+	{
+		writer.Finish ();
+	}
+	for (auto const & file : files)
+	{
+		boost::system::error_code ec;
+		boost::filesystem::remove (file, ec);
+	}
+}
+
+void nano::rocksdb_bulk_loader::write (nano::rocksdb_val const & key_a, nano::rocksdb_val const & value_a)
+{
+	if (!error)
+	{
+		if (!open)
+		{
+			auto directory (boost::filesystem::path (store.db->GetName ()) / "ingest");
+			boost::system::error_code ec;
+			boost::filesystem::create_directories (directory, ec);
+			auto file ((directory / boost::filesystem::unique_path (handle->GetName () + "-%%%%-%%%%-%%%%-%%%%.sst")).string ());
+			error = !writer.Open (file).ok ();
+			open = !error;
+			files.push_back (file);
+		}
+		// Keys must be ascending, which the writer verifies
+		error = error || !writer.Put (key_a, value_a).ok ();
+		++count;
+		if (!error && writer.FileSize () >= file_size)
+		{
+			error = finish ();
+		}
+	}
+}
+
+bool nano::rocksdb_bulk_loader::finish ()
+{
+	auto result (false);
+	if (open)
+	{
+		open = false;
+		result = !writer.Finish ().ok ();
+	}
+	return result;
+}
+
+void nano::rocksdb_bulk_loader::put (nano::account const & account_a, nano::account_info const & info_a)
+{
+	write (account_a, info_a);
+}
+
+void nano::rocksdb_bulk_loader::put (nano::block_hash const & hash_a, std::vector<uint8_t> const & block_a)
+{
+	write (hash_a, nano::rocksdb_val (block_a.size (), const_cast<uint8_t *> (block_a.data ())));
+}
+
+void nano::rocksdb_bulk_loader::put (nano::block_hash const & hash_a, nano::account const & account_a)
+{
+	write (hash_a, account_a);
+}
+
+void nano::rocksdb_bulk_loader::put (nano::pending_key const & key_a, nano::pending_info const & info_a)
+{
+	write (key_a, info_a);
+}
+
+void nano::rocksdb_bulk_loader::put (nano::account const & account_a, nano::confirmation_height_info const & info_a)
+{
+	write (account_a, info_a);
+}
+
+void nano::rocksdb_bulk_loader::put (nano::block_hash const & hash_a)
+{
+	write (hash_a, nano::rocksdb_val{ nullptr });
+}
+
+bool nano::rocksdb_bulk_loader::commit ()
+{
+	error = error || finish ();
+	if (!error && !files.empty ())
+	{
+		rocksdb::IngestExternalFileOptions options;
+		options.move_files = true;
+		error = !store.db->IngestExternalFile (handle, files, options).ok ();
+		if (!error)
+		{
+			files.clear ();
+		}
+	}
+	return error;
+}
+
 bool nano::rocksdb_store::init_error () const
 {
 	return error;
@@ -901,6 +1031,12 @@ unsigned nano::rocksdb_store::max_block_write_batch_num () const
 	return max_block_write_batch_num_m;
 }
 
+bool nano::rocksdb_store::snapshot_id (nano::transaction const &, uint64_t &) const
+{
+	// Transactions are not numbered in a way readers and writers can compare
+	return true;
+}
+
 std::string nano::rocksdb_store::error_string (int status) const
 {
 	return std::to_string (status);
@@ -11,6 +11,7 @@
 #include <rocksdb/filter_policy.h>
 #include <rocksdb/options.h>
 #include <rocksdb/slice.h>
+#include <rocksdb/sst_file_writer.h>
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/optimistic_transaction_db.h>
 #include <rocksdb/utilities/transaction.h>
@@ -44,9 +45,11 @@ public:
 	void serialize_memory_stats (boost::property_tree::ptree &) override;
 
 	bool copy_db (boost::filesystem::path const & destination) override;
+	std::unique_ptr<nano::bulk_loader> make_bulk_loader (nano::tables table_a) override;
 	void rebuild_db (nano::write_transaction const & transaction_a) override;
 
 	unsigned max_block_write_batch_num () const override;
+	bool snapshot_id (nano::transaction const &, uint64_t &) const override;
 
 	template <typename Key, typename Value>
 	nano::store_iterator<Key, Value> make_iterator (nano::transaction const & transaction_a, tables table_a) const
@@ -123,6 +126,41 @@ private:
 	constexpr static int base_block_cache_size = 8;
 
 	friend class rocksdb_block_store_tombstone_count_Test;
+	friend class rocksdb_bulk_loader;
+};
+
+/**
+ * Writes the records of one table to a sorted table file which is ingested in to the database on commit, bypassing the memtables
+ * and write ahead log. Records put after the file reaches file_size go to a new file.
+ */
+class rocksdb_bulk_loader final : public nano::bulk_loader
+{
+public:
+	rocksdb_bulk_loader (nano::rocksdb_store &, nano::tables);
+	~rocksdb_bulk_loader ();
+	void put (nano::account const &, nano::account_info const &) override;
+	void put (nano::block_hash const &, std::vector<uint8_t> const &) override;
+	void put (nano::block_hash const &, nano::account const &) override;
+	void put (nano::pending_key const &, nano::pending_info const &) override;
+	void put (nano::account const &, nano::confirmation_height_info const &) override;
+	void put (nano::block_hash const &) override;
+	bool commit () override;
+
+	static uint64_t constexpr file_size = 256 * 1024 * 1024;
+
+private:
+	void write (nano::rocksdb_val const &, nano::rocksdb_val const &);
+	/** Finishes the open file, returns true on error */
+	bool finish ();
+	nano::rocksdb_store & store;
+	rocksdb::ColumnFamilyHandle * const handle;
+	/** Owns the table factory, which the writer only holds a raw pointer to, so must outlive it */
+	rocksdb::Options const options;
+	rocksdb::SstFileWriter writer;
+	/** Files written, ingested together on commit */
+	std::vector<std::string> files;
+	bool open{ false };
+	bool error{ false };
 };
 
 extern template class block_store_partial<rocksdb::Slice, rocksdb_store>;
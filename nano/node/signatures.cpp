@@ -3,6 +3,8 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/node/signatures.hpp>
 
+#include <algorithm>
+
 nano::signature_checker::signature_checker (unsigned num_threads) :
 thread_pool (num_threads, nano::thread_role::name::signature_checking)
 {
@@ -122,3 +124,123 @@ bool nano::signature_checker::single_threaded () const
 {
 	return thread_pool.get_num_threads () == 0;
 }
+
+nano::signature_cache::signature_cache (size_t capacity_a) :
+slots_per_shard ((capacity_a + shard_count - 1) / shard_count)
+{
+	for (auto & shard : shards)
+	{
+		shard.entries.resize (slots_per_shard);
+	}
+}
+
+std::pair<size_t, size_t> nano::signature_cache::slot (nano::block_hash const & hash_a, nano::public_key const & key_a, nano::signature const & signature_a) const
+{
+	debug_assert (slots_per_shard > 0);
+	// Hashes, keys and signatures are uniformly distributed so their bits can be used directly
+	auto const index (hash_a.qwords[0] ^ key_a.qwords[0] ^ signature_a.qwords[0]);
+	return { index % shard_count, (index / shard_count) % slots_per_shard };
+}
+
+bool nano::signature_cache::exists (nano::block_hash const & hash_a, nano::public_key const & key_a, nano::signature const & signature_a)
+{
+	auto result (false);
+	if (slots_per_shard > 0)
+	{
+		auto const [shard_index, entry_index] = slot (hash_a, key_a, signature_a);
+		auto & shard (shards[shard_index]);
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		auto const & entry (shard.entries[entry_index]);
+		result = entry.hash == hash_a && entry.key == key_a && entry.signature == signature_a;
+	}
+	return result;
+}
+
+void nano::signature_cache::insert (nano::block_hash const & hash_a, nano::public_key const & key_a, nano::signature const & signature_a)
+{
+	if (slots_per_shard > 0)
+	{
+		auto const [shard_index, entry_index] = slot (hash_a, key_a, signature_a);
+		auto & shard (shards[shard_index]);
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		shard.entries[entry_index] = entry{ hash_a, key_a, signature_a };
+	}
+}
+
+size_t nano::signature_cache::verify (nano::signature_checker & checker_a, nano::signature_check_set & check_a)
+{
+	std::vector<nano::block_hash> hashes (check_a.size);
+	std::vector<nano::public_key> keys (check_a.size);
+	std::vector<nano::signature> signatures (check_a.size);
+	std::vector<size_t> unverified;
+	unverified.reserve (check_a.size);
+	for (size_t i (0); i < check_a.size; ++i)
+	{
+		debug_assert (check_a.message_lengths[i] == sizeof (nano::block_hash));
+		std::copy (check_a.messages[i], check_a.messages[i] + sizeof (nano::block_hash), hashes[i].bytes.begin ());
+		std::copy (check_a.pub_keys[i], check_a.pub_keys[i] + sizeof (nano::public_key), keys[i].bytes.begin ());
+		std::copy (check_a.signatures[i], check_a.signatures[i] + sizeof (nano::signature), signatures[i].bytes.begin ());
+		if (exists (hashes[i], keys[i], signatures[i]))
+		{
+			check_a.verifications[i] = 1;
+		}
+		else
+		{
+			unverified.push_back (i);
+		}
+	}
+	if (!unverified.empty ())
+	{
+		// Only the misses are handed to the checker, as a check set of their own
+		auto const unverified_size (unverified.size ());
+		std::vector<unsigned char const *> messages;
+		messages.reserve (unverified_size);
+		std::vector<size_t> lengths (unverified_size, sizeof (nano::block_hash));
+		std::vector<unsigned char const *> pub_keys;
+		pub_keys.reserve (unverified_size);
+		std::vector<unsigned char const *> unverified_signatures;
+		unverified_signatures.reserve (unverified_size);
+		std::vector<int> verifications (unverified_size, 0);
+		for (auto index : unverified)
+		{
+			messages.push_back (check_a.messages[index]);
+			pub_keys.push_back (check_a.pub_keys[index]);
+			unverified_signatures.push_back (check_a.signatures[index]);
+		}
+		nano::signature_check_set check = { unverified_size, messages.data (), lengths.data (), pub_keys.data (), unverified_signatures.data (), verifications.data () };
+		checker_a.verify (check);
+		for (size_t i (0); i < unverified_size; ++i)
+		{
+			auto const index (unverified[i]);
+			check_a.verifications[index] = verifications[i];
+			if (verifications[i] == 1)
+			{
+				insert (hashes[index], keys[index], signatures[index]);
+			}
+		}
+	}
+	return check_a.size - unverified.size ();
+}
+
+size_t nano::signature_cache::capacity () const
+{
+	return slots_per_shard * shard_count;
+}
+
+size_t nano::signature_cache::size ()
+{
+	size_t result (0);
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		result += std::count_if (shard.entries.begin (), shard.entries.end (), [](entry const & entry_a) { return !entry_a.hash.is_zero (); });
+	}
+	return result;
+}
+
+std::unique_ptr<nano::container_info_component> nano::collect_container_info (signature_cache & signature_cache, std::string const & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", signature_cache.size (), sizeof (nano::block_hash) + sizeof (nano::public_key) + sizeof (nano::signature) }));
+	return composite;
+}
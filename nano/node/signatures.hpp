@@ -1,11 +1,15 @@
 #pragma once
 
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/lib/utility.hpp>
 
+#include <array>
 #include <atomic>
 #include <future>
 #include <mutex>
+#include <vector>
 
 namespace nano
 {
@@ -60,4 +64,50 @@ private:
 	void verify_async (nano::signature_check_set & check_a, size_t num_batches, std::promise<void> & promise);
 	bool single_threaded () const;
 };
+
+/**
+ * Bounded cache of recently verified signatures, consulted by the vote and block verification paths before handing
+ * signatures to the signature checker so that duplicates arriving from several peers are only verified once.
+ * Entries are direct mapped into shards, a new entry replaces whichever entry used its slot. A capacity of 0 disables the cache.
+ */
+class signature_cache final
+{
+public:
+	explicit signature_cache (size_t capacity_a);
+	/** Returns true if \p signature_a of \p hash_a by \p key_a was verified as valid recently */
+	bool exists (nano::block_hash const & hash_a, nano::public_key const & key_a, nano::signature const & signature_a);
+	/** Remembers a signature verified as valid */
+	void insert (nano::block_hash const & hash_a, nano::public_key const & key_a, nano::signature const & signature_a);
+	/**
+	 * Fills the verifications of \p check_a, whose messages are block hashes. Signatures found in the cache are valid, the others
+	 * are verified by \p checker_a and inserted if valid. Returns the number of signatures found in the cache
+	 */
+	size_t verify (nano::signature_checker & checker_a, nano::signature_check_set & check_a);
+	size_t capacity () const;
+	/** Number of occupied entries */
+	size_t size ();
+
+	static size_t constexpr shard_count = 16;
+
+private:
+	class entry final
+	{
+	public:
+		// Empty slots have a zero hash, which no vote or block hashes to
+		nano::block_hash hash{ 0 };
+		nano::public_key key{ 0 };
+		nano::signature signature{ 0 };
+	};
+	class shard final
+	{
+	public:
+		nano::mutex mutex;
+		std::vector<entry> entries;
+	};
+	std::pair<size_t, size_t> slot (nano::block_hash const &, nano::public_key const &, nano::signature const &) const;
+	std::array<shard, shard_count> shards;
+	size_t const slots_per_shard;
+};
+
+std::unique_ptr<container_info_component> collect_container_info (signature_cache &, std::string const &);
 }
@@ -0,0 +1,130 @@
+#include <nano/node/startup_profile.hpp>
+
+#include <boost/format.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+
+nano::startup_profile::startup_profile () :
+start (std::chrono::steady_clock::now ()),
+start_cpu (std::clock ())
+{
+}
+
+nano::startup_profile::phase::phase (nano::startup_profile & profile_a, std::string const & name_a) :
+profile (profile_a),
+name (name_a),
+start (std::chrono::steady_clock::now ()),
+start_cpu (std::clock ())
+{
+}
+
+nano::startup_profile::phase::~phase ()
+{
+	profile.add (name, std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start), cpu_since (start_cpu));
+}
+
+std::chrono::microseconds nano::startup_profile::cpu_since (std::clock_t start_a)
+{
+	auto now (std::clock ());
+	// std::clock returns -1 where processor time is unavailable
+	auto result (std::chrono::microseconds (0));
+	if (now != static_cast<std::clock_t> (-1) && start_a != static_cast<std::clock_t> (-1))
+	{
+		result = std::chrono::microseconds (static_cast<int64_t> ((now - start_a) * (1000000.0 / CLOCKS_PER_SEC)));
+	}
+	return result;
+}
+
+void nano::startup_profile::add (std::string const & name_a, std::chrono::microseconds wall_a, std::chrono::microseconds cpu_a)
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	if (!completed_m)
+	{
+		entries_m.push_back (entry{ name_a, wall_a, cpu_a, {} });
+	}
+}
+
+void nano::startup_profile::add_steps (std::string const & name_a, std::vector<std::pair<std::string, std::chrono::milliseconds>> const & steps_a)
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	auto existing (std::find_if (entries_m.rbegin (), entries_m.rend (), [&name_a](entry const & entry_a) { return entry_a.name == name_a; }));
+	if (existing != entries_m.rend ())
+	{
+		existing->steps.insert (existing->steps.end (), steps_a.begin (), steps_a.end ());
+	}
+}
+
+void nano::startup_profile::complete ()
+{
+	auto wall_l (std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start));
+	auto cpu_l (cpu_since (start_cpu));
+	nano::lock_guard<nano::mutex> guard (mutex);
+	if (!completed_m)
+	{
+		completed_m = true;
+		total_wall = wall_l;
+		total_cpu = cpu_l;
+	}
+}
+
+bool nano::startup_profile::completed ()
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	return completed_m;
+}
+
+std::vector<nano::startup_profile::entry> nano::startup_profile::entries ()
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	return entries_m;
+}
+
+void nano::startup_profile::serialize (boost::property_tree::ptree & tree_a)
+{
+	nano::lock_guard<nano::mutex> guard (mutex);
+	tree_a.put ("completed", completed_m);
+	tree_a.put ("wall_us", std::to_string (total_wall.count ()));
+	tree_a.put ("cpu_us", std::to_string (total_cpu.count ()));
+	boost::property_tree::ptree phases_l;
+	for (auto const & entry : entries_m)
+	{
+		boost::property_tree::ptree phase_l;
+		phase_l.put ("name", entry.name);
+		phase_l.put ("wall_us", std::to_string (entry.wall.count ()));
+		phase_l.put ("cpu_us", std::to_string (entry.cpu.count ()));
+		if (!entry.steps.empty ())
+		{
+			boost::property_tree::ptree steps_l;
+			for (auto const & step : entry.steps)
+			{
+				boost::property_tree::ptree step_l;
+				step_l.put ("name", step.first);
+				step_l.put ("wall_ms", std::to_string (step.second.count ()));
+				steps_l.push_back (std::make_pair ("", step_l));
+			}
+			phase_l.add_child ("steps", steps_l);
+		}
+		phases_l.push_back (std::make_pair ("", phase_l));
+	}
+	tree_a.add_child ("phases", phases_l);
+}
+
+std::vector<std::string> nano::startup_profile::to_strings ()
+{
+	std::vector<std::string> result;
+	nano::lock_guard<nano::mutex> guard (mutex);
+	for (auto const & entry : entries_m)
+	{
+		result.push_back (boost::str (boost::format ("Startup phase %1%: %2% ms wall, %3% ms cpu") % entry.name % (entry.wall.count () / 1000) % (entry.cpu.count () / 1000)));
+		for (auto const & step : entry.steps)
+		{
+			result.push_back (boost::str (boost::format ("Startup phase %1%, %2%: %3% ms wall") % entry.name % step.first % step.second.count ()));
+		}
+	}
+	if (completed_m)
+	{
+		result.push_back (boost::str (boost::format ("Startup total: %1% ms wall, %2% ms cpu") % (total_wall.count () / 1000) % (total_cpu.count () / 1000)));
+	}
+	return result;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Records the wall and CPU time of the named phases a node goes through while it is constructed and started.
+ * CPU time is taken from std::clock so it covers every thread of the process, a phase running concurrently with
+ * background work (e.g. the block processor or database upgrades) is charged for that work too.
+ */
+class startup_profile final
+{
+public:
+	startup_profile ();
+	/** Measures the time until it goes out of scope and adds it to the profile as \p name_a */
+	class phase final
+	{
+	public:
+		phase (nano::startup_profile &, std::string const & name_a);
+		~phase ();
+		phase (phase const &) = delete;
+		phase & operator= (phase const &) = delete;
+
+	private:
+		nano::startup_profile & profile;
+		std::string name;
+		std::chrono::steady_clock::time_point const start;
+		std::clock_t const start_cpu;
+	};
+	class entry final
+	{
+	public:
+		std::string name;
+		std::chrono::microseconds wall;
+		std::chrono::microseconds cpu;
+		/** Breakdown of the phase reported by the component itself, wall time only */
+		std::vector<std::pair<std::string, std::chrono::milliseconds>> steps;
+	};
+	/** Returns the result of \p action_a, measured as phase \p name_a. Results are not copied so members can be constructed through it */
+	template <typename Action>
+	auto measure (std::string const & name_a, Action const & action_a) -> decltype (action_a ())
+	{
+		phase phase_l (*this, name_a);
+		return action_a ();
+	}
+	/** Attaches \p steps_a to the latest phase named \p name_a */
+	void add_steps (std::string const & name_a, std::vector<std::pair<std::string, std::chrono::milliseconds>> const & steps_a);
+	/** Ends the profile, the total covers the time since construction. Phases measured afterwards are not recorded */
+	void complete ();
+	bool completed ();
+	std::vector<entry> entries ();
+	void serialize (boost::property_tree::ptree &);
+	/** Returns one line per phase for the log */
+	std::vector<std::string> to_strings ();
+
+private:
+	void add (std::string const &, std::chrono::microseconds, std::chrono::microseconds);
+	static std::chrono::microseconds cpu_since (std::clock_t);
+	std::chrono::steady_clock::time_point const start;
+	std::clock_t const start_cpu;
+	nano::mutex mutex;
+	std::vector<entry> entries_m;
+	std::chrono::microseconds total_wall{ 0 };
+	std::chrono::microseconds total_cpu{ 0 };
+	bool completed_m{ false };
+};
+}
@@ -1,5 +1,6 @@
 #include <nano/lib/logger_mt.hpp>
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/stats.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/node/nodeconfig.hpp>
@@ -9,11 +10,13 @@
 
 #include <boost/format.hpp>
 
-nano::state_block_signature_verification::state_block_signature_verification (nano::signature_checker & signature_checker, nano::epochs & epochs, nano::node_config & node_config, nano::logger_mt & logger, uint64_t state_block_signature_verification_size) :
+nano::state_block_signature_verification::state_block_signature_verification (nano::signature_checker & signature_checker, nano::signature_cache & signature_cache, nano::epochs & epochs, nano::node_config & node_config, nano::logger_mt & logger, nano::stat & stats, uint64_t state_block_signature_verification_size) :
 signature_checker (signature_checker),
+signature_cache (signature_cache),
 epochs (epochs),
 node_config (node_config),
 logger (logger),
+stats (stats),
 thread ([this, state_block_signature_verification_size]() {
 	nano::thread_role::set (nano::thread_role::name::state_block_signature_verification);
 	this->run (state_block_signature_verification_size);
@@ -151,7 +154,10 @@ void nano::state_block_signature_verification::verify_state_blocks (std::deque<s
 			signatures.push_back (blocks_signatures.back ().bytes.data ());
 		}
 		nano::signature_check_set check = { size, messages.data (), lengths.data (), pub_keys.data (), signatures.data (), verifications.data () };
-		signature_checker.verify (check);
+		// Blocks verified recently, for example when requeued from unchecked or received from another peer, are not verified again
+		auto hits (signature_cache.verify (signature_checker, check));
+		stats.add (nano::stat::type::signature_cache, nano::stat::detail::state_block_hit, nano::stat::dir::in, hits);
+		stats.add (nano::stat::type::signature_cache, nano::stat::detail::state_block_miss, nano::stat::dir::in, size - hits);
 		if (node_config.logging.timing_logging () && timer_l.stop () > std::chrono::milliseconds (10))
 		{
 			logger.try_log (boost::str (boost::format ("Batch verified %1% state blocks in %2% %3%") % size % timer_l.value ().count () % timer_l.unit ()));
@@ -13,11 +13,13 @@ class epochs;
 class logger_mt;
 class node_config;
 class signature_checker;
+class signature_cache;
+class stat;
 
 class state_block_signature_verification
 {
 public:
-	state_block_signature_verification (nano::signature_checker &, nano::epochs &, nano::node_config &, nano::logger_mt &, uint64_t);
+	state_block_signature_verification (nano::signature_checker &, nano::signature_cache &, nano::epochs &, nano::node_config &, nano::logger_mt &, nano::stat &, uint64_t);
 	~state_block_signature_verification ();
 	void add (nano::unchecked_info const & info_a, bool watch_work_a);
 	size_t size ();
@@ -29,9 +31,11 @@ public:
 
 private:
 	nano::signature_checker & signature_checker;
+	nano::signature_cache & signature_cache;
 	nano::epochs & epochs;
 	nano::node_config & node_config;
 	nano::logger_mt & logger;
+	nano::stat & stats;
 
 	nano::mutex mutex{ mutex_identifier (mutexes::state_block_signature_verification) };
 	bool stopped{ false };
@@ -0,0 +1,163 @@
+#include <nano/node/unchecked_map.hpp>
+#include <nano/secure/blockstore.hpp>
+
+#include <boost/tuple/tuple.hpp>
+
+nano::unchecked_map::unchecked_map (nano::block_store & store_a, size_t memory_limit_a) :
+store (store_a),
+memory_limit (memory_limit_a)
+{
+}
+
+void nano::unchecked_map::put (nano::write_transaction const & transaction_a, nano::unchecked_key const & key_a, nano::unchecked_info const & info_a)
+{
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		auto & by_key (entries.get<tag_key> ());
+		auto existing (by_key.find (boost::make_tuple (key_a.previous, key_a.hash)));
+		if (existing != by_key.end ())
+		{
+			by_key.replace (existing, entry{ key_a.previous, key_a.hash, info_a });
+		}
+		else
+		{
+			entries.insert (entry{ key_a.previous, key_a.hash, info_a });
+			if (entries.size () > memory_limit)
+			{
+				auto & by_modified (entries.get<tag_modified> ());
+				by_modified.erase (by_modified.begin ());
+			}
+		}
+	}
+	else
+	{
+		store.unchecked_put (transaction_a, key_a, info_a);
+	}
+}
+
+std::vector<nano::unchecked_info> nano::unchecked_map::get (nano::transaction const & transaction_a, nano::block_hash const & hash_a)
+{
+	std::vector<nano::unchecked_info> result;
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		auto & by_key (entries.get<tag_key> ());
+		for (auto i (by_key.lower_bound (boost::make_tuple (hash_a))), n (by_key.end ()); i != n && i->previous == hash_a; ++i)
+		{
+			result.push_back (i->info);
+		}
+	}
+	else
+	{
+		result = store.unchecked_get (transaction_a, hash_a);
+	}
+	return result;
+}
+
+bool nano::unchecked_map::exists (nano::transaction const & transaction_a, nano::unchecked_key const & key_a)
+{
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		return entries.get<tag_key> ().count (boost::make_tuple (key_a.previous, key_a.hash)) > 0;
+	}
+	return store.unchecked_exists (transaction_a, key_a);
+}
+
+void nano::unchecked_map::del (nano::write_transaction const & transaction_a, nano::unchecked_key const & key_a)
+{
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		auto & by_key (entries.get<tag_key> ());
+		auto existing (by_key.find (boost::make_tuple (key_a.previous, key_a.hash)));
+		// The entry may have expired or been evicted since it was read
+		if (existing != by_key.end ())
+		{
+			by_key.erase (existing);
+		}
+	}
+	else
+	{
+		store.unchecked_del (transaction_a, key_a);
+	}
+}
+
+void nano::unchecked_map::clear (nano::write_transaction const & transaction_a)
+{
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		entries.clear ();
+	}
+	else
+	{
+		store.unchecked_clear (transaction_a);
+	}
+}
+
+size_t nano::unchecked_map::count (nano::transaction const & transaction_a)
+{
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		return entries.size ();
+	}
+	return store.unchecked_count (transaction_a);
+}
+
+void nano::unchecked_map::for_each (nano::transaction const & transaction_a, nano::unchecked_key const & key_a, std::function<bool(nano::unchecked_key const &, nano::unchecked_info const &)> const & action_a)
+{
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		auto & by_key (entries.get<tag_key> ());
+		for (auto i (by_key.lower_bound (boost::make_tuple (key_a.previous, key_a.hash))), n (by_key.end ()); i != n && action_a (nano::unchecked_key (i->previous, i->hash), i->info); ++i)
+		{
+		}
+	}
+	else
+	{
+		for (auto i (store.unchecked_begin (transaction_a, key_a)), n (store.unchecked_end ()); i != n && action_a (i->first, i->second); ++i)
+		{
+		}
+	}
+}
+
+size_t nano::unchecked_map::expire (nano::write_transaction const & transaction_a, uint64_t cutoff_a, size_t max_a, std::vector<nano::unchecked_info> & expired_a)
+{
+	size_t result (0);
+	if (memory ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		auto & by_modified (entries.get<tag_modified> ());
+		for (auto i (by_modified.begin ()), n (by_modified.end ()); i != n && i->info.modified < cutoff_a && result < max_a; ++result)
+		{
+			expired_a.push_back (i->info);
+			i = by_modified.erase (i);
+		}
+	}
+	else
+	{
+		result = store.unchecked_expire (transaction_a, cutoff_a, max_a, expired_a);
+	}
+	return result;
+}
+
+bool nano::unchecked_map::memory () const
+{
+	return memory_limit != 0;
+}
+
+std::unique_ptr<nano::container_info_component> nano::collect_container_info (unchecked_map & unchecked_map, std::string const & name)
+{
+	size_t count;
+	{
+		nano::lock_guard<nano::mutex> lock (unchecked_map.mutex);
+		count = unchecked_map.entries.size ();
+	}
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", count, sizeof (decltype (unchecked_map.entries)::value_type) }));
+	return composite;
+}
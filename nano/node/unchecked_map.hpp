@@ -0,0 +1,85 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/secure/common.hpp>
+
+#include <boost/multi_index/composite_key.hpp>
+#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace nano
+{
+class block_store;
+class transaction;
+class write_transaction;
+
+/**
+ * Blocks waiting for a missing dependency, keyed by the dependency hash.
+ * Entries are stored in the ledger unless a memory limit is set, in which case they are only kept in memory, the oldest
+ * entries being dropped once the limit is reached. Transactions are ignored by the in-memory map.
+ */
+class unchecked_map final
+{
+public:
+	unchecked_map (nano::block_store &, size_t memory_limit_a);
+	void put (nano::write_transaction const &, nano::unchecked_key const &, nano::unchecked_info const &);
+	std::vector<nano::unchecked_info> get (nano::transaction const &, nano::block_hash const &);
+	bool exists (nano::transaction const &, nano::unchecked_key const &);
+	void del (nano::write_transaction const &, nano::unchecked_key const &);
+	void clear (nano::write_transaction const &);
+	size_t count (nano::transaction const &);
+	/** Calls \p action_a for entries in key order starting from \p key_a until it returns false */
+	void for_each (nano::transaction const &, nano::unchecked_key const &, std::function<bool(nano::unchecked_key const &, nano::unchecked_info const &)> const &);
+	/**
+	 * Deletes entries last modified before \p cutoff_a seconds since epoch into \p expired_a, oldest first
+	 * @return Number of expiry index entries walked, at most \p max_a. Fewer than \p max_a means nothing older is left
+	 */
+	size_t expire (nano::write_transaction const &, uint64_t cutoff_a, size_t max_a, std::vector<nano::unchecked_info> & expired_a);
+	bool memory () const;
+
+private:
+	class entry final
+	{
+	public:
+		nano::block_hash previous;
+		nano::block_hash hash;
+		nano::unchecked_info info;
+		uint64_t modified () const
+		{
+			return info.modified;
+		}
+	};
+	class tag_key
+	{
+	};
+	class tag_modified
+	{
+	};
+	// clang-format off
+	boost::multi_index_container<entry,
+	boost::multi_index::indexed_by<
+		boost::multi_index::ordered_unique<boost::multi_index::tag<tag_key>,
+			boost::multi_index::composite_key<entry,
+				boost::multi_index::member<entry, nano::block_hash, &entry::previous>,
+				boost::multi_index::member<entry, nano::block_hash, &entry::hash>>>,
+		boost::multi_index::ordered_non_unique<boost::multi_index::tag<tag_modified>,
+			boost::multi_index::const_mem_fun<entry, uint64_t, &entry::modified>>>>
+	entries;
+	// clang-format on
+	nano::block_store & store;
+	size_t const memory_limit;
+	nano::mutex mutex;
+
+	friend std::unique_ptr<container_info_component> collect_container_info (unchecked_map &, std::string const &);
+};
+
+std::unique_ptr<container_info_component> collect_container_info (unchecked_map & unchecked_map, std::string const & name);
+}
@@ -15,8 +15,9 @@
 
 #include <boost/format.hpp>
 
-nano::vote_processor::vote_processor (nano::signature_checker & checker_a, nano::active_transactions & active_a, nano::node_observers & observers_a, nano::stat & stats_a, nano::node_config & config_a, nano::node_flags & flags_a, nano::logger_mt & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a) :
+nano::vote_processor::vote_processor (nano::signature_checker & checker_a, nano::signature_cache & signature_cache_a, nano::active_transactions & active_a, nano::node_observers & observers_a, nano::stat & stats_a, nano::node_config & config_a, nano::node_flags & flags_a, nano::logger_mt & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a) :
 checker (checker_a),
+signature_cache (signature_cache_a),
 active (active_a),
 observers (observers_a),
 stats (stats_a),
@@ -154,7 +155,10 @@ void nano::vote_processor::verify_votes (decltype (votes) const & votes_a)
 		signatures.push_back (vote.first->signature.bytes.data ());
 	}
 	nano::signature_check_set check = { size, messages.data (), lengths.data (), pub_keys.data (), signatures.data (), verifications.data () };
-	checker.verify (check);
+	// Votes verified recently, for example when the same vote arrived from another peer, are not verified again
+	auto hits (signature_cache.verify (checker, check));
+	stats.add (nano::stat::type::signature_cache, nano::stat::detail::vote_hit, nano::stat::dir::in, hits);
+	stats.add (nano::stat::type::signature_cache, nano::stat::detail::vote_miss, nano::stat::dir::in, size - hits);
 	auto i (0);
 	for (auto const & vote : votes_a)
 	{
@@ -170,7 +174,18 @@ void nano::vote_processor::verify_votes (decltype (votes) const & votes_a)
 nano::vote_code nano::vote_processor::vote_blocking (std::shared_ptr<nano::vote> const & vote_a, std::shared_ptr<nano::transport::channel> const & channel_a, bool validated)
 {
 	auto result (nano::vote_code::invalid);
-	if (validated || !vote_a->validate ())
+	if (!validated)
+	{
+		auto const hash (vote_a->hash ());
+		validated = signature_cache.exists (hash, vote_a->account, vote_a->signature);
+		stats.inc (nano::stat::type::signature_cache, validated ? nano::stat::detail::vote_hit : nano::stat::detail::vote_miss);
+		if (!validated && !vote_a->validate ())
+		{
+			validated = true;
+			signature_cache.insert (hash, vote_a->account, vote_a->signature);
+		}
+	}
+	if (validated)
 	{
 		result = active.vote (vote_a);
 		observers.vote.notify (vote_a, channel_a, result);
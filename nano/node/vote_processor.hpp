@@ -13,6 +13,7 @@
 namespace nano
 {
 class signature_checker;
+class signature_cache;
 class active_transactions;
 class block_store;
 class node_observers;
@@ -34,7 +35,7 @@ namespace transport
 class vote_processor final
 {
 public:
-	explicit vote_processor (nano::signature_checker & checker_a, nano::active_transactions & active_a, nano::node_observers & observers_a, nano::stat & stats_a, nano::node_config & config_a, nano::node_flags & flags_a, nano::logger_mt & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a);
+	explicit vote_processor (nano::signature_checker & checker_a, nano::signature_cache & signature_cache_a, nano::active_transactions & active_a, nano::node_observers & observers_a, nano::stat & stats_a, nano::node_config & config_a, nano::node_flags & flags_a, nano::logger_mt & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a);
 	/** Returns false if the vote was processed */
 	bool vote (std::shared_ptr<nano::vote> const &, std::shared_ptr<nano::transport::channel> const &);
 	/** Note: node.active.mutex lock is required */
@@ -53,6 +54,7 @@ private:
 	void process_loop ();
 
 	nano::signature_checker & checker;
+	nano::signature_cache & signature_cache;
 	nano::active_transactions & active;
 	nano::node_observers & observers;
 	nano::stat & stats;
@@ -10,6 +10,7 @@
 #include <nano/secure/ledger.hpp>
 
 #include <chrono>
+#include <limits>
 
 void nano::vote_spacing::trim ()
 {
@@ -158,8 +159,15 @@ history (history_a),
 spacing{ config_a.network_params.voting.delay },
 network (network_a),
 stats (stats_a),
+signing_pending_max (2 * std::max (1u, config_a.vote_generator_threads)),
+signing_pool (std::max (1u, config_a.vote_generator_threads), nano::thread_role::name::vote_signing),
 thread ([this]() { run (); })
 {
+	// Latencies in microseconds
+	for (auto detail : { nano::stat::detail::generator_queue_latency, nano::stat::detail::generator_sign_latency, nano::stat::detail::generator_broadcast_latency })
+	{
+		stats.define_histogram (nano::stat::type::vote_generator, detail, nano::stat::dir::in, { 0, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, std::numeric_limits<uint64_t>::max () });
+	}
 	nano::unique_lock<nano::mutex> lock (mutex);
 	condition.wait (lock, [& started = started] { return started; });
 }
@@ -181,8 +189,9 @@ void nano::vote_generator::add (nano::root const & root_a, nano::block_hash cons
 		if (block != nullptr && ledger.dependents_confirmed (transaction, *block))
 		{
 			nano::unique_lock<nano::mutex> lock (mutex);
-			candidates.emplace_back (root_a, hash_a);
-			if (candidates.size () >= nano::network::confirm_ack_hashes_max)
+			candidates.emplace_back (candidate_t{ root_a, hash_a }, std::chrono::steady_clock::now ());
+			// The first candidate sets the broadcast deadline
+			if (candidates.size () == 1 || candidates.size () >= nano::network::confirm_ack_hashes_max)
 			{
 				lock.unlock ();
 				condition.notify_all ();
@@ -203,6 +212,7 @@ void nano::vote_generator::stop ()
 	{
 		thread.join ();
 	}
+	signing_pool.stop ();
 }
 
 size_t nano::vote_generator::generate (std::vector<std::shared_ptr<nano::block>> const & blocks_a, std::shared_ptr<nano::transport::channel> const & channel_a)
@@ -220,7 +230,7 @@ size_t nano::vote_generator::generate (std::vector<std::shared_ptr<nano::block>>
 	}
 	auto const result = req_candidates.size ();
 	nano::lock_guard<nano::mutex> guard (mutex);
-	requests.emplace_back (std::move (req_candidates), channel_a);
+	requests.emplace_back (request_t{ std::move (req_candidates), channel_a }, std::chrono::steady_clock::now ());
 	while (requests.size () > max_requests)
 	{
 		// On a large queue of requests, erase the oldest one
@@ -240,52 +250,59 @@ void nano::vote_generator::broadcast (nano::unique_lock<nano::mutex> & lock_a)
 {
 	debug_assert (lock_a.owns_lock ());
 	std::unordered_set<std::shared_ptr<nano::vote>> cached_sent;
-	std::vector<nano::block_hash> hashes;
-	std::vector<nano::root> roots;
-	hashes.reserve (nano::network::confirm_ack_hashes_max);
-	roots.reserve (nano::network::confirm_ack_hashes_max);
-	while (!candidates.empty () && hashes.size () < nano::network::confirm_ack_hashes_max)
+	// The oldest candidates are always sent, further votes only while they are full and the signing pool has room for them
+	auto first (true);
+	while (!stopped && !candidates.empty () && (first || (candidates.size () >= nano::network::confirm_ack_hashes_max && signing_pending < signing_pending_max)))
 	{
-		auto const & [root, hash] = candidates.front ();
-		auto cached_votes = history.votes (root, hash);
-		for (auto const & cached_vote : cached_votes)
-		{
-			if (cached_sent.insert (cached_vote).second)
-			{
-				broadcast_action (cached_vote);
-			}
-		}
-		if (cached_votes.empty () && std::find (roots.begin (), roots.end (), root) == roots.end ())
+		first = false;
+		std::vector<nano::block_hash> hashes;
+		std::vector<nano::root> roots;
+		hashes.reserve (nano::network::confirm_ack_hashes_max);
+		roots.reserve (nano::network::confirm_ack_hashes_max);
+		auto const queued (candidates.front ().second);
+		while (!candidates.empty () && hashes.size () < nano::network::confirm_ack_hashes_max)
 		{
-			if (spacing.votable (root, hash))
+			auto const & [root, hash] = candidates.front ().first;
+			auto cached_votes = history.votes (root, hash);
+			for (auto const & cached_vote : cached_votes)
 			{
-				roots.push_back (root);
-				hashes.push_back (hash);
+				if (cached_sent.insert (cached_vote).second)
+				{
+					broadcast_action (cached_vote);
+				}
 			}
-			else
+			if (cached_votes.empty () && std::find (roots.begin (), roots.end (), root) == roots.end ())
 			{
-				stats.inc (nano::stat::type::vote_generator, nano::stat::detail::generator_spacing);
+				if (spacing.votable (root, hash))
+				{
+					roots.push_back (root);
+					hashes.push_back (hash);
+					spacing.flag (root, hash);
+				}
+				else
+				{
+					stats.inc (nano::stat::type::vote_generator, nano::stat::detail::generator_spacing);
+				}
 			}
+			candidates.pop_front ();
+		}
+		if (!hashes.empty ())
+		{
+			submit (lock_a, std::move (hashes), std::move (roots), queued, [this](auto const & vote_a) {
+				this->broadcast_action (vote_a);
+				this->stats.inc (nano::stat::type::vote_generator, nano::stat::detail::generator_broadcasts);
+			});
 		}
-		candidates.pop_front ();
-	}
-	if (!hashes.empty ())
-	{
-		lock_a.unlock ();
-		vote (hashes, roots, [this](auto const & vote_a) {
-			this->broadcast_action (vote_a);
-			this->stats.inc (nano::stat::type::vote_generator, nano::stat::detail::generator_broadcasts);
-		});
-		lock_a.lock ();
 	}
 }
 
-void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, request_t && request_a)
+void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, queued_request_t && request_a)
 {
 	lock_a.unlock ();
+	auto const & [candidates_l, channel] = request_a.first;
 	std::unordered_set<std::shared_ptr<nano::vote>> cached_sent;
-	auto i (request_a.first.cbegin ());
-	auto n (request_a.first.cend ());
+	auto i (candidates_l.cbegin ());
+	auto n (candidates_l.cend ());
 	while (i != n && !stopped)
 	{
 		std::vector<nano::block_hash> hashes;
@@ -302,7 +319,7 @@ void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, reque
 				{
 					stats.add (nano::stat::type::requests, nano::stat::detail::requests_cached_late_hashes, stat::dir::in, cached_vote->blocks.size ());
 					stats.inc (nano::stat::type::requests, nano::stat::detail::requests_cached_late_votes, stat::dir::in);
-					reply_action (cached_vote, request_a.second);
+					reply_action (cached_vote, channel);
 				}
 			}
 			if (cached_votes.empty () && std::find (roots.begin (), roots.end (), root) == roots.end ())
@@ -311,6 +328,7 @@ void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, reque
 				{
 					roots.push_back (root);
 					hashes.push_back (hash);
+					spacing.flag (root, hash);
 				}
 				else
 				{
@@ -321,32 +339,58 @@ void nano::vote_generator::reply (nano::unique_lock<nano::mutex> & lock_a, reque
 		if (!hashes.empty ())
 		{
 			stats.add (nano::stat::type::requests, nano::stat::detail::requests_generated_hashes, stat::dir::in, hashes.size ());
-			vote (hashes, roots, [this, &channel = request_a.second](std::shared_ptr<nano::vote> const & vote_a) {
+			lock_a.lock ();
+			submit (lock_a, std::move (hashes), std::move (roots), request_a.second, [this, channel = channel](std::shared_ptr<nano::vote> const & vote_a) {
 				this->reply_action (vote_a, channel);
 				this->stats.inc (nano::stat::type::requests, nano::stat::detail::requests_generated_votes, stat::dir::in);
 			});
+			lock_a.unlock ();
 		}
 	}
 	stats.inc (nano::stat::type::vote_generator, nano::stat::detail::generator_replies);
 	lock_a.lock ();
 }
 
+void nano::vote_generator::submit (nano::unique_lock<nano::mutex> & lock_a, std::vector<nano::block_hash> && hashes_a, std::vector<nano::root> && roots_a, std::chrono::steady_clock::time_point queued_a, std::function<void(std::shared_ptr<nano::vote> const &)> && action_a)
+{
+	debug_assert (lock_a.owns_lock ());
+	condition.wait (lock_a, [this]() { return stopped || signing_pending < signing_pending_max; });
+	if (!stopped)
+	{
+		++signing_pending;
+		signing_pool.push_task ([this, hashes = std::move (hashes_a), roots = std::move (roots_a), queued_a, action = std::move (action_a)]() {
+			auto const queue_latency (std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - queued_a));
+			stats.update_histogram (nano::stat::type::vote_generator, nano::stat::detail::generator_queue_latency, nano::stat::dir::in, queue_latency.count ());
+			vote (hashes, roots, action);
+			{
+				nano::lock_guard<nano::mutex> guard (mutex);
+				--signing_pending;
+			}
+			condition.notify_all ();
+		});
+	}
+}
+
 void nano::vote_generator::vote (std::vector<nano::block_hash> const & hashes_a, std::vector<nano::root> const & roots_a, std::function<void(std::shared_ptr<nano::vote> const &)> const & action_a)
 {
 	debug_assert (hashes_a.size () == roots_a.size ());
+	auto const sign_start (std::chrono::steady_clock::now ());
 	std::vector<std::shared_ptr<nano::vote>> votes_l;
 	wallets.foreach_representative ([this, &hashes_a, &votes_l](nano::public_key const & pub_a, nano::raw_key const & prv_a) {
 		votes_l.emplace_back (std::make_shared<nano::vote> (pub_a, prv_a, nano::milliseconds_since_epoch (), hashes_a));
 	});
+	auto const broadcast_start (std::chrono::steady_clock::now ());
 	for (auto const & vote_l : votes_l)
 	{
 		for (size_t i (0), n (hashes_a.size ()); i != n; ++i)
 		{
 			history.add (roots_a[i], hashes_a[i], vote_l);
-			spacing.flag (roots_a[i], hashes_a[i]);
 		}
 		action_a (vote_l);
 	}
+	auto const broadcast_end (std::chrono::steady_clock::now ());
+	stats.update_histogram (nano::stat::type::vote_generator, nano::stat::detail::generator_sign_latency, nano::stat::dir::in, std::chrono::duration_cast<std::chrono::microseconds> (broadcast_start - sign_start).count ());
+	stats.update_histogram (nano::stat::type::vote_generator, nano::stat::detail::generator_broadcast_latency, nano::stat::dir::in, std::chrono::duration_cast<std::chrono::microseconds> (broadcast_end - broadcast_start).count ());
 }
 
 void nano::vote_generator::broadcast_action (std::shared_ptr<nano::vote> const & vote_a) const
@@ -356,6 +400,14 @@ void nano::vote_generator::broadcast_action (std::shared_ptr<nano::vote> const &
 	vote_processor.vote (vote_a, std::make_shared<nano::transport::channel_loopback> (network.node));
 }
 
+std::chrono::steady_clock::time_point nano::vote_generator::broadcast_deadline () const
+{
+	debug_assert (!candidates.empty ());
+	// Give a partial vote one more delay to fill up when enough hashes are already queued, or when the signing pool is busy and could not sign it sooner anyway
+	auto const extend (candidates.size () >= config.vote_generator_threshold || signing_pending >= signing_pool.get_num_threads ());
+	return candidates.front ().second + (extend ? 2 : 1) * config.vote_generator_delay;
+}
+
 void nano::vote_generator::run ()
 {
 	nano::thread_role::set (nano::thread_role::name::voting);
@@ -372,21 +424,20 @@ void nano::vote_generator::run ()
 		}
 		else if (!requests.empty ())
 		{
-			auto request (requests.front ());
+			auto request (std::move (requests.front ()));
 			requests.pop_front ();
 			reply (lock, std::move (request));
 		}
+		else if (!candidates.empty () && std::chrono::steady_clock::now () >= broadcast_deadline ())
+		{
+			broadcast (lock);
+		}
 		else
 		{
-			condition.wait_for (lock, config.vote_generator_delay, [this]() { return this->candidates.size () >= nano::network::confirm_ack_hashes_max; });
-			if (candidates.size () >= config.vote_generator_threshold && candidates.size () < nano::network::confirm_ack_hashes_max)
-			{
-				condition.wait_for (lock, config.vote_generator_delay, [this]() { return this->candidates.size () >= nano::network::confirm_ack_hashes_max; });
-			}
-			if (!candidates.empty ())
-			{
-				broadcast (lock);
-			}
+			// Wake up for a full vote, or when the first candidate arrives to wait for its deadline instead
+			auto const idle (candidates.empty ());
+			auto const deadline (idle ? std::chrono::steady_clock::now () + config.vote_generator_delay : broadcast_deadline ());
+			condition.wait_until (lock, deadline, [this, idle]() { return this->stopped || this->candidates.size () >= nano::network::confirm_ack_hashes_max || (idle && !this->candidates.empty ()); });
 		}
 	}
 }
@@ -425,5 +476,6 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (na
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "candidates", candidates_count, sizeof_candidate_element }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "requests", requests_count, sizeof_request_element }));
+	composite->add_component (collect_container_info (vote_generator.signing_pool, "signing_pool"));
 	return composite;
 }
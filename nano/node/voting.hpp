@@ -2,6 +2,7 @@
 
 #include <nano/lib/locks.hpp>
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/threading.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/node/wallet.hpp>
 #include <nano/secure/common.hpp>
@@ -116,6 +117,8 @@ class vote_generator final
 private:
 	using candidate_t = std::pair<nano::root, nano::block_hash>;
 	using request_t = std::pair<std::vector<candidate_t>, std::shared_ptr<nano::transport::channel>>;
+	using queued_candidate_t = std::pair<candidate_t, std::chrono::steady_clock::time_point>;
+	using queued_request_t = std::pair<request_t, std::chrono::steady_clock::time_point>;
 
 public:
 	vote_generator (nano::node_config const & config_a, nano::ledger & ledger_a, nano::wallets & wallets_a, nano::vote_processor & vote_processor_a, nano::local_vote_history & history_a, nano::network & network_a, nano::stat & stats_a);
@@ -129,10 +132,14 @@ public:
 private:
 	void run ();
 	void broadcast (nano::unique_lock<nano::mutex> &);
-	void reply (nano::unique_lock<nano::mutex> &, request_t &&);
+	void reply (nano::unique_lock<nano::mutex> &, queued_request_t &&);
+	/** Hands a vote for \p hashes_a to the signing pool, waiting while too many votes are pending. The mutex must be held */
+	void submit (nano::unique_lock<nano::mutex> &, std::vector<nano::block_hash> && hashes_a, std::vector<nano::root> && roots_a, std::chrono::steady_clock::time_point queued_a, std::function<void(std::shared_ptr<nano::vote> const &)> && action_a);
 	void vote (std::vector<nano::block_hash> const &, std::vector<nano::root> const &, std::function<void(std::shared_ptr<nano::vote> const &)> const &);
+	/** Time at which the queued candidates are broadcast as a partial vote */
+	std::chrono::steady_clock::time_point broadcast_deadline () const;
 	void broadcast_action (std::shared_ptr<nano::vote> const &) const;
-	std::function<void(std::shared_ptr<nano::vote> const &, std::shared_ptr<nano::transport::channel> &)> reply_action; // must be set only during initialization by using set_reply_action
+	std::function<void(std::shared_ptr<nano::vote> const &, std::shared_ptr<nano::transport::channel> const &)> reply_action; // must be set only during initialization by using set_reply_action
 	nano::node_config const & config;
 	nano::ledger & ledger;
 	nano::wallets & wallets;
@@ -144,11 +151,15 @@ private:
 	mutable nano::mutex mutex;
 	nano::condition_variable condition;
 	static size_t constexpr max_requests{ 2048 };
-	std::deque<request_t> requests;
-	std::deque<candidate_t> candidates;
+	std::deque<queued_request_t> requests;
+	std::deque<queued_candidate_t> candidates;
 	nano::network_params network_params;
 	std::atomic<bool> stopped{ false };
 	bool started{ false };
+	/** Votes handed to the signing pool and not yet broadcast */
+	unsigned signing_pending{ 0 };
+	unsigned const signing_pending_max;
+	nano::thread_pool signing_pool;
 	std::thread thread;
 
 	friend std::unique_ptr<container_info_component> collect_container_info (vote_generator & vote_generator, std::string const & name);
@@ -649,13 +649,80 @@ void nano::wallet_store::version_put (nano::transaction const & transaction_a, u
 	entry_put_raw (transaction_a, nano::wallet_store::version_special, nano::wallet_value (entry, 0));
 }
 
+nano::kdf::kdf (unsigned concurrency_a) :
+concurrency (std::max (1u, concurrency_a))
+{
+}
+
 void nano::kdf::phs (nano::raw_key & result_a, std::string const & password_a, nano::uint256_union const & salt_a)
 {
-	static nano::network_params network_params;
+	if (password_a.empty ())
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		auto existing (precomputed.find (salt_a));
+		if (existing != precomputed.end ())
+		{
+			result_a = existing->second;
+			precomputed.erase (existing);
+			return;
+		}
+	}
+	derive (result_a, password_a, salt_a);
+}
+
+void nano::kdf::precompute (std::vector<nano::uint256_union> const & salts_a)
+{
+	std::atomic<size_t> next (0);
+	auto run = [this, &salts_a, &next]() {
+		for (auto i (next++); i < salts_a.size (); i = next++)
+		{
+			nano::raw_key key;
+			derive (key, "", salts_a[i]);
+			nano::lock_guard<nano::mutex> lock (mutex);
+			precomputed[salts_a[i]] = key;
+		}
+	};
+	std::vector<std::thread> threads;
+	for (auto i (1u); i < std::min<size_t> (concurrency, salts_a.size ()); ++i)
+	{
+		threads.emplace_back (run);
+	}
+	run ();
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+}
+
+void nano::kdf::precomputed_clear ()
+{
+	nano::lock_guard<nano::mutex> lock (mutex);
+	precomputed.clear ();
+}
+
+size_t nano::kdf::precomputed_size ()
+{
 	nano::lock_guard<nano::mutex> lock (mutex);
+	return precomputed.size ();
+}
+
+void nano::kdf::derive (nano::raw_key & result_a, std::string const & password_a, nano::uint256_union const & salt_a)
+{
+	static nano::network_params network_params;
+	{
+		nano::unique_lock<nano::mutex> lock (mutex);
+		condition.wait (lock, [this]() { return active < concurrency; });
+		++active;
+	}
+	// A single lane keeps derived keys identical to those of existing wallets
 	auto success (argon2_hash (1, network_params.kdf_work, 1, password_a.data (), password_a.size (), salt_a.bytes.data (), salt_a.bytes.size (), result_a.bytes.data (), result_a.bytes.size (), NULL, 0, Argon2_d, 0x10));
 	debug_assert (success == 0);
 	(void)success;
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		--active;
+	}
+	condition.notify_one ();
 }
 
 nano::wallet::wallet (bool & init_a, nano::transaction & transaction_a, nano::wallets & wallets_a, std::string const & wallet_a) :
@@ -831,6 +898,7 @@ void nano::wallet_store::destroy (nano::transaction const & transaction_a)
 
 std::shared_ptr<nano::block> nano::wallet::receive_action (nano::block_hash const & send_hash_a, nano::account const & representative_a, nano::uint128_union const & amount_a, nano::account const & account_a, uint64_t work_a, bool generate_work_a)
 {
+	auto const cached_work (work_a == 0);
 	std::shared_ptr<nano::block> block;
 	nano::block_details details;
 	details.is_receive = true;
@@ -885,7 +953,7 @@ std::shared_ptr<nano::block> nano::wallet::receive_action (nano::block_hash cons
 	}
 	if (block != nullptr)
 	{
-		if (action_complete (block, account_a, generate_work_a, details))
+		if (action_complete (block, account_a, generate_work_a, details, cached_work))
 		{
 			// Return null block after work generation or ledger process error
 			block = nullptr;
@@ -896,6 +964,7 @@ std::shared_ptr<nano::block> nano::wallet::receive_action (nano::block_hash cons
 
 std::shared_ptr<nano::block> nano::wallet::change_action (nano::account const & source_a, nano::account const & representative_a, uint64_t work_a, bool generate_work_a)
 {
+	auto const cached_work (work_a == 0);
 	std::shared_ptr<nano::block> block;
 	nano::block_details details;
 	{
@@ -925,7 +994,7 @@ std::shared_ptr<nano::block> nano::wallet::change_action (nano::account const &
 	}
 	if (block != nullptr)
 	{
-		if (action_complete (block, source_a, generate_work_a, details))
+		if (action_complete (block, source_a, generate_work_a, details, cached_work))
 		{
 			// Return null block after work generation or ledger process error
 			block = nullptr;
@@ -936,6 +1005,7 @@ std::shared_ptr<nano::block> nano::wallet::change_action (nano::account const &
 
 std::shared_ptr<nano::block> nano::wallet::send_action (nano::account const & source_a, nano::account const & account_a, nano::uint128_t const & amount_a, uint64_t work_a, bool generate_work_a, boost::optional<std::string> id_a)
 {
+	auto const cached_work (work_a == 0);
 	boost::optional<nano::mdb_val> id_mdb_val;
 	if (id_a)
 	{
@@ -1028,7 +1098,7 @@ std::shared_ptr<nano::block> nano::wallet::send_action (nano::account const & so
 
 	if (!error && block != nullptr && !cached_block)
 	{
-		if (action_complete (block, source_a, generate_work_a, details))
+		if (action_complete (block, source_a, generate_work_a, details, cached_work))
 		{
 			// Return null block after work generation or ledger process error
 			block = nullptr;
@@ -1037,15 +1107,21 @@ std::shared_ptr<nano::block> nano::wallet::send_action (nano::account const & so
 	return block;
 }
 
-bool nano::wallet::action_complete (std::shared_ptr<nano::block> const & block_a, nano::account const & account_a, bool const generate_work_a, nano::block_details const & details_a)
+bool nano::wallet::action_complete (std::shared_ptr<nano::block> const & block_a, nano::account const & account_a, bool const generate_work_a, nano::block_details const & details_a, bool const cached_work_a)
 {
 	bool error{ false };
 	// Unschedule any work caching for this account
 	wallets.delayed_work->erase (account_a);
+	wallets.precache->remove (account_a);
 	if (block_a != nullptr)
 	{
 		auto required_difficulty{ nano::work_threshold (block_a->work_version (), details_a) };
-		if (block_a->difficulty () < required_difficulty)
+		auto cached (block_a->difficulty () >= required_difficulty);
+		if (cached_work_a)
+		{
+			wallets.node.stats.inc (nano::stat::type::work_precache, cached ? nano::stat::detail::cache_hit : nano::stat::detail::cache_miss);
+		}
+		if (!cached)
 		{
 			wallets.node.logger.try_log (boost::str (boost::format ("Cached or provided work for block %1% account %2% is invalid, regenerating") % block_a->hash ().to_string () % account_a.to_account ()));
 			debug_assert (required_difficulty <= wallets.node.max_work_generate_difficulty (block_a->work_version ()));
@@ -1083,7 +1159,8 @@ void nano::wallet::change_async (nano::account const & source_a, nano::account c
 	wallets.node.wallets.queue_wallet_action (nano::wallets::high_priority, this_l, [this_l, source_a, representative_a, action_a, work_a, generate_work_a](nano::wallet & wallet_a) {
 		auto block (wallet_a.change_action (source_a, representative_a, work_a, generate_work_a));
 		action_a (block);
-	});
+	},
+	source_a);
 }
 
 bool nano::wallet::receive_sync (std::shared_ptr<nano::block> const & block_a, nano::account const & representative_a, nano::uint128_t const & amount_a)
@@ -1105,7 +1182,8 @@ void nano::wallet::receive_async (nano::block_hash const & hash_a, nano::account
 	wallets.node.wallets.queue_wallet_action (amount_a, this_l, [this_l, hash_a, representative_a, amount_a, account_a, action_a, work_a, generate_work_a](nano::wallet & wallet_a) {
 		auto block (wallet_a.receive_action (hash_a, representative_a, amount_a, account_a, work_a, generate_work_a));
 		action_a (block);
-	});
+	},
+	account_a);
 }
 
 nano::block_hash nano::wallet::send_sync (nano::account const & source_a, nano::account const & account_a, nano::uint128_t const & amount_a)
@@ -1126,7 +1204,8 @@ void nano::wallet::send_async (nano::account const & source_a, nano::account con
 	wallets.node.wallets.queue_wallet_action (nano::wallets::high_priority, this_l, [this_l, source_a, account_a, amount_a, action_a, work_a, generate_work_a, id_a](nano::wallet & wallet_a) {
 		auto block (wallet_a.send_action (source_a, account_a, amount_a, work_a, generate_work_a, id_a));
 		action_a (block);
-	});
+	},
+	source_a);
 }
 
 // Update work for account if latest root is root_a
@@ -1159,9 +1238,7 @@ void nano::wallet::work_ensure (nano::account const & account_a, nano::root cons
 		if (existing != delayed_work->end () && existing->second == root_a)
 		{
 			delayed_work->erase (existing);
-			this_l->wallets.queue_wallet_action (nano::wallets::generate_priority, this_l, [account_a, root_a](nano::wallet & wallet_a) {
-				wallet_a.work_cache_blocking (account_a, root_a);
-			});
+			this_l->wallets.precache->add (this_l, account_a, root_a);
 		}
 	});
 }
@@ -1172,53 +1249,23 @@ bool nano::wallet::search_pending (nano::transaction const & wallet_transaction_
 	if (!result)
 	{
 		wallets.node.logger.try_log ("Beginning pending block search");
+		std::vector<nano::account> accounts;
 		for (auto i (store.begin (wallet_transaction_a)), n (store.end ()); i != n; ++i)
 		{
-			auto block_transaction (wallets.node.store.tx_begin_read ());
-			nano::account const & account (i->first);
 			// Don't search pending for watch-only accounts
 			if (!nano::wallet_value (i->second).key.is_zero ())
 			{
-				for (auto j (wallets.node.store.pending_begin (block_transaction, nano::pending_key (account, 0))), k (wallets.node.store.pending_end ()); j != k && nano::pending_key (j->first).account == account; ++j)
-				{
-					nano::pending_key key (j->first);
-					auto hash (key.hash);
-					nano::pending_info pending (j->second);
-					auto amount (pending.amount.number ());
-					if (wallets.node.config.receive_minimum.number () <= amount)
-					{
-						wallets.node.logger.try_log (boost::str (boost::format ("Found a pending block %1% for account %2%") % hash.to_string () % pending.source.to_account ()));
-						bool confirmed (wallets.node.ledger.block_confirmed (block_transaction, hash));
-						if (confirmed)
-						{
-							auto block (wallets.node.store.block_get (block_transaction, hash));
-							release_assert (block->type () == nano::block_type::state || block->type () == nano::block_type::send);
-						}
-						else if (wallets.node.ledger.pruning)
-						{
-							// All pruned blocks should be confirmed
-							confirmed = wallets.node.store.pruned_exists (block_transaction, hash);
-						}
-						if (confirmed)
-						{
-							auto representative = store.representative (wallet_transaction_a);
-							// Receive confirmed block
-							receive_async (hash, representative, amount, account, [](std::shared_ptr<nano::block> const &) {});
-						}
-						else if (!wallets.node.confirmation_height_processor.is_processing_block (hash))
-						{
-							auto block (wallets.node.store.block_get (block_transaction, hash));
-							if (block)
-							{
-								// Request confirmation for block which is not being processed yet
-								wallets.node.block_confirm (block);
-							}
-						}
-					}
-				}
+				accounts.push_back (i->first);
 			}
 		}
-		wallets.node.logger.try_log ("Pending block search phase complete");
+		std::sort (accounts.begin (), accounts.end ());
+		nano::pending_search search (wallets.node);
+		auto receivables (search.find (accounts));
+		if (!receivables.empty ())
+		{
+			receive_pending (std::deque<nano::receivable> (receivables.begin (), receivables.end ()), store.representative (wallet_transaction_a));
+		}
+		wallets.node.logger.try_log (boost::str (boost::format ("Pending block search phase complete, %1% accounts searched and %2% confirmed blocks queued for receiving") % accounts.size () % receivables.size ()));
 	}
 	else
 	{
@@ -1227,6 +1274,134 @@ bool nano::wallet::search_pending (nano::transaction const & wallet_transaction_
 	return result;
 }
 
+void nano::wallet::receive_pending (std::deque<nano::receivable> receivables_a, nano::account const & representative_a)
+{
+	auto queue (std::make_shared<nano::locked<std::deque<nano::receivable>>> (std::move (receivables_a)));
+	for (size_t i (0); i < nano::pending_search::max_queued_receives; ++i)
+	{
+		receive_next (queue, representative_a);
+	}
+}
+
+void nano::wallet::receive_next (std::shared_ptr<nano::locked<std::deque<nano::receivable>>> const & queue_a, nano::account const & representative_a)
+{
+	boost::optional<nano::receivable> next;
+	{
+		auto queue_l (queue_a->lock ());
+		if (!queue_l->empty ())
+		{
+			next = queue_l->front ();
+			queue_l->pop_front ();
+		}
+	}
+	if (next.is_initialized ())
+	{
+		// Each completed receive queues the next one, keeping the action queue bounded for large searches
+		receive_async (next->hash, representative_a, next->amount, next->account, [this_l = shared_from_this (), queue_a, representative_a](std::shared_ptr<nano::block> const & block_a) {
+			this_l->wallets.node.stats.inc (nano::stat::type::pending_search, block_a != nullptr ? nano::stat::detail::receive : nano::stat::detail::receive_failed);
+			this_l->receive_next (queue_a, representative_a);
+		});
+	}
+}
+
+nano::pending_search::pending_search (nano::node & node_a) :
+node (node_a)
+{
+}
+
+std::vector<nano::receivable> nano::pending_search::find (std::vector<nano::account> const & accounts_a)
+{
+	debug_assert (std::is_sorted (accounts_a.begin (), accounts_a.end ()));
+	std::vector<nano::receivable> result;
+	std::vector<std::pair<nano::pending_key, nano::pending_info>> entries;
+	auto transaction (node.store.tx_begin_read ());
+	if (accounts_a.size () >= parallel_scan_threshold)
+	{
+		scan_parallel (accounts_a, entries);
+	}
+	else
+	{
+		scan_sorted (transaction, accounts_a, entries);
+	}
+	node.stats.add (nano::stat::type::pending_search, nano::stat::detail::accounts, nano::stat::dir::in, accounts_a.size ());
+	node.stats.add (nano::stat::type::pending_search, nano::stat::detail::pending, nano::stat::dir::in, entries.size ());
+	// Confirmation heights are shared by every pending entry from the same source account
+	std::unordered_map<nano::account, uint64_t> confirmed_heights;
+	for (auto const & [key, pending] : entries)
+	{
+		auto amount (pending.amount.number ());
+		node.logger.try_log (boost::str (boost::format ("Found a pending block %1% for account %2%") % key.hash.to_string () % pending.source.to_account ()));
+		auto block (node.store.block_get (transaction, key.hash));
+		bool confirmed (false);
+		if (block != nullptr)
+		{
+			release_assert (block->type () == nano::block_type::state || block->type () == nano::block_type::send);
+			auto existing (confirmed_heights.find (pending.source));
+			if (existing == confirmed_heights.end ())
+			{
+				nano::confirmation_height_info confirmation_height_info;
+				node.store.confirmation_height_get (transaction, pending.source, confirmation_height_info);
+				existing = confirmed_heights.emplace (pending.source, confirmation_height_info.height).first;
+			}
+			confirmed = existing->second >= block->sideband ().height;
+		}
+		else if (node.ledger.pruning)
+		{
+			// All pruned blocks should be confirmed
+			confirmed = node.store.pruned_exists (transaction, key.hash);
+		}
+		if (confirmed)
+		{
+			result.push_back ({ key.hash, key.account, amount });
+		}
+		else if (block != nullptr && !node.confirmation_height_processor.is_processing_block (key.hash))
+		{
+			// Request confirmation for block which is not being processed yet
+			node.stats.inc (nano::stat::type::pending_search, nano::stat::detail::confirm_requested);
+			node.block_confirm (block);
+		}
+	}
+	node.stats.add (nano::stat::type::pending_search, nano::stat::detail::confirmed, nano::stat::dir::in, result.size ());
+	return result;
+}
+
+void nano::pending_search::scan_sorted (nano::read_transaction const & transaction_a, std::vector<nano::account> const & accounts_a, std::vector<std::pair<nano::pending_key, nano::pending_info>> & entries_a)
+{
+	auto const & receive_minimum (node.config.receive_minimum.number ());
+	for (auto const & account : accounts_a)
+	{
+		for (auto i (node.store.pending_begin (transaction_a, nano::pending_key (account, 0))), n (node.store.pending_end ()); i != n && nano::pending_key (i->first).account == account; ++i)
+		{
+			nano::pending_info const & pending (i->second);
+			if (receive_minimum <= pending.amount.number ())
+			{
+				entries_a.emplace_back (i->first, pending);
+			}
+		}
+	}
+}
+
+void nano::pending_search::scan_parallel (std::vector<nano::account> const & accounts_a, std::vector<std::pair<nano::pending_key, nano::pending_info>> & entries_a)
+{
+	auto const & receive_minimum (node.config.receive_minimum.number ());
+	nano::mutex entries_mutex;
+	node.store.pending_for_each_par (
+	[&accounts_a, &entries_a, &entries_mutex, &receive_minimum](nano::read_transaction const &, nano::store_iterator<nano::pending_key, nano::pending_info> i, nano::store_iterator<nano::pending_key, nano::pending_info> n) {
+		std::vector<std::pair<nano::pending_key, nano::pending_info>> entries_l;
+		for (; i != n; ++i)
+		{
+			nano::pending_key const & key (i->first);
+			nano::pending_info const & pending (i->second);
+			if (receive_minimum <= pending.amount.number () && std::binary_search (accounts_a.begin (), accounts_a.end (), key.account))
+			{
+				entries_l.emplace_back (key, pending);
+			}
+		}
+		nano::lock_guard<nano::mutex> guard (entries_mutex);
+		entries_a.insert (entries_a.end (), entries_l.begin (), entries_l.end ());
+	});
+}
+
 void nano::wallet::init_free_accounts (nano::transaction const & transaction_a)
 {
 	free_accounts.clear ();
@@ -1337,6 +1512,7 @@ void nano::work_watcher::stop ()
 {
 	nano::unique_lock<nano::mutex> lock (mutex);
 	watched.clear ();
+	watched_size = 0;
 	stopped = true;
 }
 
@@ -1348,6 +1524,7 @@ void nano::work_watcher::add (std::shared_ptr<nano::block> const & block_a)
 		auto root_l (block_l->qualified_root ());
 		nano::unique_lock<nano::mutex> lock (mutex);
 		watched[root_l] = block_l;
+		watched_size = watched.size ();
 		lock.unlock ();
 		watching (root_l, block_l);
 	}
@@ -1357,6 +1534,7 @@ void nano::work_watcher::update (nano::qualified_root const & root_a, std::share
 {
 	nano::lock_guard<nano::mutex> guard (mutex);
 	watched[root_a] = block_a;
+	watched_size = watched.size ();
 }
 
 void nano::work_watcher::watching (nano::qualified_root const & root_a, std::shared_ptr<nano::state_block> const & block_a)
@@ -1410,6 +1588,7 @@ void nano::work_watcher::remove (nano::block const & block_a)
 	if (existing != watched.end ())
 	{
 		watched.erase (existing);
+		watched_size = watched.size ();
 		lock.unlock ();
 		node.observers.work_cancel.notify (block_a.root ());
 	}
@@ -1417,9 +1596,13 @@ void nano::work_watcher::remove (nano::block const & block_a)
 
 bool nano::work_watcher::is_watched (nano::qualified_root const & root_a)
 {
-	nano::lock_guard<nano::mutex> guard (mutex);
-	auto exists (watched.find (root_a));
-	return exists != watched.end ();
+	bool result (false);
+	if (watched_size != 0)
+	{
+		nano::lock_guard<nano::mutex> guard (mutex);
+		result = watched.find (root_a) != watched.end ();
+	}
+	return result;
 }
 
 auto nano::work_watcher::list_watched () -> decltype (watched)
@@ -1430,8 +1613,136 @@ auto nano::work_watcher::list_watched () -> decltype (watched)
 
 size_t nano::work_watcher::size ()
 {
-	nano::lock_guard<nano::mutex> guard (mutex);
-	return watched.size ();
+	return watched_size;
+}
+
+nano::work_precache::work_precache (nano::node & node_a) :
+node (node_a),
+thread ([this]() {
+	nano::thread_role::set (nano::thread_role::name::work_precache);
+	run ();
+})
+{
+}
+
+nano::work_precache::~work_precache ()
+{
+	stop ();
+}
+
+void nano::work_precache::stop ()
+{
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		stopped = true;
+		entries.clear ();
+	}
+	condition.notify_all ();
+	if (thread.joinable ())
+	{
+		thread.join ();
+	}
+}
+
+void nano::work_precache::add (std::shared_ptr<nano::wallet> const & wallet_a, nano::account const & account_a, nano::root const & root_a)
+{
+	{
+		nano::lock_guard<nano::mutex> lock (mutex);
+		if (stopped)
+		{
+			return;
+		}
+		auto & by_account (entries.get<tag_account> ());
+		auto existing (by_account.find (account_a));
+		if (existing != by_account.end ())
+		{
+			by_account.erase (existing);
+		}
+		entries.insert (entry{ account_a, root_a, wallet_a, std::chrono::steady_clock::now () });
+	}
+	node.stats.inc (nano::stat::type::work_precache, nano::stat::detail::precache_queued);
+	condition.notify_all ();
+}
+
+void nano::work_precache::remove (nano::account const & account_a)
+{
+	nano::lock_guard<nano::mutex> lock (mutex);
+	entries.get<tag_account> ().erase (account_a);
+}
+
+bool nano::work_precache::exists (nano::account const & account_a)
+{
+	nano::lock_guard<nano::mutex> lock (mutex);
+	return entries.get<tag_account> ().count (account_a) > 0;
+}
+
+size_t nano::work_precache::size ()
+{
+	nano::lock_guard<nano::mutex> lock (mutex);
+	return entries.size ();
+}
+
+void nano::work_precache::run ()
+{
+	nano::unique_lock<nano::mutex> lock (mutex);
+	while (!stopped)
+	{
+		// Precaching yields to any other request waiting in the local work pool, the pool is polled as it does not signal when it drains
+		if (!entries.empty () && in_flight < max_in_flight && node.work.size () == 0)
+		{
+			auto & by_activity (entries.get<tag_activity> ());
+			auto entry_l (*by_activity.begin ());
+			by_activity.erase (by_activity.begin ());
+			++in_flight;
+			lock.unlock ();
+			auto wallet_l (entry_l.wallet.lock ());
+			if (wallet_l != nullptr && node.work_generation_enabled ())
+			{
+				generate (wallet_l, entry_l.account, entry_l.root);
+			}
+			else
+			{
+				nano::lock_guard<nano::mutex> guard (mutex);
+				--in_flight;
+			}
+			lock.lock ();
+		}
+		else
+		{
+			condition.wait_for (lock, std::chrono::milliseconds (entries.empty () ? 1000 : 50));
+		}
+	}
+}
+
+void nano::work_precache::generate (std::shared_ptr<nano::wallet> const & wallet_a, nano::account const & account_a, nano::root const & root_a)
+{
+	std::weak_ptr<nano::work_precache> this_w (shared_from_this ());
+	node.work_generate (
+	nano::work_version::work_1, root_a, node.default_difficulty (nano::work_version::work_1), [this_w, wallet_a, account_a, root_a](boost::optional<uint64_t> work_a) {
+		if (auto this_l = this_w.lock ())
+		{
+			if (work_a.is_initialized ())
+			{
+				auto transaction_l (wallet_a->wallets.tx_begin_write ());
+				if (wallet_a->live () && wallet_a->store.exists (transaction_l, account_a))
+				{
+					wallet_a->work_update (transaction_l, account_a, root_a, *work_a);
+				}
+				this_l->node.stats.inc (nano::stat::type::work_precache, nano::stat::detail::precache_generated);
+			}
+			else if (!this_l->node.stopped)
+			{
+				this_l->node.stats.inc (nano::stat::type::work_precache, nano::stat::detail::precache_failed);
+				this_l->node.logger.try_log (boost::str (boost::format ("Could not precache work for root %1% due to work generation failure") % root_a.to_string ()));
+			}
+			{
+				nano::lock_guard<nano::mutex> guard (this_l->mutex);
+				--this_l->in_flight;
+			}
+			this_l->condition.notify_all ();
+		}
+	},
+	account_a);
 }
 
 void nano::wallets::do_wallet_actions ()
@@ -1439,19 +1750,52 @@ void nano::wallets::do_wallet_actions ()
 	nano::unique_lock<nano::mutex> action_lock (action_mutex);
 	while (!stopped)
 	{
-		if (!actions.empty ())
+		if (!ready_accounts.empty ())
 		{
-			auto first (actions.begin ());
+			auto & by_priority (ready_accounts.get<tag_priority> ());
+			auto account (by_priority.begin ()->account);
+			by_priority.erase (by_priority.begin ());
+			auto existing (actions.find (account));
+			debug_assert (existing != actions.end () && !existing->second.empty ());
+			auto first (existing->second.begin ());
 			auto wallet (first->second.first);
 			auto current (std::move (first->second.second));
-			actions.erase (first);
+			existing->second.erase (first);
+			if (existing->second.empty ())
+			{
+				actions.erase (existing);
+			}
+			--wallet->queued_actions;
 			if (wallet->live ())
 			{
+				// Other actions for this account wait until this one completes, preserving their order
+				busy_accounts.insert (account);
+				// Notified under the lock so the transitions of executing are observed in order
+				if (executing++ == 0)
+				{
+					observer (true);
+				}
 				action_lock.unlock ();
-				observer (true);
 				current (*wallet);
-				observer (false);
 				action_lock.lock ();
+				busy_accounts.erase (account);
+				auto next (actions.find (account));
+				if (next != actions.end ())
+				{
+					ready_account_put (account, next->second.begin ()->first);
+				}
+				if (--executing == 0)
+				{
+					observer (false);
+				}
+			}
+			else
+			{
+				auto next (actions.find (account));
+				if (next != actions.end ())
+				{
+					ready_account_put (account, next->second.begin ()->first);
+				}
 			}
 		}
 		else
@@ -1461,17 +1805,39 @@ void nano::wallets::do_wallet_actions ()
 	}
 }
 
+void nano::wallets::ready_account_put (nano::account const & account_a, nano::uint128_t const & priority_a)
+{
+	auto & by_account (ready_accounts.get<tag_account> ());
+	auto existing (by_account.find (account_a));
+	if (existing == by_account.end ())
+	{
+		by_account.insert ({ account_a, priority_a, arrival++ });
+		condition.notify_one ();
+	}
+	else if (existing->priority < priority_a)
+	{
+		by_account.modify (existing, [&priority_a](ready_account & ready_a) {
+			ready_a.priority = priority_a;
+		});
+	}
+}
+
 nano::wallets::wallets (bool error_a, nano::node & node_a) :
 observer ([](bool) {}),
+kdf (node_a.config.kdf_threads),
 node (node_a),
 env (boost::polymorphic_downcast<nano::mdb_wallets_store *> (node_a.wallets_store_impl.get ())->environment),
 stopped (false),
 watcher (std::make_shared<nano::work_watcher> (node_a)),
-thread ([this]() {
-	nano::thread_role::set (nano::thread_role::name::wallet_actions);
-	do_wallet_actions ();
-})
+precache (std::make_shared<nano::work_precache> (node_a))
 {
+	for (unsigned i (0); i < std::max (1u, node_a.config.wallet_action_threads); ++i)
+	{
+		threads.emplace_back ([this]() {
+			nano::thread_role::set (nano::thread_role::name::wallet_actions);
+			do_wallet_actions ();
+		});
+	}
 	nano::unique_lock<nano::mutex> lock (mutex);
 	if (!error_a)
 	{
@@ -1523,10 +1889,34 @@ thread ([this]() {
 		const boost::filesystem::path path (store_path);
 		nano::mdb_store::create_backup_file (env, path, node_a.logger);
 	}
+	// Every wallet is first tried with the empty password, derive those keys concurrently up front
+	std::vector<nano::uint256_union> salts;
+	{
+		auto transaction (tx_begin_read ());
+		for (auto & item : items)
+		{
+			// Only wallets without a password entered yet attempt the empty password
+			nano::raw_key password_l;
+			{
+				nano::lock_guard<std::recursive_mutex> store_lock (item.second->store.mutex);
+				item.second->store.password.value (password_l);
+			}
+			if (password_l.is_zero ())
+			{
+				salts.push_back (item.second->store.salt (transaction));
+			}
+		}
+	}
+	if (salts.size () > 1)
+	{
+		kdf.precompute (salts);
+	}
 	for (auto & item : items)
 	{
 		item.second->enter_initial_password ();
 	}
+	// Keys are never kept past the initial attempts, later phs calls derive their own
+	kdf.precomputed_clear ();
 	if (node_a.config.enable_voting)
 	{
 		lock.unlock ();
@@ -1647,13 +2037,26 @@ void nano::wallets::reload ()
 	}
 }
 
-void nano::wallets::queue_wallet_action (nano::uint128_t const & amount_a, std::shared_ptr<nano::wallet> const & wallet_a, std::function<void(nano::wallet &)> action_a)
+void nano::wallets::queue_wallet_action (nano::uint128_t const & amount_a, std::shared_ptr<nano::wallet> const & wallet_a, std::function<void(nano::wallet &)> action_a, nano::account const & account_a)
 {
+	nano::lock_guard<nano::mutex> action_lock (action_mutex);
+	actions[account_a].emplace (amount_a, std::make_pair (wallet_a, std::move (action_a)));
+	++wallet_a->queued_actions;
+	if (busy_accounts.count (account_a) == 0)
 	{
-		nano::lock_guard<nano::mutex> action_lock (action_mutex);
-		actions.emplace (amount_a, std::make_pair (wallet_a, action_a));
+		ready_account_put (account_a, amount_a);
 	}
-	condition.notify_all ();
+}
+
+size_t nano::wallets::actions_size ()
+{
+	nano::lock_guard<nano::mutex> action_lock (action_mutex);
+	size_t result (0);
+	for (auto const & [account, queue] : actions)
+	{
+		result += queue.size ();
+	}
+	return result;
 }
 
 void nano::wallets::foreach_representative (std::function<void(nano::public_key const & pub_a, nano::raw_key const & prv_a)> const & action_a)
@@ -1724,14 +2127,26 @@ void nano::wallets::stop ()
 	{
 		nano::lock_guard<nano::mutex> action_lock (action_mutex);
 		stopped = true;
+		for (auto const & [account, queue] : actions)
+		{
+			for (auto const & [priority, action] : queue)
+			{
+				--action.first->queued_actions;
+			}
+		}
 		actions.clear ();
+		ready_accounts.clear ();
 	}
 	condition.notify_all ();
-	if (thread.joinable ())
+	for (auto & thread : threads)
 	{
-		thread.join ();
+		if (thread.joinable ())
+		{
+			thread.join ();
+		}
 	}
 	watcher->stop ();
+	precache->stop ();
 }
 
 nano::write_transaction nano::wallets::tx_begin_write ()
@@ -1893,7 +2308,6 @@ std::unordered_map<nano::wallet_id, std::shared_ptr<nano::wallet>> nano::wallets
 	return items;
 }
 
-nano::uint128_t const nano::wallets::generate_priority = std::numeric_limits<nano::uint128_t>::max ();
 nano::uint128_t const nano::wallets::high_priority = std::numeric_limits<nano::uint128_t>::max () - 1;
 
 nano::store_iterator<nano::account, nano::wallet_value> nano::wallet_store::begin (nano::transaction const & transaction_a)
@@ -1952,19 +2366,19 @@ MDB_txn * nano::wallet_store::tx (nano::transaction const & transaction_a) const
 std::unique_ptr<nano::container_info_component> nano::collect_container_info (wallets & wallets, std::string const & name)
 {
 	size_t items_count;
-	size_t actions_count;
 	{
 		nano::lock_guard<nano::mutex> guard (wallets.mutex);
 		items_count = wallets.items.size ();
-		actions_count = wallets.actions.size ();
 	}
+	auto actions_count (wallets.actions_size ());
 
 	auto sizeof_item_element = sizeof (decltype (wallets.items)::value_type);
-	auto sizeof_actions_element = sizeof (decltype (wallets.actions)::value_type);
+	auto sizeof_actions_element = sizeof (nano::wallets::action_queue::value_type);
 	auto sizeof_watcher_element = sizeof (decltype (wallets.watcher->list_watched ())::value_type);
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "items", items_count, sizeof_item_element }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "actions", actions_count, sizeof_actions_element }));
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "work_watcher", wallets.watcher->size (), sizeof_watcher_element }));
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "work_precache", wallets.precache->size (), sizeof (nano::account) + sizeof (nano::root) }));
 	return composite;
 }
@@ -9,7 +9,14 @@
 #include <nano/secure/blockstore.hpp>
 #include <nano/secure/common.hpp>
 
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index_container.hpp>
+
 #include <atomic>
+#include <deque>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
@@ -31,11 +38,29 @@ private:
 	nano::mutex mutex;
 	void value_get (nano::raw_key &);
 };
+// Password key derivation, every derivation holds a large Argon2 memory block so the number running at once is bounded
 class kdf final
 {
 public:
+	explicit kdf (unsigned = 1);
 	void phs (nano::raw_key &, std::string const &, nano::uint256_union const &);
+	/**
+	 * Derives the empty password keys for \p salts_a concurrently, results are consumed by the next phs call for the same salt.
+	 * Only worth it ahead of an empty password attempt on each salt, such as the initial unlock of every wallet
+	 */
+	void precompute (std::vector<nano::uint256_union> const &);
+	/** Drops precomputed keys no phs call consumed */
+	void precomputed_clear ();
+	size_t precomputed_size ();
+	unsigned const concurrency;
 	nano::mutex mutex;
+
+private:
+	void derive (nano::raw_key &, std::string const &, nano::uint256_union const &);
+	nano::condition_variable condition;
+	unsigned active{ 0 };
+	// Keys derived from the empty password are not secret to anyone who can read the wallet salt
+	std::unordered_map<nano::uint256_union, nano::raw_key> precomputed;
 };
 enum class key_type
 {
@@ -115,6 +140,35 @@ public:
 private:
 	MDB_txn * tx (nano::transaction const &) const;
 };
+/** A confirmed pending entry which can be received by a wallet account */
+class receivable final
+{
+public:
+	nano::block_hash hash;
+	nano::account account;
+	nano::uint128_t amount;
+};
+/**
+ * Batched pending lookup for a set of wallet accounts.
+ * Accounts are visited in key order inside a single read transaction so the pending table is walked front to back,
+ * large account sets are instead matched against per-shard parallel scans of the whole pending table.
+ */
+class pending_search final
+{
+public:
+	explicit pending_search (nano::node &);
+	/** Returns confirmed receivables for \p accounts_a and requests confirmation for unconfirmed ones. \p accounts_a must be sorted */
+	std::vector<nano::receivable> find (std::vector<nano::account> const & accounts_a);
+	/** Account count from which the whole pending table is scanned in parallel rather than seeking to each account */
+	static size_t constexpr parallel_scan_threshold{ 64 * 1024 };
+	/** Maximum number of receives from a single search queued as wallet actions at the same time */
+	static size_t constexpr max_queued_receives{ 256 };
+
+private:
+	void scan_sorted (nano::read_transaction const &, std::vector<nano::account> const &, std::vector<std::pair<nano::pending_key, nano::pending_info>> &);
+	void scan_parallel (std::vector<nano::account> const &, std::vector<std::pair<nano::pending_key, nano::pending_info>> &);
+	nano::node & node;
+};
 // A wallet is a set of account keys encrypted by a common encryption key
 class wallet final : public std::enable_shared_from_this<nano::wallet>
 {
@@ -122,7 +176,8 @@ public:
 	std::shared_ptr<nano::block> change_action (nano::account const &, nano::account const &, uint64_t = 0, bool = true);
 	std::shared_ptr<nano::block> receive_action (nano::block_hash const &, nano::account const &, nano::uint128_union const &, nano::account const &, uint64_t = 0, bool = true);
 	std::shared_ptr<nano::block> send_action (nano::account const &, nano::account const &, nano::uint128_t const &, uint64_t = 0, bool = true, boost::optional<std::string> = {});
-	bool action_complete (std::shared_ptr<nano::block> const &, nano::account const &, bool const, nano::block_details const &);
+	/** \p cached_work_a is true if the work of \p block_a was taken from the wallet's work cache rather than provided by the caller */
+	bool action_complete (std::shared_ptr<nano::block> const &, nano::account const &, bool const, nano::block_details const &, bool const cached_work_a);
 	wallet (bool &, nano::transaction &, nano::wallets &, std::string const &);
 	wallet (bool &, nano::transaction &, nano::wallets &, std::string const &, std::string const &);
 	void enter_initial_password ();
@@ -146,6 +201,8 @@ public:
 	// Schedule work generation after a few seconds
 	void work_ensure (nano::account const &, nano::root const &);
 	bool search_pending (nano::transaction const &);
+	/** Receives \p receivables_a keeping at most pending_search::max_queued_receives of them in the wallet action queue */
+	void receive_pending (std::deque<nano::receivable> receivables_a, nano::account const & representative_a);
 	void init_free_accounts (nano::transaction const &);
 	uint32_t deterministic_check (nano::transaction const & transaction_a, uint32_t index);
 	/** Changes the wallet seed and returns the first account */
@@ -159,6 +216,11 @@ public:
 	nano::wallets & wallets;
 	nano::mutex representatives_mutex;
 	std::unordered_set<nano::account> representatives;
+	/** Number of actions for this wallet waiting in the wallets action queue */
+	std::atomic<uint64_t> queued_actions{ 0 };
+
+private:
+	void receive_next (std::shared_ptr<nano::locked<std::deque<nano::receivable>>> const &, nano::account const &);
 };
 
 class work_watcher final : public std::enable_shared_from_this<nano::work_watcher>
@@ -173,6 +235,7 @@ public:
 	void update (nano::qualified_root const &, std::shared_ptr<nano::state_block> const &);
 	void watching (nano::qualified_root const &, std::shared_ptr<nano::state_block> const &);
 	void remove (nano::block const &);
+	/** Safe to call concurrently, does not lock while nothing is watched */
 	bool is_watched (nano::qualified_root const &);
 	decltype (watched) list_watched ();
 	size_t size ();
@@ -181,6 +244,59 @@ private:
 	nano::mutex mutex;
 	nano::node & node;
 	std::atomic<bool> stopped;
+	/** Mirrors watched.size (), updated under the mutex */
+	std::atomic<size_t> watched_size{ 0 };
+};
+
+/**
+ * Generates work for the next block of wallet accounts in the background so sends and receives find it already cached.
+ * Most recently active accounts are served first and generation only starts while the local work pool has no other requests queued.
+ */
+class work_precache final : public std::enable_shared_from_this<nano::work_precache>
+{
+public:
+	work_precache (nano::node &);
+	~work_precache ();
+	void stop ();
+	/** Schedules work generation for \p root_a, replacing any root already scheduled for \p account_a */
+	void add (std::shared_ptr<nano::wallet> const &, nano::account const &, nano::root const &);
+	void remove (nano::account const &);
+	bool exists (nano::account const &);
+	size_t size ();
+	static unsigned constexpr max_in_flight{ 2 };
+
+private:
+	void run ();
+	void generate (std::shared_ptr<nano::wallet> const &, nano::account const &, nano::root const &);
+	class entry final
+	{
+	public:
+		nano::account account;
+		nano::root root;
+		std::weak_ptr<nano::wallet> wallet;
+		std::chrono::steady_clock::time_point activity;
+	};
+	class tag_account
+	{
+	};
+	class tag_activity
+	{
+	};
+	// clang-format off
+	boost::multi_index_container<entry,
+	boost::multi_index::indexed_by<
+		boost::multi_index::hashed_unique<boost::multi_index::tag<tag_account>,
+			boost::multi_index::member<entry, nano::account, &entry::account>>,
+		boost::multi_index::ordered_non_unique<boost::multi_index::tag<tag_activity>,
+			boost::multi_index::member<entry, std::chrono::steady_clock::time_point, &entry::activity>, std::greater<std::chrono::steady_clock::time_point>>>>
+	entries;
+	// clang-format on
+	nano::node & node;
+	nano::mutex mutex;
+	nano::condition_variable condition;
+	unsigned in_flight{ 0 };
+	bool stopped{ false };
+	std::thread thread;
 };
 
 class wallet_representatives
@@ -221,7 +337,9 @@ public:
 	void destroy (nano::wallet_id const &);
 	void reload ();
 	void do_wallet_actions ();
-	void queue_wallet_action (nano::uint128_t const &, std::shared_ptr<nano::wallet> const &, std::function<void(nano::wallet &)>);
+	/** Queues \p action_a by priority \p amount_a, actions queued for the same \p account_a are never executed concurrently */
+	void queue_wallet_action (nano::uint128_t const &, std::shared_ptr<nano::wallet> const &, std::function<void(nano::wallet &)>, nano::account const & = nano::account{});
+	size_t actions_size ();
 	void foreach_representative (std::function<void(nano::public_key const &, nano::raw_key const &)> const &);
 	bool exists (nano::transaction const &, nano::account const &);
 	void stop ();
@@ -234,9 +352,12 @@ public:
 	void move_table (std::string const &, MDB_txn *, MDB_txn *);
 	std::unordered_map<nano::wallet_id, std::shared_ptr<nano::wallet>> get_wallets ();
 	nano::network_params network_params;
+	/** Called with action_mutex held when the first action starts and the last one completes, must not queue wallet actions */
 	std::function<void(bool)> observer;
 	std::unordered_map<nano::wallet_id, std::shared_ptr<nano::wallet>> items;
-	std::multimap<nano::uint128_t, std::pair<std::shared_ptr<nano::wallet>, std::function<void(nano::wallet &)>>, std::greater<nano::uint128_t>> actions;
+	using action_queue = std::multimap<nano::uint128_t, std::pair<std::shared_ptr<nano::wallet>, std::function<void(nano::wallet &)>>, std::greater<nano::uint128_t>>;
+	/** Queued actions per account, executed in priority order */
+	std::unordered_map<nano::account, action_queue> actions;
 	nano::locked<std::unordered_map<nano::account, nano::root>> delayed_work;
 	nano::mutex mutex;
 	nano::mutex action_mutex;
@@ -248,8 +369,8 @@ public:
 	nano::mdb_env & env;
 	std::atomic<bool> stopped;
 	std::shared_ptr<nano::work_watcher> watcher;
-	std::thread thread;
-	static nano::uint128_t const generate_priority;
+	std::shared_ptr<nano::work_precache> precache;
+	std::vector<std::thread> threads;
 	static nano::uint128_t const high_priority;
 	/** Start read-write transaction */
 	nano::write_transaction tx_begin_write ();
@@ -258,6 +379,36 @@ public:
 	nano::read_transaction tx_begin_read ();
 
 private:
+	/** Account with queued actions and no action in progress */
+	class ready_account final
+	{
+	public:
+		nano::account account;
+		nano::uint128_t priority;
+		uint64_t arrival;
+		/** Highest priority first, earliest arrival between equal priorities */
+		bool operator< (ready_account const & other_a) const
+		{
+			return priority > other_a.priority || (priority == other_a.priority && arrival < other_a.arrival);
+		}
+	};
+	// clang-format off
+	class tag_account {};
+	class tag_priority {};
+	boost::multi_index_container<ready_account,
+	boost::multi_index::indexed_by<
+		boost::multi_index::hashed_unique<boost::multi_index::tag<tag_account>,
+			boost::multi_index::member<ready_account, nano::account, &ready_account::account>>,
+		boost::multi_index::ordered_unique<boost::multi_index::tag<tag_priority>,
+			boost::multi_index::identity<ready_account>>>>
+	ready_accounts;
+	// clang-format on
+	/** Accounts with an action currently executing */
+	std::unordered_set<nano::account> busy_accounts;
+	uint64_t arrival{ 0 };
+	/** Number of threads currently executing an action */
+	unsigned executing{ 0 };
+	void ready_account_put (nano::account const &, nano::uint128_t const &);
 	mutable nano::mutex reps_cache_mutex;
 	nano::wallet_representatives representatives;
 };
@@ -15,6 +15,7 @@ enum class writer
 	confirmation_height,
 	process_batch,
 	pruning,
+	bootstrap,
 	testing // Used in tests to emulate a write lock
 };
 
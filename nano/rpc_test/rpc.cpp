@@ -4337,6 +4337,8 @@ TEST (rpc, wallet_info)
 	ASSERT_EQ ("1", deterministic_count);
 	std::string index_text (response.json.get<std::string> ("deterministic_index"));
 	ASSERT_EQ ("2", index_text);
+	std::string queued_actions_text (response.json.get<std::string> ("queued_actions"));
+	ASSERT_EQ ("0", queued_actions_text);
 }
 
 TEST (rpc, wallet_balances)
@@ -6752,6 +6754,37 @@ TEST (rpc, uptime)
 	ASSERT_LE (1, response.json.get<int> ("seconds"));
 }
 
+TEST (rpc, startup_profile)
+{
+	nano::system system;
+	auto node = add_ipc_enabled_node (system);
+	scoped_io_thread_name_change scoped_thread_name_io;
+	nano::node_rpc_config node_rpc_config;
+	nano::ipc::ipc_server ipc_server (*node, node_rpc_config);
+	nano::rpc_config rpc_config (nano::get_available_port (), true);
+	rpc_config.rpc_process.ipc_port = node->config.ipc_config.transport_tcp.port;
+	nano::ipc_rpc_processor ipc_rpc_processor (system.io_ctx, rpc_config);
+	nano::rpc rpc (system.io_ctx, rpc_config, ipc_rpc_processor);
+	rpc.start ();
+	boost::property_tree::ptree request;
+	request.put ("action", "startup_profile");
+	test_response response (request, rpc.config.port, system.io_ctx);
+	ASSERT_TIMELY (5s, response.status != 0);
+	ASSERT_EQ (200, response.status);
+	ASSERT_TRUE (response.json.get<bool> ("completed"));
+	std::vector<std::string> names;
+	for (auto & phase : response.json.get_child ("phases"))
+	{
+		names.push_back (phase.second.get<std::string> ("name"));
+		ASSERT_LE (0, phase.second.get<int64_t> ("wall_us"));
+	}
+	ASSERT_NE (names.end (), std::find (names.begin (), names.end (), "store open"));
+	ASSERT_NE (names.end (), std::find (names.begin (), names.end (), "ledger initialize"));
+	ASSERT_NE (names.end (), std::find (names.begin (), names.end (), "wallets load"));
+	ASSERT_NE (names.end (), std::find (names.begin (), names.end (), "network start"));
+	ASSERT_LE (0, response.json.get<int64_t> ("wall_us"));
+}
+
 TEST (rpc, wallet_history)
 {
 	nano::system system;
@@ -0,0 +1,138 @@
+#include <nano/secure/account_info_cache.hpp>
+
+#include <algorithm>
+
+nano::account_info_cache::account_info_cache (size_t memory_budget_a) :
+slots_per_shard (memory_budget_a / sizeof (entry) / shard_count)
+{
+	for (auto & shard : shards)
+	{
+		shard.entries.resize (slots_per_shard);
+	}
+}
+
+nano::account_info_cache::shard & nano::account_info_cache::shard_of (nano::account const & account_a)
+{
+	// Accounts are public keys so their bits are uniformly distributed
+	return shards[account_a.qwords[0] % shard_count];
+}
+
+size_t nano::account_info_cache::start_of (nano::account const & account_a) const
+{
+	debug_assert (slots_per_shard > 0);
+	return (account_a.qwords[0] / shard_count) % slots_per_shard;
+}
+
+bool nano::account_info_cache::get (uint64_t snapshot_a, nano::account const & account_a, nano::account_info & info_a)
+{
+	auto result (true);
+	if (slots_per_shard > 0 && !account_a.is_zero ())
+	{
+		auto & shard (shard_of (account_a));
+		auto const start (start_of (account_a));
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		for (size_t i (0), n (std::min (probe_length, slots_per_shard)); i < n && result; ++i)
+		{
+			auto const & slot (shard.entries[(start + i) % slots_per_shard]);
+			if (slot.account == account_a && slot.snapshot <= snapshot_a)
+			{
+				info_a = slot.info;
+				result = false;
+			}
+		}
+	}
+	return result;
+}
+
+void nano::account_info_cache::fill (uint64_t snapshot_a, nano::account const & account_a, nano::account_info const & info_a)
+{
+	if (slots_per_shard > 0 && !account_a.is_zero ())
+	{
+		auto & shard (shard_of (account_a));
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		// Writers publish last_write before taking the shard mutex, a write racing with this fill either shows here or replaces the entry afterwards
+		if (last_write <= snapshot_a)
+		{
+			place (shard, account_a, info_a, snapshot_a);
+		}
+	}
+}
+
+void nano::account_info_cache::put (uint64_t snapshot_a, nano::account const & account_a, nano::account_info const & info_a)
+{
+	if (slots_per_shard > 0 && !account_a.is_zero ())
+	{
+		last_write = std::max (last_write.load (), snapshot_a);
+		auto & shard (shard_of (account_a));
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		place (shard, account_a, info_a, snapshot_a);
+	}
+}
+
+void nano::account_info_cache::erase (uint64_t snapshot_a, nano::account const & account_a)
+{
+	if (slots_per_shard > 0 && !account_a.is_zero ())
+	{
+		last_write = std::max (last_write.load (), snapshot_a);
+		auto & shard (shard_of (account_a));
+		auto const start (start_of (account_a));
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		for (size_t i (0), n (std::min (probe_length, slots_per_shard)); i < n; ++i)
+		{
+			auto & slot (shard.entries[(start + i) % slots_per_shard]);
+			if (slot.account == account_a)
+			{
+				slot = {};
+			}
+		}
+	}
+}
+
+void nano::account_info_cache::place (shard & shard_a, nano::account const & account_a, nano::account_info const & info_a, uint64_t snapshot_a)
+{
+	// Reuse the slot already holding the account, otherwise an empty one, otherwise evict the entry from the oldest snapshot
+	auto const start (start_of (account_a));
+	entry * target (nullptr);
+	for (size_t i (0), n (std::min (probe_length, slots_per_shard)); i < n; ++i)
+	{
+		auto & slot (shard_a.entries[(start + i) % slots_per_shard]);
+		if (slot.account == account_a)
+		{
+			target = &slot;
+			break;
+		}
+		if (target == nullptr || (!target->account.is_zero () && (slot.account.is_zero () || slot.snapshot < target->snapshot)))
+		{
+			target = &slot;
+		}
+	}
+	debug_assert (target != nullptr);
+	// Never replace an entry with one valid from an older snapshot
+	if (target->account != account_a || target->snapshot <= snapshot_a)
+	{
+		*target = entry{ account_a, info_a, snapshot_a };
+	}
+}
+
+size_t nano::account_info_cache::capacity () const
+{
+	return slots_per_shard * shard_count;
+}
+
+size_t nano::account_info_cache::size ()
+{
+	size_t result (0);
+	for (auto & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard (shard.mutex);
+		result += std::count_if (shard.entries.begin (), shard.entries.end (), [](entry const & entry_a) { return !entry_a.account.is_zero (); });
+	}
+	return result;
+}
+
+std::unique_ptr<nano::container_info_component> nano::collect_container_info (account_info_cache & account_info_cache, std::string const & name)
+{
+	auto composite = std::make_unique<container_info_composite> (name);
+	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "entries", account_info_cache.size (), sizeof (nano::account_info_cache::entry) }));
+	return composite;
+}
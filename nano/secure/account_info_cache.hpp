@@ -0,0 +1,69 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/secure/common.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Memory budgeted write-through cache of account_info, keyed by account and placed by open addressing with a short
+ * linear probe inside one of several mutex guarded shards.
+ * Every entry is stamped with the store snapshot it was valid from (see block_store::snapshot_id) and is only served to
+ * transactions reading that snapshot or a later one, so readers never observe writes they could not see in the store.
+ * Writers must report every change through put () and erase (), the cache does not observe direct store writes.
+ * A budget smaller than one entry per shard disables the cache.
+ */
+class account_info_cache final
+{
+public:
+	explicit account_info_cache (size_t memory_budget_a);
+	/** Fills \p info_a if \p account_a is cached for \p snapshot_a, returns true if it is not */
+	bool get (uint64_t snapshot_a, nano::account const & account_a, nano::account_info & info_a);
+	/** Caches \p info_a as read from the store under \p snapshot_a, ignored if the account may have been written after it */
+	void fill (uint64_t snapshot_a, nano::account const & account_a, nano::account_info const & info_a);
+	/** Records \p info_a written under the write snapshot \p snapshot_a */
+	void put (uint64_t snapshot_a, nano::account const & account_a, nano::account_info const & info_a);
+	/** Records the deletion of \p account_a under the write snapshot \p snapshot_a */
+	void erase (uint64_t snapshot_a, nano::account const & account_a);
+	size_t capacity () const;
+	size_t size ();
+
+	static size_t constexpr shard_count = 16;
+	static size_t constexpr probe_length = 4;
+
+private:
+	class entry final
+	{
+	public:
+		// Empty slots have a zero account, which is never opened
+		nano::account account{ 0 };
+		nano::account_info info;
+		uint64_t snapshot{ 0 };
+	};
+	class shard final
+	{
+	public:
+		nano::mutex mutex;
+		std::vector<entry> entries;
+	};
+	shard & shard_of (nano::account const &);
+	size_t start_of (nano::account const &) const;
+	void place (shard &, nano::account const &, nano::account_info const &, uint64_t);
+	std::array<shard, shard_count> shards;
+	size_t const slots_per_shard;
+	/** Snapshot of the last write, fills from older snapshots could undo it */
+	std::atomic<uint64_t> last_write{ 0 };
+
+	friend std::unique_ptr<container_info_component> collect_container_info (account_info_cache &, std::string const &);
+};
+
+std::unique_ptr<container_info_component> collect_container_info (account_info_cache &, std::string const &);
+}
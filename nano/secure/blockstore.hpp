@@ -119,6 +119,12 @@ public:
 		static_assert (std::is_standard_layout<nano::unchecked_key>::value, "Standard layout is required");
 	}
 
+	db_val (nano::unchecked_expiry_key const & val_a) :
+	db_val (sizeof (val_a), const_cast<nano::unchecked_expiry_key *> (&val_a))
+	{
+		static_assert (std::is_standard_layout<nano::unchecked_expiry_key>::value, "Standard layout is required");
+	}
+
 	db_val (nano::confirmation_height_info const & val_a) :
 	buffer (std::make_shared<std::vector<uint8_t>> ())
 	{
@@ -241,6 +247,15 @@ public:
 		return result;
 	}
 
+	explicit operator nano::unchecked_expiry_key () const
+	{
+		nano::unchecked_expiry_key result;
+		debug_assert (size () == sizeof (result));
+		static_assert (sizeof (nano::unchecked_expiry_key::modified_big_endian) + sizeof (nano::unchecked_expiry_key::key) == sizeof (result), "Packed class");
+		std::copy (reinterpret_cast<uint8_t const *> (data ()), reinterpret_cast<uint8_t const *> (data ()) + sizeof (result), reinterpret_cast<uint8_t *> (&result));
+		return result;
+	}
+
 	explicit operator nano::uint128_union () const
 	{
 		return convert<nano::uint128_union> ();
@@ -544,6 +559,7 @@ enum class tables
 	pending,
 	pruned,
 	unchecked,
+	unchecked_expiry,
 	vote
 };
 
@@ -613,6 +629,27 @@ private:
 
 class ledger_cache;
 
+/**
+ * Loads records of one table in to a store, used when a store is filled from another one.
+ * Records must be put in ascending key order and the key ranges of loaders of the same table must not overlap.
+ * Records may not be visible before commit () is called.
+ */
+class bulk_loader
+{
+public:
+	virtual ~bulk_loader () = default;
+	virtual void put (nano::account const &, nano::account_info const &) = 0;
+	/** Puts a block serialized with its sideband */
+	virtual void put (nano::block_hash const &, std::vector<uint8_t> const &) = 0;
+	virtual void put (nano::block_hash const &, nano::account const &) = 0;
+	virtual void put (nano::pending_key const &, nano::pending_info const &) = 0;
+	virtual void put (nano::account const &, nano::confirmation_height_info const &) = 0;
+	virtual void put (nano::block_hash const &) = 0;
+	/** Makes the records put visible, returns true on error */
+	virtual bool commit () = 0;
+	uint64_t count{ 0 };
+};
+
 /**
  * Manages block storage and iteration
  */
@@ -625,6 +662,8 @@ public:
 	virtual void block_raw_put (nano::write_transaction const &, std::vector<uint8_t> const &, nano::block_hash const &) = 0;
 	virtual nano::block_hash block_successor (nano::transaction const &, nano::block_hash const &) const = 0;
 	virtual void block_successor_clear (nano::write_transaction const &, nano::block_hash const &) = 0;
+	/** Reads the previous hash and sideband timestamp straight from the stored bytes without deserializing the block, returns true if the block does not exist */
+	virtual bool block_previous_timestamp_get (nano::transaction const &, nano::block_hash const &, nano::block_hash &, uint64_t &) const = 0;
 	virtual std::shared_ptr<nano::block> block_get (nano::transaction const &, nano::block_hash const &) const = 0;
 	virtual std::shared_ptr<nano::block> block_get_no_sideband (nano::transaction const &, nano::block_hash const &) const = 0;
 	virtual std::shared_ptr<nano::block> block_random (nano::transaction const &) = 0;
@@ -677,6 +716,15 @@ public:
 	virtual nano::store_iterator<nano::unchecked_key, nano::unchecked_info> unchecked_begin (nano::transaction const &, nano::unchecked_key const &) const = 0;
 	virtual nano::store_iterator<nano::unchecked_key, nano::unchecked_info> unchecked_end () const = 0;
 	virtual size_t unchecked_count (nano::transaction const &) = 0;
+	/**
+	 * Removes up to \p max_a expiry index entries older than \p cutoff_a seconds since epoch, deleting the unchecked entries they still refer to into \p expired_a
+	 * @return Number of expiry index entries removed
+	 */
+	virtual size_t unchecked_expire (nano::write_transaction const &, uint64_t cutoff_a, size_t max_a, std::vector<nano::unchecked_info> & expired_a) = 0;
+	/** Adds every unchecked entry to the expiry index */
+	virtual void unchecked_expiry_rebuild (nano::write_transaction const &) = 0;
+	virtual nano::store_iterator<nano::unchecked_expiry_key, nano::no_value> unchecked_expiry_begin (nano::transaction const &) const = 0;
+	virtual nano::store_iterator<nano::unchecked_expiry_key, nano::no_value> unchecked_expiry_end () const = 0;
 
 	virtual void online_weight_put (nano::write_transaction const &, uint64_t, nano::amount const &) = 0;
 	virtual void online_weight_del (nano::write_transaction const &, uint64_t) = 0;
@@ -688,6 +736,22 @@ public:
 	virtual void version_put (nano::write_transaction const &, int) = 0;
 	virtual int version_get (nano::transaction const &) const = 0;
 
+	/** First account of the next ledger pruning window, zero when no pass is in progress */
+	virtual void pruning_progress_put (nano::write_transaction const &, nano::account const &) = 0;
+	virtual nano::account pruning_progress_get (nano::transaction const &) const = 0;
+
+	/** Last account compared by an ascending bootstrap in the given account range */
+	virtual void bootstrap_progress_put (nano::write_transaction const &, uint32_t, nano::account const &) = 0;
+	/** Returns true if the range has no progress recorded */
+	virtual bool bootstrap_progress_get (nano::transaction const &, uint32_t, nano::account &) const = 0;
+	virtual void bootstrap_progress_del (nano::write_transaction const &, uint32_t) = 0;
+
+	/** Serialized ledger cache, see ledger::checkpoint_write */
+	virtual void ledger_checkpoint_put (nano::write_transaction const &, std::vector<uint8_t> const &) = 0;
+	/** Returns true if no checkpoint is stored */
+	virtual bool ledger_checkpoint_get (nano::transaction const &, std::vector<uint8_t> &) const = 0;
+	virtual void ledger_checkpoint_del (nano::write_transaction const &) = 0;
+
 	virtual void pruned_put (nano::write_transaction const & transaction_a, nano::block_hash const & hash_a) = 0;
 	virtual void pruned_del (nano::write_transaction const & transaction_a, nano::block_hash const & hash_a) = 0;
 	virtual bool pruned_exists (nano::transaction const & transaction_a, nano::block_hash const & hash_a) const = 0;
@@ -740,8 +804,15 @@ public:
 	virtual nano::store_iterator<nano::qualified_root, nano::block_hash> final_vote_end () const = 0;
 
 	virtual unsigned max_block_write_batch_num () const = 0;
+	/**
+	 * Identifies the committed state a transaction reads, later commits get higher ids and a write transaction has the id its commit will get
+	 * @return true if the backend cannot tell
+	 */
+	virtual bool snapshot_id (nano::transaction const &, uint64_t &) const = 0;
 
 	virtual bool copy_db (boost::filesystem::path const & destination) = 0;
+	/** Returns a loader of \p table_a, which is one of the accounts, blocks, frontiers, pending, confirmation_height or pruned tables */
+	virtual std::unique_ptr<nano::bulk_loader> make_bulk_loader (nano::tables table_a) = 0;
 	virtual void rebuild_db (nano::write_transaction const & transaction_a) = 0;
 
 	/** Not applicable to all sub-classes */
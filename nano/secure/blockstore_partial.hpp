@@ -26,6 +26,8 @@ namespace nano
 {
 template <typename Val, typename Derived_Store>
 class block_predecessor_set;
+template <typename Val, typename Derived_Store>
+class transaction_bulk_loader;
 
 /** This base class implements the block_store interface functions which have DB agnostic functionality */
 template <typename Val, typename Derived_Store>
@@ -203,11 +205,45 @@ public:
 		block_raw_put (transaction_a, data, hash_a);
 	}
 
+	bool block_previous_timestamp_get (nano::transaction const & transaction_a, nano::block_hash const & hash_a, nano::block_hash & previous_a, uint64_t & timestamp_a) const override
+	{
+		auto value (block_raw_get (transaction_a, hash_a));
+		bool result (value.size () == 0);
+		if (!result)
+		{
+			auto type = block_type_from_raw (value.data ());
+			auto data (reinterpret_cast<uint8_t const *> (value.data ()));
+			// The previous hash is the first field of the block body, except for state blocks where it follows the account. Open blocks have none
+			previous_a.clear ();
+			if (type != nano::block_type::open)
+			{
+				auto previous_offset (1 + (type == nano::block_type::state ? sizeof (nano::account) : 0));
+				nano::bufferstream previous_stream (data + previous_offset, previous_a.bytes.size ());
+				auto error (nano::try_read (previous_stream, previous_a.bytes));
+				(void)error;
+				debug_assert (!error);
+			}
+			// The timestamp ends the sideband, only state blocks append details and the source epoch
+			auto timestamp_offset (value.size () - sizeof (timestamp_a) - (type == nano::block_type::state ? nano::block_details::size () + sizeof (nano::epoch) : 0));
+			nano::bufferstream timestamp_stream (data + timestamp_offset, sizeof (timestamp_a));
+			auto error (nano::try_read (timestamp_stream, timestamp_a));
+			(void)error;
+			debug_assert (!error);
+			boost::endian::big_to_native_inplace (timestamp_a);
+		}
+		return result;
+	}
+
 	nano::store_iterator<nano::unchecked_key, nano::unchecked_info> unchecked_end () const override
 	{
 		return nano::store_iterator<nano::unchecked_key, nano::unchecked_info> (nullptr);
 	}
 
+	nano::store_iterator<nano::unchecked_expiry_key, nano::no_value> unchecked_expiry_end () const override
+	{
+		return nano::store_iterator<nano::unchecked_expiry_key, nano::no_value> (nullptr);
+	}
+
 	nano::store_iterator<nano::endpoint_key, nano::no_value> peers_end () const override
 	{
 		return nano::store_iterator<nano::endpoint_key, nano::no_value> (nullptr);
@@ -268,6 +304,82 @@ public:
 		return result;
 	}
 
+	void pruning_progress_put (nano::write_transaction const & transaction_a, nano::account const & account_a) override
+	{
+		nano::uint256_union progress_key (2);
+		auto status (put (transaction_a, tables::meta, nano::db_val<Val> (progress_key), nano::db_val<Val> (account_a)));
+		release_assert_success (status);
+	}
+
+	nano::account pruning_progress_get (nano::transaction const & transaction_a) const override
+	{
+		nano::uint256_union progress_key (2);
+		nano::db_val<Val> data;
+		auto status (get (transaction_a, tables::meta, nano::db_val<Val> (progress_key), data));
+		release_assert (success (status) || not_found (status));
+		nano::account result (0);
+		if (success (status))
+		{
+			result = static_cast<nano::account> (data);
+		}
+		return result;
+	}
+
+	void bootstrap_progress_put (nano::write_transaction const & transaction_a, uint32_t range_a, nano::account const & account_a) override
+	{
+		auto status (put (transaction_a, tables::meta, nano::db_val<Val> (bootstrap_progress_key (range_a)), nano::db_val<Val> (account_a)));
+		release_assert_success (status);
+	}
+
+	bool bootstrap_progress_get (nano::transaction const & transaction_a, uint32_t range_a, nano::account & account_a) const override
+	{
+		nano::db_val<Val> data;
+		auto status (get (transaction_a, tables::meta, nano::db_val<Val> (bootstrap_progress_key (range_a)), data));
+		release_assert (success (status) || not_found (status));
+		auto result (true);
+		if (success (status))
+		{
+			account_a = static_cast<nano::account> (data);
+			result = false;
+		}
+		return result;
+	}
+
+	void bootstrap_progress_del (nano::write_transaction const & transaction_a, uint32_t range_a) override
+	{
+		auto status (del (transaction_a, tables::meta, nano::db_val<Val> (bootstrap_progress_key (range_a))));
+		release_assert (success (status) || not_found (status));
+	}
+
+	void ledger_checkpoint_put (nano::write_transaction const & transaction_a, std::vector<uint8_t> const & checkpoint_a) override
+	{
+		nano::uint256_union checkpoint_key (4);
+		auto status (put (transaction_a, tables::meta, nano::db_val<Val> (checkpoint_key), nano::db_val<Val> (checkpoint_a.size (), const_cast<uint8_t *> (checkpoint_a.data ()))));
+		release_assert_success (status);
+	}
+
+	bool ledger_checkpoint_get (nano::transaction const & transaction_a, std::vector<uint8_t> & checkpoint_a) const override
+	{
+		nano::uint256_union checkpoint_key (4);
+		nano::db_val<Val> data;
+		auto status (get (transaction_a, tables::meta, nano::db_val<Val> (checkpoint_key), data));
+		release_assert (success (status) || not_found (status));
+		auto result (true);
+		if (success (status))
+		{
+			checkpoint_a.assign (static_cast<uint8_t *> (data.data ()), static_cast<uint8_t *> (data.data ()) + data.size ());
+			result = false;
+		}
+		return result;
+	}
+
+	void ledger_checkpoint_del (nano::write_transaction const & transaction_a) override
+	{
+		nano::uint256_union checkpoint_key (4);
+		auto status (del (transaction_a, tables::meta, nano::db_val<Val> (checkpoint_key)));
+		release_assert (success (status) || not_found (status));
+	}
+
 	void block_del (nano::write_transaction const & transaction_a, nano::block_hash const & hash_a) override
 	{
 		auto status = del (transaction_a, tables::blocks, hash_a);
@@ -363,12 +475,62 @@ public:
 		nano::db_val<Val> info (info_a);
 		auto status (put (transaction_a, tables::unchecked, key_a, info));
 		release_assert_success (status);
+		status = put_key (transaction_a, tables::unchecked_expiry, nano::unchecked_expiry_key (info_a.modified, key_a));
+		release_assert_success (status);
 	}
 
 	void unchecked_del (nano::write_transaction const & transaction_a, nano::unchecked_key const & key_a) override
 	{
-		auto status (del (transaction_a, tables::unchecked, key_a));
-		release_assert_success (status);
+		// The expiry index entry is keyed by the modification time of the stored entry
+		nano::db_val<Val> value;
+		auto status (get (transaction_a, tables::unchecked, nano::db_val<Val> (key_a), value));
+		release_assert (success (status) || not_found (status));
+		if (success (status))
+		{
+			nano::unchecked_info info (value);
+			status = del (transaction_a, tables::unchecked_expiry, nano::unchecked_expiry_key (info.modified, key_a));
+			release_assert (success (status) || not_found (status));
+			status = del (transaction_a, tables::unchecked, key_a);
+			release_assert_success (status);
+		}
+	}
+
+	size_t unchecked_expire (nano::write_transaction const & transaction_a, uint64_t cutoff_a, size_t max_a, std::vector<nano::unchecked_info> & expired_a) override
+	{
+		std::vector<nano::unchecked_expiry_key> expired;
+		for (auto i (unchecked_expiry_begin (transaction_a)), n (unchecked_expiry_end ()); i != n && expired.size () < max_a && i->first.modified () < cutoff_a; ++i)
+		{
+			expired.push_back (i->first);
+		}
+		for (auto const & key : expired)
+		{
+			nano::db_val<Val> value;
+			auto status (get (transaction_a, tables::unchecked, nano::db_val<Val> (key.key), value));
+			release_assert (success (status) || not_found (status));
+			if (success (status))
+			{
+				nano::unchecked_info info (value);
+				// Entries stored again since have a newer index entry of their own
+				if (info.modified == key.modified ())
+				{
+					status = del (transaction_a, tables::unchecked, key.key);
+					release_assert_success (status);
+					expired_a.push_back (info);
+				}
+			}
+			status = del (transaction_a, tables::unchecked_expiry, key);
+			release_assert_success (status);
+		}
+		return expired.size ();
+	}
+
+	void unchecked_expiry_rebuild (nano::write_transaction const & transaction_a) override
+	{
+		for (auto i (unchecked_begin (transaction_a)), n (unchecked_end ()); i != n; ++i)
+		{
+			auto status (put_key (transaction_a, tables::unchecked_expiry, nano::unchecked_expiry_key (i->second.modified, i->first)));
+			release_assert_success (status);
+		}
 	}
 
 	bool unchecked_exists (nano::transaction const & transaction_a, nano::unchecked_key const & unchecked_key_a) override
@@ -390,6 +552,8 @@ public:
 	{
 		auto status = drop (transaction_a, tables::unchecked);
 		release_assert_success (status);
+		status = drop (transaction_a, tables::unchecked_expiry);
+		release_assert_success (status);
 	}
 
 	void account_put (nano::write_transaction const & transaction_a, nano::account const & account_a, nano::account_info const & info_a) override
@@ -716,6 +880,11 @@ public:
 		return make_iterator<nano::unchecked_key, nano::unchecked_info> (transaction_a, tables::unchecked, nano::db_val<Val> (key_a));
 	}
 
+	nano::store_iterator<nano::unchecked_expiry_key, nano::no_value> unchecked_expiry_begin (nano::transaction const & transaction_a) const override
+	{
+		return make_iterator<nano::unchecked_expiry_key, nano::no_value> (transaction_a, tables::unchecked_expiry);
+	}
+
 	nano::store_iterator<uint64_t, nano::amount> online_weight_begin (nano::transaction const & transaction_a) const override
 	{
 		return make_iterator<uint64_t, nano::amount> (transaction_a, tables::online_weight);
@@ -845,7 +1014,7 @@ public:
 
 protected:
 	nano::network_params network_params;
-	int const version{ 21 };
+	int const version{ 22 };
 
 	template <typename Key, typename Value>
 	nano::store_iterator<Key, Value> make_iterator (nano::transaction const & transaction_a, tables table_a) const
@@ -878,6 +1047,12 @@ protected:
 		return static_cast<nano::block_type> ((reinterpret_cast<uint8_t const *> (data_a))[0]);
 	}
 
+	/** Meta keys 1, 2 and 4 hold the version, the pruning progress and the ledger checkpoint, bootstrap ranges are keyed above them */
+	static nano::uint256_union bootstrap_progress_key (uint32_t range_a)
+	{
+		return nano::uint256_union ((nano::uint256_t (3) << 32) | range_a);
+	}
+
 	uint64_t count (nano::transaction const & transaction_a, std::initializer_list<tables> dbs_a) const
 	{
 		uint64_t total_count = 0;
@@ -909,6 +1084,11 @@ protected:
 		return static_cast<Derived_Store &> (*this).del (transaction_a, table_a, key_a);
 	}
 
+	std::unique_ptr<nano::bulk_loader> make_bulk_loader (nano::tables table_a) override
+	{
+		return std::make_unique<nano::transaction_bulk_loader<Val, Derived_Store>> (*this, table_a);
+	}
+
 	virtual uint64_t count (nano::transaction const & transaction_a, tables table_a) const = 0;
 	virtual int drop (nano::write_transaction const & transaction_a, tables table_a) = 0;
 	virtual bool not_found (int status) const = 0;
@@ -966,6 +1146,70 @@ public:
 	nano::write_transaction const & transaction;
 	nano::block_store_partial<Val, Derived_Store> & store;
 };
+
+/**
+ * Loads records through write transactions committed every batch_size records, for stores without a faster path
+ */
+template <typename Val, typename Derived_Store>
+class transaction_bulk_loader final : public nano::bulk_loader
+{
+public:
+	transaction_bulk_loader (nano::block_store_partial<Val, Derived_Store> & store_a, nano::tables table_a) :
+	store (store_a),
+	transaction (store_a.tx_begin_write ({}, { table_a }))
+	{
+	}
+	void put (nano::account const & account_a, nano::account_info const & info_a) override
+	{
+		store.account_put (transaction, account_a, info_a);
+		added ();
+	}
+	void put (nano::block_hash const & hash_a, std::vector<uint8_t> const & block_a) override
+	{
+		store.block_raw_put (transaction, block_a, hash_a);
+		added ();
+	}
+	void put (nano::block_hash const & hash_a, nano::account const & account_a) override
+	{
+		store.frontier_put (transaction, hash_a, account_a);
+		added ();
+	}
+	void put (nano::pending_key const & key_a, nano::pending_info const & info_a) override
+	{
+		store.pending_put (transaction, key_a, info_a);
+		added ();
+	}
+	void put (nano::account const & account_a, nano::confirmation_height_info const & info_a) override
+	{
+		store.confirmation_height_put (transaction, account_a, info_a);
+		added ();
+	}
+	void put (nano::block_hash const & hash_a) override
+	{
+		store.pruned_put (transaction, hash_a);
+		added ();
+	}
+	bool commit () override
+	{
+		transaction.commit ();
+		return false;
+	}
+
+	static uint64_t constexpr batch_size = 8 * 1024;
+
+private:
+	void added ()
+	{
+		if (++count % batch_size == 0)
+		{
+			// Lets loaders of other threads write in between
+			transaction.commit ();
+			transaction.renew ();
+		}
+	}
+	nano::block_store_partial<Val, Derived_Store> & store;
+	nano::write_transaction transaction;
+};
 }
 
 namespace
@@ -854,6 +854,22 @@ nano::block_hash const & nano::unchecked_key::key () const
 	return previous;
 }
 
+nano::unchecked_expiry_key::unchecked_expiry_key (uint64_t modified_a, nano::unchecked_key const & key_a) :
+modified_big_endian (boost::endian::native_to_big (modified_a)),
+key (key_a)
+{
+}
+
+bool nano::unchecked_expiry_key::operator== (nano::unchecked_expiry_key const & other_a) const
+{
+	return modified_big_endian == other_a.modified_big_endian && key == other_a.key;
+}
+
+uint64_t nano::unchecked_expiry_key::modified () const
+{
+	return boost::endian::big_to_native (modified_big_endian);
+}
+
 void nano::generate_cache::enable_all ()
 {
 	reps = true;
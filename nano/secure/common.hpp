@@ -179,6 +179,22 @@ public:
 	nano::block_hash hash{ 0 };
 };
 
+/**
+ * Key of the unchecked expiry index, ordered by the time the unchecked entry was stored
+ */
+class unchecked_expiry_key final
+{
+public:
+	unchecked_expiry_key () = default;
+	unchecked_expiry_key (uint64_t, nano::unchecked_key const &);
+	bool operator== (nano::unchecked_expiry_key const &) const;
+	/** Seconds since posix epoch */
+	uint64_t modified () const;
+	// Stored big endian so keys sort by time
+	uint64_t modified_big_endian{ 0 };
+	nano::unchecked_key key;
+};
+
 /**
  * Tag for block signature verification result
  */
@@ -1,5 +1,6 @@
 #include <nano/lib/rep_weights.hpp>
 #include <nano/lib/stats.hpp>
+#include <nano/lib/threading.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/lib/work.hpp>
 #include <nano/secure/blockstore.hpp>
@@ -8,6 +9,10 @@
 
 #include <crypto/cryptopp/words.h>
 
+#include <boost/format.hpp>
+
+#include <thread>
+
 namespace
 {
 /**
@@ -35,7 +40,7 @@ public:
 		if (!error)
 		{
 			nano::account_info info;
-			[[maybe_unused]] auto error (ledger.store.account_get (transaction, pending.source, info));
+			[[maybe_unused]] auto error (ledger.account_get (transaction, pending.source, info));
 			debug_assert (!error);
 			ledger.store.pending_del (transaction, key);
 			ledger.cache.rep_weights.representation_add (info.representative, pending.amount.number ());
@@ -57,7 +62,7 @@ public:
 		[[maybe_unused]] bool is_pruned (false);
 		auto source_account (ledger.account_safe (transaction, block_a.hashables.source, is_pruned));
 		nano::account_info info;
-		[[maybe_unused]] auto error (ledger.store.account_get (transaction, destination_account, info));
+		[[maybe_unused]] auto error (ledger.account_get (transaction, destination_account, info));
 		debug_assert (!error);
 		ledger.cache.rep_weights.representation_add (info.representative, 0 - amount);
 		nano::account_info new_info (block_a.hashables.previous, info.representative, info.open_block, ledger.balance (transaction, block_a.hashables.previous), nano::seconds_since_epoch (), info.block_count - 1, nano::epoch::epoch_0);
@@ -91,7 +96,7 @@ public:
 		auto rep_block (ledger.representative (transaction, block_a.hashables.previous));
 		auto account (ledger.account (transaction, block_a.hashables.previous));
 		nano::account_info info;
-		[[maybe_unused]] auto error (ledger.store.account_get (transaction, account, info));
+		[[maybe_unused]] auto error (ledger.account_get (transaction, account, info));
 		debug_assert (!error);
 		auto balance (ledger.balance (transaction, block_a.hashables.previous));
 		auto block = ledger.store.block_get (transaction, rep_block);
@@ -132,7 +137,7 @@ public:
 		}
 
 		nano::account_info info;
-		auto error (ledger.store.account_get (transaction, block_a.hashables.account, info));
+		auto error (ledger.account_get (transaction, block_a.hashables.account, info));
 
 		if (is_send)
 		{
@@ -286,7 +291,7 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 				nano::amount amount (block_a.hashables.balance);
 				auto is_send (false);
 				auto is_receive (false);
-				auto account_error (ledger.store.account_get (transaction, block_a.hashables.account, info));
+				auto account_error (ledger.account_get (transaction, block_a.hashables.account, info));
 				if (!account_error)
 				{
 					// Account already exists
@@ -408,7 +413,7 @@ void ledger_processor::epoch_block_impl (nano::state_block & block_a)
 			if (result.code == nano::process_result::progress)
 			{
 				nano::account_info info;
-				auto account_error (ledger.store.account_get (transaction, block_a.hashables.account, info));
+				auto account_error (ledger.account_get (transaction, block_a.hashables.account, info));
 				if (!account_error)
 				{
 					// Account already exists
@@ -486,7 +491,7 @@ void ledger_processor::change_block (nano::change_block & block_a)
 				if (result.code == nano::process_result::progress)
 				{
 					nano::account_info info;
-					auto latest_error (ledger.store.account_get (transaction, account, info));
+					auto latest_error (ledger.account_get (transaction, account, info));
 					(void)latest_error;
 					debug_assert (!latest_error);
 					debug_assert (info.head == block_a.hashables.previous);
@@ -553,7 +558,7 @@ void ledger_processor::send_block (nano::send_block & block_a)
 							debug_assert (!validate_message (account, hash, block_a.signature));
 							result.verified = nano::signature_verification::valid;
 							nano::account_info info;
-							auto latest_error (ledger.store.account_get (transaction, account, info));
+							auto latest_error (ledger.account_get (transaction, account, info));
 							(void)latest_error;
 							debug_assert (!latest_error);
 							debug_assert (info.head == block_a.hashables.previous);
@@ -611,7 +616,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 						if (result.code == nano::process_result::progress)
 						{
 							nano::account_info info;
-							ledger.store.account_get (transaction, account, info);
+							ledger.account_get (transaction, account, info);
 							result.code = info.head == block_a.hashables.previous ? nano::process_result::progress : nano::process_result::gap_previous; // Block doesn't immediately follow latest block (Harmless)
 							if (result.code == nano::process_result::progress)
 							{
@@ -632,7 +637,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 											if (ledger.store.block_exists (transaction, block_a.hashables.source))
 											{
 												nano::account_info source_info;
-												[[maybe_unused]] auto error (ledger.store.account_get (transaction, pending.source, source_info));
+												[[maybe_unused]] auto error (ledger.account_get (transaction, pending.source, source_info));
 												debug_assert (!error);
 											}
 #endif
@@ -682,7 +687,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 			if (result.code == nano::process_result::progress)
 			{
 				nano::account_info info;
-				result.code = ledger.store.account_get (transaction, block_a.hashables.account, info) ? nano::process_result::progress : nano::process_result::fork; // Has this account already been opened? (Malicious)
+				result.code = ledger.account_get (transaction, block_a.hashables.account, info) ? nano::process_result::progress : nano::process_result::fork; // Has this account already been opened? (Malicious)
 				if (result.code == nano::process_result::progress)
 				{
 					nano::pending_key key (block_a.hashables.account, block_a.hashables.source);
@@ -704,7 +709,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 									if (ledger.store.block_exists (transaction, block_a.hashables.source))
 									{
 										nano::account_info source_info;
-										[[maybe_unused]] auto error (ledger.store.account_get (transaction, pending.source, source_info));
+										[[maybe_unused]] auto error (ledger.account_get (transaction, pending.source, source_info));
 										debug_assert (!error);
 									}
 #endif
@@ -736,8 +741,11 @@ verification (verification_a)
 }
 } // namespace
 
-nano::ledger::ledger (nano::block_store & store_a, nano::stat & stat_a, nano::generate_cache const & generate_cache_a) :
+constexpr uint32_t nano::ledger::checkpoint_version;
+
+nano::ledger::ledger (nano::block_store & store_a, nano::stat & stat_a, nano::generate_cache const & generate_cache_a, size_t account_info_cache_size_a) :
 store (store_a),
+account_info_cache (account_info_cache_size_a),
 stats (stat_a),
 check_bootstrap_weights (true)
 {
@@ -749,41 +757,158 @@ check_bootstrap_weights (true)
 
 void nano::ledger::initialize (nano::generate_cache const & generate_cache_a)
 {
-	if (generate_cache_a.reps || generate_cache_a.account_count || generate_cache_a.block_count)
+	auto start (std::chrono::steady_clock::now ());
+	auto elapsed = [](std::chrono::steady_clock::time_point const & start_a) {
+		return std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - start_a);
+	};
+	auto any_l (generate_cache_a.reps || generate_cache_a.account_count || generate_cache_a.block_count || generate_cache_a.cemented_count);
+	if (any_l && !checkpoint_read ())
 	{
-		store.accounts_for_each_par (
-		[this](nano::read_transaction const & /*unused*/, nano::store_iterator<nano::account, nano::account_info> i, nano::store_iterator<nano::account, nano::account_info> n) {
-			uint64_t block_count_l{ 0 };
-			uint64_t account_count_l{ 0 };
-			decltype (this->cache.rep_weights) rep_weights_l;
-			for (; i != n; ++i)
+		cache_complete = true;
+		initialize_timings.emplace_back ("loaded from checkpoint", elapsed (start));
+	}
+	else
+	{
+		// Both traversals are I/O bound and run their own threads, confirmation heights are counted while accounts are walked
+		std::thread cemented_thread;
+		std::chrono::milliseconds cemented_time{ 0 };
+		if (generate_cache_a.cemented_count)
+		{
+			cemented_thread = std::thread ([this, &elapsed, &cemented_time]() {
+				nano::thread_role::set (nano::thread_role::name::db_parallel_traversal);
+				auto start_l (std::chrono::steady_clock::now ());
+				store.confirmation_height_for_each_par (
+				[this](nano::read_transaction const & /*unused*/, nano::store_iterator<nano::account, nano::confirmation_height_info> i, nano::store_iterator<nano::account, nano::confirmation_height_info> n) {
+					uint64_t cemented_count_l (0);
+					for (; i != n; ++i)
+					{
+						cemented_count_l += i->second.height;
+					}
+					this->cache.cemented_count += cemented_count_l;
+				});
+				cemented_time = elapsed (start_l);
+			});
+		}
+
+		if (generate_cache_a.reps || generate_cache_a.account_count || generate_cache_a.block_count)
+		{
+			auto start_l (std::chrono::steady_clock::now ());
+			store.accounts_for_each_par (
+			[this](nano::read_transaction const & /*unused*/, nano::store_iterator<nano::account, nano::account_info> i, nano::store_iterator<nano::account, nano::account_info> n) {
+				uint64_t block_count_l{ 0 };
+				uint64_t account_count_l{ 0 };
+				decltype (this->cache.rep_weights) rep_weights_l;
+				for (; i != n; ++i)
+				{
+					nano::account_info const & info (i->second);
+					block_count_l += info.block_count;
+					++account_count_l;
+					rep_weights_l.representation_add (info.representative, info.balance.number ());
+				}
+				// Each thread merges its partial weights once, the shared weights are not locked per account
+				this->cache.block_count += block_count_l;
+				this->cache.account_count += account_count_l;
+				this->cache.rep_weights.copy_from (rep_weights_l);
+			});
+			initialize_timings.emplace_back ("accounts walk", elapsed (start_l));
+		}
+
+		if (cemented_thread.joinable ())
+		{
+			cemented_thread.join ();
+			initialize_timings.emplace_back ("confirmation height walk", cemented_time);
+		}
+
+		auto start_l (std::chrono::steady_clock::now ());
+		auto transaction (store.tx_begin_read ());
+		cache.pruned_count = store.pruned_count (transaction);
+		initialize_timings.emplace_back ("pruned count", elapsed (start_l));
+		cache_complete = generate_cache_a.reps && generate_cache_a.account_count && generate_cache_a.block_count && generate_cache_a.cemented_count;
+	}
+}
+
+bool nano::ledger::checkpoint_read ()
+{
+	auto transaction (store.tx_begin_read ());
+	uint64_t snapshot_id (0);
+	std::vector<uint8_t> checkpoint;
+	auto result (store.snapshot_id (transaction, snapshot_id) || store.ledger_checkpoint_get (transaction, checkpoint));
+	if (!result)
+	{
+		nano::bufferstream stream (checkpoint.data (), checkpoint.size ());
+		uint32_t version_l;
+		int32_t store_version_l;
+		uint64_t snapshot_id_l;
+		uint64_t block_count_l;
+		uint64_t account_count_l;
+		uint64_t cemented_count_l;
+		uint64_t pruned_count_l;
+		uint64_t rep_count_l;
+		result = nano::try_read (stream, version_l) || nano::try_read (stream, store_version_l) || nano::try_read (stream, snapshot_id_l) || nano::try_read (stream, block_count_l) || nano::try_read (stream, account_count_l) || nano::try_read (stream, cemented_count_l) || nano::try_read (stream, pruned_count_l) || nano::try_read (stream, rep_count_l);
+		// The checkpoint is only valid for the commit which wrote it, any later commit may have changed the ledger
+		result = result || version_l != checkpoint_version || store_version_l != store.version_get (transaction) || snapshot_id_l != snapshot_id;
+		std::vector<std::pair<nano::account, nano::amount>> weights;
+		for (uint64_t i (0); i < rep_count_l && !result; ++i)
+		{
+			nano::account representative;
+			nano::amount weight;
+			result = nano::try_read (stream, representative.bytes) || nano::try_read (stream, weight.bytes);
+			weights.emplace_back (representative, weight);
+		}
+		if (!result)
+		{
+			for (auto const & weight : weights)
 			{
-				nano::account_info const & info (i->second);
-				block_count_l += info.block_count;
-				++account_count_l;
-				rep_weights_l.representation_add (info.representative, info.balance.number ());
+				cache.rep_weights.representation_put (weight.first, weight.second);
 			}
-			this->cache.block_count += block_count_l;
-			this->cache.account_count += account_count_l;
-			this->cache.rep_weights.copy_from (rep_weights_l);
-		});
+			cache.block_count = block_count_l;
+			cache.account_count = account_count_l;
+			cache.cemented_count = cemented_count_l;
+			cache.pruned_count = pruned_count_l;
+		}
 	}
+	return result;
+}
 
-	if (generate_cache_a.cemented_count)
+void nano::ledger::checkpoint_write ()
+{
+	if (cache_complete)
 	{
-		store.confirmation_height_for_each_par (
-		[this](nano::read_transaction const & /*unused*/, nano::store_iterator<nano::account, nano::confirmation_height_info> i, nano::store_iterator<nano::account, nano::confirmation_height_info> n) {
-			uint64_t cemented_count_l (0);
-			for (; i != n; ++i)
+		auto transaction (store.tx_begin_write ({ nano::tables::meta }));
+		uint64_t snapshot_id (0);
+		if (!store.snapshot_id (transaction, snapshot_id))
+		{
+			auto rep_amounts (cache.rep_weights.get_rep_amounts ());
+			std::vector<uint8_t> checkpoint;
 			{
-				cemented_count_l += i->second.height;
+				nano::vectorstream stream (checkpoint);
+				nano::write (stream, checkpoint_version);
+				nano::write (stream, static_cast<int32_t> (store.version_get (transaction)));
+				nano::write (stream, snapshot_id);
+				nano::write (stream, cache.block_count.load ());
+				nano::write (stream, cache.account_count.load ());
+				nano::write (stream, cache.cemented_count.load ());
+				nano::write (stream, cache.pruned_count.load ());
+				nano::write (stream, static_cast<uint64_t> (rep_amounts.size ()));
+				for (auto const & amount : rep_amounts)
+				{
+					nano::write (stream, amount.first.bytes);
+					nano::write (stream, nano::amount (amount.second).bytes);
+				}
 			}
-			this->cache.cemented_count += cemented_count_l;
-		});
+			store.ledger_checkpoint_put (transaction, checkpoint);
+		}
 	}
+}
 
-	auto transaction (store.tx_begin_read ());
-	cache.pruned_count = store.pruned_count (transaction);
+void nano::ledger::checkpoint_clear ()
+{
+	std::vector<uint8_t> checkpoint;
+	if (!store.ledger_checkpoint_get (store.tx_begin_read (), checkpoint))
+	{
+		auto transaction (store.tx_begin_write ({ nano::tables::meta }));
+		store.ledger_checkpoint_del (transaction);
+	}
 }
 
 // Balance for account containing hash
@@ -807,6 +932,26 @@ nano::uint128_t nano::ledger::balance_safe (nano::transaction const & transactio
 	return result;
 }
 
+bool nano::ledger::account_get (nano::transaction const & transaction_a, nano::account const & account_a, nano::account_info & info_a) const
+{
+	uint64_t snapshot (0);
+	if (account_info_cache.capacity () == 0 || store.snapshot_id (transaction_a, snapshot))
+	{
+		return store.account_get (transaction_a, account_a, info_a);
+	}
+	auto result (account_info_cache.get (snapshot, account_a, info_a));
+	stats.inc (nano::stat::type::account_info_cache, result ? nano::stat::detail::cache_miss : nano::stat::detail::cache_hit);
+	if (result)
+	{
+		result = store.account_get (transaction_a, account_a, info_a);
+		if (!result)
+		{
+			account_info_cache.fill (snapshot, account_a, info_a);
+		}
+	}
+	return result;
+}
+
 // Balance for an account by account number
 nano::uint128_t nano::ledger::account_balance (nano::transaction const & transaction_a, nano::account const & account_a, bool only_confirmed_a)
 {
@@ -822,7 +967,7 @@ nano::uint128_t nano::ledger::account_balance (nano::transaction const & transac
 	else
 	{
 		nano::account_info info;
-		auto none (store.account_get (transaction_a, account_a, info));
+		auto none (account_get (transaction_a, account_a, info));
 		if (!none)
 		{
 			result = info.balance.number ();
@@ -1046,7 +1191,7 @@ bool nano::ledger::rollback (nano::write_transaction const & transaction_a, nano
 		store.confirmation_height_get (transaction_a, account_l, confirmation_height_info);
 		if (block_account_height > confirmation_height_info.height)
 		{
-			auto latest_error = store.account_get (transaction_a, account_l, account_info);
+			auto latest_error = account_get (transaction_a, account_l, account_info);
 			debug_assert (!latest_error);
 			auto block (store.block_get (transaction_a, account_info.head));
 			list_a.push_back (block);
@@ -1126,7 +1271,7 @@ nano::uint128_t nano::ledger::amount_safe (nano::transaction const & transaction
 nano::block_hash nano::ledger::latest (nano::transaction const & transaction_a, nano::account const & account_a)
 {
 	nano::account_info info;
-	auto latest_error (store.account_get (transaction_a, account_a, info));
+	auto latest_error (account_get (transaction_a, account_a, info));
 	return latest_error ? 0 : info.head;
 }
 
@@ -1134,7 +1279,7 @@ nano::block_hash nano::ledger::latest (nano::transaction const & transaction_a,
 nano::root nano::ledger::latest_root (nano::transaction const & transaction_a, nano::account const & account_a)
 {
 	nano::account_info info;
-	if (store.account_get (transaction_a, account_a, info))
+	if (account_get (transaction_a, account_a, info))
 	{
 		return account_a;
 	}
@@ -1266,6 +1411,18 @@ void nano::ledger::update_account (nano::write_transaction const & transaction_a
 		debug_assert (cache.account_count > 0);
 		--cache.account_count;
 	}
+	uint64_t snapshot (0);
+	if (account_info_cache.capacity () > 0 && !store.snapshot_id (transaction_a, snapshot))
+	{
+		if (!new_a.head.is_zero ())
+		{
+			account_info_cache.put (snapshot, account_a, new_a);
+		}
+		else
+		{
+			account_info_cache.erase (snapshot, account_a);
+		}
+	}
 }
 
 std::shared_ptr<nano::block> nano::ledger::successor (nano::transaction const & transaction_a, nano::qualified_root const & root_a)
@@ -1275,7 +1432,7 @@ std::shared_ptr<nano::block> nano::ledger::successor (nano::transaction const &
 	if (root_a.previous ().is_zero ())
 	{
 		nano::account_info info;
-		if (!store.account_get (transaction_a, root_a.root ().as_account (), info))
+		if (!account_get (transaction_a, root_a.root ().as_account (), info))
 		{
 			successor = info.open_block;
 		}
@@ -1311,7 +1468,7 @@ std::shared_ptr<nano::block> nano::ledger::forked_block (nano::transaction const
 	if (result == nullptr)
 	{
 		nano::account_info info;
-		auto error (store.account_get (transaction_a, root.as_account (), info));
+		auto error (account_get (transaction_a, root.as_account (), info));
 		(void)error;
 		debug_assert (!error);
 		result = store.block_get (transaction_a, info.open_block);
@@ -1339,12 +1496,13 @@ uint64_t nano::ledger::pruning_action (nano::write_transaction & transaction_a,
 	nano::block_hash hash (hash_a);
 	while (!hash.is_zero () && hash != network_params.ledger.genesis_hash)
 	{
-		auto block (store.block_get (transaction_a, hash));
-		if (block != nullptr)
+		nano::block_hash previous;
+		uint64_t timestamp;
+		if (!store.block_previous_timestamp_get (transaction_a, hash, previous, timestamp))
 		{
 			store.block_del (transaction_a, hash);
 			store.pruned_put (transaction_a, hash);
-			hash = block->previous ();
+			hash = previous;
 			++pruned_count;
 			++cache.pruned_count;
 			if (pruned_count % batch_size_a == 0)
@@ -1397,8 +1555,33 @@ std::multimap<uint64_t, nano::uncemented_info, std::greater<>> nano::ledger::unc
 	return result;
 }
 
+namespace
+{
+void bulk_put (nano::bulk_loader & loader_a, nano::block_hash const & hash_a, nano::block_w_sideband const & block_a)
+{
+	std::vector<uint8_t> vector;
+	{
+		nano::vectorstream stream (vector);
+		nano::serialize_block (stream, *block_a.block);
+		block_a.sideband.serialize (stream, block_a.block->type ());
+	}
+	loader_a.put (hash_a, vector);
+}
+
+void bulk_put (nano::bulk_loader & loader_a, nano::block_hash const & hash_a, std::nullptr_t)
+{
+	loader_a.put (hash_a);
+}
+
+template <typename Key, typename Value>
+void bulk_put (nano::bulk_loader & loader_a, Key const & key_a, Value const & value_a)
+{
+	loader_a.put (key_a, value_a);
+}
+}
+
 // A precondition is that the store is an LMDB store
-bool nano::ledger::migrate_lmdb_to_rocksdb (boost::filesystem::path const & data_path_a) const
+bool nano::ledger::migrate_lmdb_to_rocksdb (boost::filesystem::path const & data_path_a, std::function<void (std::string const &)> const & progress_a) const
 {
 	boost::system::error_code error_chmod;
 	nano::set_secure_perm_directory (data_path_a, error_chmod);
@@ -1415,76 +1598,54 @@ bool nano::ledger::migrate_lmdb_to_rocksdb (boost::filesystem::path const & data
 
 	if (!rocksdb_store->init_error ())
 	{
-		store.blocks_for_each_par (
-		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::blocks }));
-
-				std::vector<uint8_t> vector;
+		// Tables are iterated in key order by the traversal threads, each of which loads its key range directly in to the store
+		auto migrate = [this, &rocksdb_store, &error, &progress_a](nano::tables table_a, std::string const & name_a, auto const & for_each_par_a) {
+			auto start (std::chrono::steady_clock::now ());
+			std::atomic<uint64_t> count{ 0 };
+			std::atomic<bool> error_l{ false };
+			for_each_par_a (store, [&rocksdb_store, &count, &error_l, table_a](nano::read_transaction const & /*unused*/, auto i, auto n) {
+				auto loader (rocksdb_store->make_bulk_loader (table_a));
+				for (; i != n; ++i)
 				{
-					nano::vectorstream stream (vector);
-					nano::serialize_block (stream, *i->second.block);
-					i->second.sideband.serialize (stream, i->second.block->type ());
+					bulk_put (*loader, i->first, i->second);
 				}
-				rocksdb_store->block_raw_put (rocksdb_transaction, vector, i->first);
-			}
-		});
+				if (loader->commit ())
+				{
+					error_l = true;
+				}
+				count += loader->count;
+			});
+			auto migrated (std::chrono::steady_clock::now ());
+			// Verify every record made it in to the new store
+			std::atomic<uint64_t> verified{ 0 };
+			for_each_par_a (*rocksdb_store, [&verified](nano::read_transaction const & /*unused*/, auto i, auto n) {
+				uint64_t verified_l (0);
+				for (; i != n; ++i)
+				{
+					++verified_l;
+				}
+				verified += verified_l;
+			});
+			error_l = error_l || verified != count;
+			error = error || error_l;
+			progress_a (boost::str (boost::format ("Migrated %1% %2% in %3% ms, verified in %4% ms%5%") % count.load () % name_a % std::chrono::duration_cast<std::chrono::milliseconds> (migrated - start).count () % std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - migrated).count () % (error_l ? ", verification failed" : "")));
+		};
+		migrate (nano::tables::blocks, "blocks", [](nano::block_store const & store_a, auto const & action_a) { store_a.blocks_for_each_par (action_a); });
+		migrate (nano::tables::pending, "pending", [](nano::block_store const & store_a, auto const & action_a) { store_a.pending_for_each_par (action_a); });
+		migrate (nano::tables::confirmation_height, "confirmation heights", [](nano::block_store const & store_a, auto const & action_a) { store_a.confirmation_height_for_each_par (action_a); });
+		migrate (nano::tables::accounts, "accounts", [](nano::block_store const & store_a, auto const & action_a) { store_a.accounts_for_each_par (action_a); });
+		migrate (nano::tables::frontiers, "frontiers", [](nano::block_store const & store_a, auto const & action_a) { store_a.frontiers_for_each_par (action_a); });
+		migrate (nano::tables::pruned, "pruned blocks", [](nano::block_store const & store_a, auto const & action_a) { store_a.pruned_for_each_par (action_a); });
 
 		store.unchecked_for_each_par (
 		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
 			for (; i != n; ++i)
 			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::unchecked }));
+				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::unchecked, nano::tables::unchecked_expiry }));
 				rocksdb_store->unchecked_put (rocksdb_transaction, i->first, i->second);
 			}
 		});
 
-		store.pending_for_each_par (
-		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::pending }));
-				rocksdb_store->pending_put (rocksdb_transaction, i->first, i->second);
-			}
-		});
-
-		store.confirmation_height_for_each_par (
-		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::confirmation_height }));
-				rocksdb_store->confirmation_height_put (rocksdb_transaction, i->first, i->second);
-			}
-		});
-
-		store.accounts_for_each_par (
-		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::accounts }));
-				rocksdb_store->account_put (rocksdb_transaction, i->first, i->second);
-			}
-		});
-
-		store.frontiers_for_each_par (
-		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::frontiers }));
-				rocksdb_store->frontier_put (rocksdb_transaction, i->first, i->second);
-			}
-		});
-
-		store.pruned_for_each_par (
-		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
-			for (; i != n; ++i)
-			{
-				auto rocksdb_transaction (rocksdb_store->tx_begin_write ({}, { nano::tables::pruned }));
-				rocksdb_store->pruned_put (rocksdb_transaction, i->first);
-			}
-		});
-
 		store.final_vote_for_each_par (
 		[&rocksdb_store](nano::read_transaction const & /*unused*/, auto i, auto n) {
 			for (; i != n; ++i)
@@ -1551,5 +1712,6 @@ std::unique_ptr<nano::container_info_component> nano::collect_container_info (le
 	auto composite = std::make_unique<container_info_composite> (name);
 	composite->add_component (std::make_unique<container_info_leaf> (container_info{ "bootstrap_weights", count, sizeof_element }));
 	composite->add_component (collect_container_info (ledger.cache.rep_weights, "rep_weights"));
+	composite->add_component (collect_container_info (ledger.account_info_cache, "account_info_cache"));
 	return composite;
 }
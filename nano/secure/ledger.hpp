@@ -2,6 +2,7 @@
 
 #include <nano/lib/rep_weights.hpp>
 #include <nano/lib/timer.hpp>
+#include <nano/secure/account_info_cache.hpp>
 #include <nano/secure/common.hpp>
 
 #include <map>
@@ -26,7 +27,7 @@ public:
 class ledger final
 {
 public:
-	ledger (nano::block_store &, nano::stat &, nano::generate_cache const & = nano::generate_cache ());
+	ledger (nano::block_store &, nano::stat &, nano::generate_cache const & = nano::generate_cache (), size_t account_info_cache_size_a = 0);
 	nano::account account (nano::transaction const &, nano::block_hash const &) const;
 	nano::account account_safe (nano::transaction const &, nano::block_hash const &, bool &) const;
 	nano::uint128_t amount (nano::transaction const &, nano::account const &);
@@ -35,6 +36,8 @@ public:
 	nano::uint128_t amount_safe (nano::transaction const &, nano::block_hash const & hash_a, bool &) const;
 	nano::uint128_t balance (nano::transaction const &, nano::block_hash const &) const;
 	nano::uint128_t balance_safe (nano::transaction const &, nano::block_hash const &, bool &) const;
+	/** Same as block_store::account_get, served from the account info cache when it holds the account for this transaction */
+	bool account_get (nano::transaction const &, nano::account const &, nano::account_info &) const;
 	nano::uint128_t account_balance (nano::transaction const &, nano::account const &, bool = false);
 	nano::uint128_t account_pending (nano::transaction const &, nano::account const &, bool = false);
 	nano::uint128_t weight (nano::account const &);
@@ -68,20 +71,36 @@ public:
 	nano::account const & epoch_signer (nano::link const &) const;
 	nano::link const & epoch_link (nano::epoch) const;
 	std::multimap<uint64_t, uncemented_info, std::greater<>> unconfirmed_frontiers () const;
-	bool migrate_lmdb_to_rocksdb (boost::filesystem::path const &) const;
+	/** Copies the LMDB ledger to a RocksDB store in data_path/rocksdb, reporting progress of each table to \p progress_a */
+	bool migrate_lmdb_to_rocksdb (boost::filesystem::path const &, std::function<void (std::string const &)> const & progress_a = [](std::string const &) {}) const;
+	/**
+	 * Stores the cache so the next ledger constructed on this store loads it instead of walking the tables.
+	 * Only done by stores which number their commits, the checkpoint is ignored once anything else is committed after it.
+	 * Nothing may write to the ledger afterwards without calling checkpoint_clear () first.
+	 */
+	void checkpoint_write ();
+	void checkpoint_clear ();
 	static nano::uint128_t const unit;
 	nano::network_params network_params;
 	nano::block_store & store;
 	nano::ledger_cache cache;
+	mutable nano::account_info_cache account_info_cache;
 	nano::stat & stats;
 	std::unordered_map<nano::account, nano::uint128_t> bootstrap_weights;
 	std::atomic<size_t> bootstrap_weights_size{ 0 };
 	uint64_t bootstrap_weight_max_blocks{ 1 };
 	std::atomic<bool> check_bootstrap_weights;
 	bool pruning{ false };
+	/** Steps taken to fill the cache at construction and their durations */
+	std::vector<std::pair<std::string, std::chrono::milliseconds>> initialize_timings;
+	static uint32_t constexpr checkpoint_version = 1;
 
 private:
 	void initialize (nano::generate_cache const &);
+	/** Fills the cache from a stored checkpoint, returns true if there is no valid one */
+	bool checkpoint_read ();
+	/** Every cache field was generated or loaded, so it can be checkpointed */
+	bool cache_complete{ false };
 };
 
 std::unique_ptr<container_info_component> collect_container_info (ledger & ledger, std::string const & name);
@@ -0,0 +1,508 @@
+#include <nano/crypto/blake2/blake2.h>
+#include <nano/lib/stream.hpp>
+#include <nano/secure/blockstore.hpp>
+#include <nano/secure/buffer.hpp>
+#include <nano/secure/ledger.hpp>
+#include <nano/secure/ledger_snapshot.hpp>
+
+#include <algorithm>
+
+constexpr uint64_t nano::ledger_snapshot::magic;
+constexpr uint32_t nano::ledger_snapshot::format_version;
+constexpr size_t nano::ledger_snapshot::chunk_size;
+constexpr size_t nano::ledger_snapshot::header_size;
+constexpr size_t nano::ledger_snapshot::chunk_header_size;
+
+namespace
+{
+bool read_bytes (std::ifstream & input_a, size_t size_a, std::vector<uint8_t> & bytes_a)
+{
+	bytes_a.resize (size_a);
+	input_a.read (reinterpret_cast<char *> (bytes_a.data ()), size_a);
+	return static_cast<size_t> (input_a.gcount ()) != size_a;
+}
+}
+
+nano::ledger_snapshot::ledger_snapshot (nano::ledger & ledger_a) :
+ledger (ledger_a)
+{
+}
+
+nano::ledger_snapshot::chunk::chunk (nano::ledger_snapshot & snapshot_a, nano::ledger_snapshot::table table_a) :
+snapshot (snapshot_a),
+table (table_a)
+{
+	payload.reserve (chunk_size + 1024);
+}
+
+void nano::ledger_snapshot::chunk::added ()
+{
+	++count;
+	if (payload.size () >= chunk_size)
+	{
+		flush ();
+	}
+}
+
+void nano::ledger_snapshot::chunk::flush ()
+{
+	if (count > 0)
+	{
+		snapshot.write (table, count, payload);
+		snapshot.records += count;
+		count = 0;
+		payload.clear ();
+	}
+}
+
+nano::uint256_union nano::ledger_snapshot::checksum (nano::ledger_snapshot::table table_a, uint64_t count_a, std::vector<uint8_t> const & payload_a)
+{
+	nano::uint256_union result;
+	blake2b_state hash;
+	blake2b_init (&hash, sizeof (result.bytes));
+	blake2b_update (&hash, &table_a, sizeof (table_a));
+	blake2b_update (&hash, &count_a, sizeof (count_a));
+	blake2b_update (&hash, payload_a.data (), payload_a.size ());
+	blake2b_final (&hash, result.bytes.data (), sizeof (result.bytes));
+	return result;
+}
+
+void nano::ledger_snapshot::write (nano::ledger_snapshot::table table_a, uint64_t count_a, std::vector<uint8_t> const & payload_a)
+{
+	// Checksums are calculated by the encoding threads, only appending to the file is serialized
+	std::vector<uint8_t> header;
+	{
+		nano::vectorstream stream (header);
+		nano::write (stream, table_a);
+		nano::write (stream, count_a);
+		nano::write (stream, static_cast<uint64_t> (payload_a.size ()));
+		nano::write (stream, checksum (table_a, count_a, payload_a).bytes);
+	}
+	debug_assert (header.size () == chunk_header_size);
+	nano::lock_guard<nano::mutex> guard (mutex);
+	output.write (reinterpret_cast<char const *> (header.data ()), header.size ());
+	output.write (reinterpret_cast<char const *> (payload_a.data ()), payload_a.size ());
+	error = error || output.fail ();
+	bytes += header.size () + payload_a.size ();
+	++chunks;
+}
+
+bool nano::ledger_snapshot::export_file (boost::filesystem::path const & path_a)
+{
+	auto start (std::chrono::steady_clock::now ());
+	output.open (path_a.string (), std::ios::binary | std::ios::trunc);
+	error = output.fail ();
+	if (!error)
+	{
+		std::vector<uint8_t> header;
+		{
+			nano::vectorstream stream (header);
+			nano::write (stream, magic);
+			nano::write (stream, format_version);
+			nano::write (stream, static_cast<int32_t> (ledger.store.version_get (ledger.store.tx_begin_read ())));
+			nano::write (stream, ledger.network_params.ledger.genesis_hash.bytes);
+		}
+		debug_assert (header.size () == header_size);
+		output.write (reinterpret_cast<char const *> (header.data ()), header.size ());
+		bytes += header.size ();
+
+		// Inactive nodes do not generate the weights cache, they are calculated from the accounts the same way ledger::initialize does
+		nano::rep_weights rep_weights;
+		ledger.store.accounts_for_each_par (
+		[this, &rep_weights](nano::read_transaction const & /*unused*/, auto i, auto n) {
+			chunk chunk_l (*this, table::accounts);
+			nano::rep_weights rep_weights_l;
+			for (; i != n && !error; ++i)
+			{
+				nano::account_info const & info (i->second);
+				{
+					nano::vectorstream stream (chunk_l.payload);
+					nano::write (stream, i->first.bytes);
+					nano::write (stream, info.head.bytes);
+					nano::write (stream, info.representative.bytes);
+					nano::write (stream, info.open_block.bytes);
+					nano::write (stream, info.balance.bytes);
+					nano::write (stream, info.modified);
+					nano::write (stream, info.block_count);
+					nano::write (stream, info.epoch_m);
+				}
+				chunk_l.added ();
+				rep_weights_l.representation_add (info.representative, info.balance.number ());
+			}
+			chunk_l.flush ();
+			rep_weights.copy_from (rep_weights_l);
+		});
+
+		ledger.store.blocks_for_each_par (
+		[this](nano::read_transaction const & /*unused*/, auto i, auto n) {
+			chunk chunk_l (*this, table::blocks);
+			std::vector<uint8_t> block;
+			for (; i != n && !error; ++i)
+			{
+				block.clear ();
+				{
+					nano::vectorstream stream (block);
+					nano::serialize_block (stream, *i->second.block);
+					i->second.sideband.serialize (stream, i->second.block->type ());
+				}
+				{
+					nano::vectorstream stream (chunk_l.payload);
+					nano::write (stream, i->first.bytes);
+					nano::write (stream, static_cast<uint32_t> (block.size ()));
+					nano::write (stream, block);
+				}
+				chunk_l.added ();
+			}
+			chunk_l.flush ();
+		});
+
+		ledger.store.frontiers_for_each_par (
+		[this](nano::read_transaction const & /*unused*/, auto i, auto n) {
+			chunk chunk_l (*this, table::frontiers);
+			for (; i != n && !error; ++i)
+			{
+				{
+					nano::vectorstream stream (chunk_l.payload);
+					nano::write (stream, i->first.bytes);
+					nano::write (stream, i->second.bytes);
+				}
+				chunk_l.added ();
+			}
+			chunk_l.flush ();
+		});
+
+		ledger.store.pending_for_each_par (
+		[this](nano::read_transaction const & /*unused*/, auto i, auto n) {
+			chunk chunk_l (*this, table::pending);
+			for (; i != n && !error; ++i)
+			{
+				{
+					nano::vectorstream stream (chunk_l.payload);
+					nano::write (stream, i->first.account.bytes);
+					nano::write (stream, i->first.hash.bytes);
+					nano::write (stream, i->second.source.bytes);
+					nano::write (stream, i->second.amount.bytes);
+					nano::write (stream, i->second.epoch);
+				}
+				chunk_l.added ();
+			}
+			chunk_l.flush ();
+		});
+
+		ledger.store.confirmation_height_for_each_par (
+		[this](nano::read_transaction const & /*unused*/, auto i, auto n) {
+			chunk chunk_l (*this, table::confirmation_height);
+			for (; i != n && !error; ++i)
+			{
+				{
+					nano::vectorstream stream (chunk_l.payload);
+					nano::write (stream, i->first.bytes);
+					i->second.serialize (stream);
+				}
+				chunk_l.added ();
+			}
+			chunk_l.flush ();
+		});
+
+		ledger.store.pruned_for_each_par (
+		[this](nano::read_transaction const & /*unused*/, auto i, auto n) {
+			chunk chunk_l (*this, table::pruned);
+			for (; i != n && !error; ++i)
+			{
+				{
+					nano::vectorstream stream (chunk_l.payload);
+					nano::write (stream, i->first.bytes);
+				}
+				chunk_l.added ();
+			}
+			chunk_l.flush ();
+		});
+
+		chunk weights_l (*this, table::rep_weights);
+		for (auto const & weight : rep_weights.get_rep_amounts ())
+		{
+			{
+				nano::vectorstream stream (weights_l.payload);
+				nano::write (stream, weight.first.bytes);
+				nano::write (stream, nano::amount (weight.second).bytes);
+			}
+			weights_l.added ();
+		}
+		weights_l.flush ();
+
+		write (table::end, records, {});
+		output.close ();
+		error = error || output.fail ();
+	}
+	elapsed = std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - start);
+	return error;
+}
+
+bool nano::ledger_snapshot::load (nano::ledger_snapshot::table table_a, uint64_t count_a, std::vector<uint8_t> const & payload_a)
+{
+	auto result (false);
+	nano::bufferstream stream (payload_a.data (), payload_a.size ());
+	if (table_a == table::rep_weights)
+	{
+		for (uint64_t i (0); i < count_a && !result; ++i)
+		{
+			nano::account representative;
+			nano::amount weight;
+			result = nano::try_read (stream, representative.bytes) || nano::try_read (stream, weight.bytes);
+			if (!result)
+			{
+				weights[representative] += weight.number ();
+			}
+		}
+	}
+	else
+	{
+		std::vector<nano::tables> tables;
+		switch (table_a)
+		{
+			case table::accounts:
+				tables = { nano::tables::accounts };
+				break;
+			case table::blocks:
+				tables = { nano::tables::blocks };
+				break;
+			case table::frontiers:
+				tables = { nano::tables::frontiers };
+				break;
+			case table::pending:
+				tables = { nano::tables::pending };
+				break;
+			case table::confirmation_height:
+				tables = { nano::tables::confirmation_height };
+				break;
+			case table::pruned:
+				tables = { nano::tables::pruned };
+				break;
+			default:
+				result = true;
+				break;
+		}
+		if (!result)
+		{
+			// Records of a chunk are in key order, each chunk is written in one transaction
+			auto transaction (ledger.store.tx_begin_write (tables));
+			// Imported accounts replace what the account_info cache may hold for them
+			uint64_t snapshot (0);
+			auto cached (table_a == table::accounts && ledger.account_info_cache.capacity () > 0 && !ledger.store.snapshot_id (transaction, snapshot));
+			std::vector<uint8_t> block;
+			for (uint64_t i (0); i < count_a && !result; ++i)
+			{
+				switch (table_a)
+				{
+					case table::accounts:
+					{
+						nano::account account;
+						nano::account_info info;
+						result = nano::try_read (stream, account.bytes) || info.deserialize (stream);
+						if (!result)
+						{
+							ledger.store.account_put (transaction, account, info);
+							if (cached)
+							{
+								ledger.account_info_cache.put (snapshot, account, info);
+							}
+						}
+						break;
+					}
+					case table::blocks:
+					{
+						nano::block_hash hash;
+						uint32_t size;
+						result = nano::try_read (stream, hash.bytes) || nano::try_read (stream, size) || size > payload_a.size ();
+						if (!result)
+						{
+							block.resize (size);
+							result = stream.sgetn (block.data (), size) != size;
+						}
+						if (!result)
+						{
+							ledger.store.block_raw_put (transaction, block, hash);
+						}
+						break;
+					}
+					case table::frontiers:
+					{
+						nano::block_hash hash;
+						nano::account account;
+						result = nano::try_read (stream, hash.bytes) || nano::try_read (stream, account.bytes);
+						if (!result)
+						{
+							ledger.store.frontier_put (transaction, hash, account);
+						}
+						break;
+					}
+					case table::pending:
+					{
+						nano::pending_key key;
+						nano::pending_info info;
+						result = key.deserialize (stream) || info.deserialize (stream);
+						if (!result)
+						{
+							ledger.store.pending_put (transaction, key, info);
+						}
+						break;
+					}
+					case table::confirmation_height:
+					{
+						nano::account account;
+						nano::confirmation_height_info info;
+						result = nano::try_read (stream, account.bytes) || info.deserialize (stream);
+						if (!result)
+						{
+							ledger.store.confirmation_height_put (transaction, account, info);
+						}
+						break;
+					}
+					case table::pruned:
+					{
+						nano::block_hash hash;
+						result = nano::try_read (stream, hash.bytes);
+						if (!result)
+						{
+							ledger.store.pruned_put (transaction, hash);
+						}
+						break;
+					}
+					default:
+						debug_assert (false);
+						break;
+				}
+			}
+		}
+	}
+	return result;
+}
+
+bool nano::ledger_snapshot::update_cache ()
+{
+	nano::rep_weights rep_weights;
+	std::atomic<uint64_t> block_count{ 0 };
+	std::atomic<uint64_t> account_count{ 0 };
+	std::atomic<uint64_t> cemented_count{ 0 };
+	ledger.store.accounts_for_each_par (
+	[&rep_weights, &block_count, &account_count](nano::read_transaction const & /*unused*/, nano::store_iterator<nano::account, nano::account_info> i, nano::store_iterator<nano::account, nano::account_info> n) {
+		uint64_t block_count_l{ 0 };
+		uint64_t account_count_l{ 0 };
+		nano::rep_weights rep_weights_l;
+		for (; i != n; ++i)
+		{
+			nano::account_info const & info (i->second);
+			block_count_l += info.block_count;
+			++account_count_l;
+			rep_weights_l.representation_add (info.representative, info.balance.number ());
+		}
+		block_count += block_count_l;
+		account_count += account_count_l;
+		rep_weights.copy_from (rep_weights_l);
+	});
+	ledger.store.confirmation_height_for_each_par (
+	[&cemented_count](nano::read_transaction const & /*unused*/, nano::store_iterator<nano::account, nano::confirmation_height_info> i, nano::store_iterator<nano::account, nano::confirmation_height_info> n) {
+		uint64_t cemented_count_l (0);
+		for (; i != n; ++i)
+		{
+			cemented_count_l += i->second.height;
+		}
+		cemented_count += cemented_count_l;
+	});
+
+	auto amounts (rep_weights.get_rep_amounts ());
+	auto non_zero = [](std::unordered_map<nano::account, nano::uint128_t> const & amounts_a) {
+		return std::count_if (amounts_a.begin (), amounts_a.end (), [](auto const & amount_a) { return amount_a.second != 0; });
+	};
+	auto result (non_zero (amounts) != non_zero (weights));
+	for (auto i (weights.begin ()), n (weights.end ()); i != n && !result; ++i)
+	{
+		if (i->second != 0)
+		{
+			auto existing (amounts.find (i->first));
+			result = existing == amounts.end () || existing->second != i->second;
+		}
+	}
+	if (!result)
+	{
+		// The cache was generated from the genesis only ledger
+		for (auto const & amount : ledger.cache.rep_weights.get_rep_amounts ())
+		{
+			if (amounts.find (amount.first) == amounts.end ())
+			{
+				ledger.cache.rep_weights.representation_put (amount.first, 0);
+			}
+		}
+		for (auto const & amount : amounts)
+		{
+			ledger.cache.rep_weights.representation_put (amount.first, amount.second);
+		}
+		ledger.cache.block_count = block_count.load ();
+		ledger.cache.account_count = account_count.load ();
+		ledger.cache.cemented_count = cemented_count.load ();
+		ledger.cache.pruned_count = ledger.store.pruned_count (ledger.store.tx_begin_read ());
+	}
+	return result;
+}
+
+bool nano::ledger_snapshot::import_file (boost::filesystem::path const & path_a)
+{
+	auto start (std::chrono::steady_clock::now ());
+	std::ifstream input (path_a.string (), std::ios::binary);
+	auto result (input.fail ());
+	if (!result)
+	{
+		// Genesis is the only block of a newly initialized ledger, blocks of any other ledger would be mixed with the snapshot
+		auto transaction (ledger.store.tx_begin_read ());
+		result = ledger.store.block_count (transaction) > 1;
+		std::vector<uint8_t> header;
+		result = result || read_bytes (input, header_size, header);
+		if (!result)
+		{
+			nano::bufferstream stream (header.data (), header.size ());
+			uint64_t magic_l;
+			uint32_t format_version_l;
+			int32_t store_version_l;
+			nano::block_hash genesis_l;
+			result = nano::try_read (stream, magic_l) || nano::try_read (stream, format_version_l) || nano::try_read (stream, store_version_l) || nano::try_read (stream, genesis_l.bytes);
+			result = result || magic_l != magic || format_version_l != format_version || store_version_l != ledger.store.version_get (transaction) || genesis_l != ledger.network_params.ledger.genesis_hash;
+			bytes += header.size ();
+		}
+	}
+	auto done (false);
+	while (!result && !done)
+	{
+		std::vector<uint8_t> header;
+		result = read_bytes (input, chunk_header_size, header);
+		if (!result)
+		{
+			nano::bufferstream stream (header.data (), header.size ());
+			table table_l;
+			uint64_t count_l;
+			uint64_t size_l;
+			nano::uint256_union checksum_l;
+			result = nano::try_read (stream, table_l) || nano::try_read (stream, count_l) || nano::try_read (stream, size_l) || nano::try_read (stream, checksum_l.bytes);
+			if (!result && table_l == table::end)
+			{
+				result = count_l != records || checksum (table_l, count_l, {}) != checksum_l;
+				done = true;
+			}
+			else if (!result)
+			{
+				// Chunks only exceed chunk_size by their last record, larger sizes are corrupt and are not allocated
+				std::vector<uint8_t> payload;
+				result = size_l > 2 * chunk_size || read_bytes (input, size_l, payload);
+				result = result || checksum (table_l, count_l, payload) != checksum_l || load (table_l, count_l, payload);
+				if (!result)
+				{
+					records += count_l;
+					bytes += header.size () + payload.size ();
+					++chunks;
+				}
+			}
+		}
+	}
+	result = result || update_cache ();
+	elapsed = std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - start);
+	return result;
+}
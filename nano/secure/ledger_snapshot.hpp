@@ -0,0 +1,82 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+namespace nano
+{
+class ledger;
+
+/**
+ * Writes the ledger tables to a single file and reads them back in to an empty ledger, so nodes can be provisioned without bootstrapping.
+ * The file starts with a header naming the store version and the genesis block, followed by chunks holding records of a single table.
+ * Every chunk carries a blake2b checksum of its contents. Chunks are encoded by the threads traversing the tables so they appear in no
+ * particular order, a final chunk counts the records written so truncated files are detected.
+ * Snapshots are trusted, the checksums detect corruption but imported blocks are not validated. The exported ledger must not be
+ * written to while the snapshot is taken and a failed import leaves a partially written ledger behind.
+ */
+class ledger_snapshot final
+{
+public:
+	explicit ledger_snapshot (nano::ledger &);
+	/** Returns true if the snapshot could not be written to \p path_a */
+	bool export_file (boost::filesystem::path const & path_a);
+	/** Returns true if \p path_a is not a valid snapshot of this network and store version, or if the ledger holds blocks besides genesis */
+	bool import_file (boost::filesystem::path const & path_a);
+	enum class table : uint8_t
+	{
+		accounts,
+		blocks,
+		frontiers,
+		pending,
+		confirmation_height,
+		pruned,
+		rep_weights,
+		end = 0xff
+	};
+	nano::ledger & ledger;
+	std::atomic<uint64_t> records{ 0 };
+	std::atomic<uint64_t> chunks{ 0 };
+	/** Bytes written to or read from the file */
+	std::atomic<uint64_t> bytes{ 0 };
+	std::chrono::milliseconds elapsed{ 0 };
+	static uint64_t constexpr magic = 0x70616e736f6e616eULL;
+	static uint32_t constexpr format_version = 1;
+	/** Chunks are written once their payload reaches this size */
+	static size_t constexpr chunk_size = 4 * 1024 * 1024;
+
+private:
+	class chunk final
+	{
+	public:
+		chunk (nano::ledger_snapshot &, nano::ledger_snapshot::table);
+		/** Counts a record appended to payload, writes the chunk once it is full */
+		void added ();
+		/** Writes the records not written yet */
+		void flush ();
+		nano::ledger_snapshot & snapshot;
+		nano::ledger_snapshot::table const table;
+		uint64_t count{ 0 };
+		std::vector<uint8_t> payload;
+	};
+	void write (nano::ledger_snapshot::table, uint64_t, std::vector<uint8_t> const &);
+	bool load (nano::ledger_snapshot::table, uint64_t, std::vector<uint8_t> const &);
+	/** Refreshes the ledger cache from the imported tables, returns true if the weights differ from the exported ones */
+	bool update_cache ();
+	static nano::uint256_union checksum (nano::ledger_snapshot::table, uint64_t, std::vector<uint8_t> const &);
+	static size_t constexpr header_size = sizeof (magic) + sizeof (format_version) + sizeof (int32_t) + sizeof (nano::block_hash);
+	static size_t constexpr chunk_header_size = sizeof (table) + sizeof (uint64_t) + sizeof (uint64_t) + sizeof (nano::uint256_union);
+	nano::mutex mutex;
+	std::ofstream output;
+	std::atomic<bool> error{ false };
+	std::unordered_map<nano::account, nano::uint128_t> weights;
+};
+}
@@ -1,5 +1,6 @@
 #include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/threading.hpp>
+#include <nano/lib/timing_wheel.hpp>
 #include <nano/node/election.hpp>
 #include <nano/node/testing.hpp>
 #include <nano/node/transport/udp.hpp>
@@ -1863,3 +1864,95 @@ TEST (node, wallet_create_block_confirm_conflicts)
 		t.join ();
 	}
 }
+
+// Pulls one long account chain so the whole transfer runs over a single bootstrap connection
+TEST (bootstrap, bulk_pull_throughput)
+{
+	nano::system system;
+	nano::node_config config (nano::get_available_port (), system.logging);
+	config.frontiers_confirmation = nano::frontiers_confirmation_mode::disabled;
+	nano::node_flags node_flags;
+	node_flags.disable_bootstrap_bulk_push_client = true;
+	node_flags.disable_lazy_bootstrap = true;
+	node_flags.disable_wallet_bootstrap = true;
+	auto node1 (system.add_node (config, node_flags));
+#ifndef NDEBUG
+	auto const num_blocks = 10000;
+#else
+	auto const num_blocks = 100000;
+#endif
+	nano::state_block_builder builder;
+	nano::keypair key;
+	auto latest (node1->latest (nano::dev_genesis_key.pub));
+	{
+		auto transaction (node1->store.tx_begin_write ());
+		for (auto i = 0; i < num_blocks; ++i)
+		{
+			auto send = builder.make_block ()
+			            .account (nano::dev_genesis_key.pub)
+			            .previous (latest)
+			            .representative (nano::dev_genesis_key.pub)
+			            .balance (nano::genesis_amount - i - 1)
+			            .link (key.pub)
+			            .sign (nano::dev_genesis_key.prv, nano::dev_genesis_key.pub)
+			            .work (*system.work.generate (latest))
+			            .build ();
+			ASSERT_EQ (nano::process_result::progress, node1->ledger.process (transaction, *send).code);
+			latest = send->hash ();
+		}
+	}
+	auto node2 (std::make_shared<nano::node> (system.io_ctx, nano::get_available_port (), nano::unique_path (), system.logging, system.work, node_flags));
+	ASSERT_FALSE (node2->init_error ());
+	node2->start ();
+	nano::timer<std::chrono::milliseconds> timer;
+	timer.start ();
+	node2->bootstrap_initiator.bootstrap (node1->network.endpoint (), false);
+	ASSERT_TIMELY (300s, node2->ledger.cache.block_count == num_blocks + 1);
+	auto const elapsed (std::max<uint64_t> (1, timer.stop ().count ()));
+	std::cout << num_blocks << " blocks pulled in " << elapsed << " ms, " << num_blocks * 1000 / elapsed << " blocks/s" << std::endl;
+	node2->stop ();
+}
+
+TEST (timing_wheel, cascade_past_top_level)
+{
+	auto const start (std::chrono::steady_clock::now ());
+	// Every tick up to the last deadline is stepped through, a coarse resolution keeps that to the minimum
+	nano::timing_wheel<int> wheel (1s, start);
+	// One deadline per level, and one past the span of the top level
+	std::vector<std::chrono::seconds> const delays{ 3s, 100s, 5000s, 300000s, 200 * 24h };
+	ASSERT_GT (static_cast<uint64_t> (delays.back ().count ()), uint64_t (1) << (nano::timing_wheel<int>::bits * nano::timing_wheel<int>::levels));
+	for (auto i (0); i < delays.size (); ++i)
+	{
+		wheel.insert (start + delays[i], i);
+	}
+	for (auto i (0); i < delays.size (); ++i)
+	{
+		std::vector<int> expired;
+		wheel.advance (start + delays[i] - 1s, expired);
+		ASSERT_TRUE (expired.empty ());
+		wheel.advance (start + delays[i], expired);
+		ASSERT_EQ (std::vector<int>{ i }, expired);
+		ASSERT_EQ (delays.size () - i - 1, wheel.size ());
+	}
+}
+
+TEST (uint256_union, codec_throughput)
+{
+	size_t constexpr count (1000000);
+	nano::keypair key;
+	nano::account account (key.pub);
+	char buffer[nano::public_key::account_encoded_size];
+	auto const start (std::chrono::steady_clock::now ());
+	for (size_t i (0); i < count; ++i)
+	{
+		account.qwords[0] = i;
+		account.encode_account (buffer);
+		nano::account output;
+		ASSERT_FALSE (output.decode_account (buffer, sizeof (buffer)));
+		ASSERT_EQ (account, output);
+		char hex[64];
+		account.encode_hex (hex);
+	}
+	auto const elapsed (std::chrono::duration_cast<std::chrono::duration<double>> (std::chrono::steady_clock::now () - start));
+	std::cout << boost::str (boost::format ("%1% account and hex conversions/s") % static_cast<uint64_t> (count / std::max (elapsed.count (), 1e-9))) << std::endl;
+}